@@ -0,0 +1,23 @@
+/*
+   default.slots.h -- Native property slot definitions for the "default" module
+  
+   This file is generated by ejsmod
+  
+   Slot definitions. Version 2.7.4.
+ */
+
+#ifndef _h_SLOTS_DefaultSlots
+#define _h_SLOTS_DefaultSlots 1
+
+
+/*
+   Slots for the "default" module 
+ */
+
+/*
+   Prototype (instance) slots for "global" type 
+ */
+
+#define _ES_CHECKSUM_default   2685
+
+#endif
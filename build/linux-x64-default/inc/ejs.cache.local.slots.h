@@ -0,0 +1,101 @@
+/*
+   ejs.cache.local.slots.h -- Native property slot definitions for the "ejs.cache.local" module
+  
+   This file is generated by ejsmod
+  
+   Slot definitions. Version 2.0.0.
+ */
+
+#ifndef _h_SLOTS_EjsCacheLocalSlots
+#define _h_SLOTS_EjsCacheLocalSlots 1
+
+
+/*
+   Slots for the "ejs.cache.local" module 
+ */
+
+/*
+   Prototype (instance) slots for "global" type 
+ */
+
+/*
+    Local slots for global methods 
+ */
+#define ES_readFile_path                                               0
+#define ES_readFile_encoding                                           1
+#define ES_assert_condition                                            0
+#define ES_cloneBase_klass                                             0
+#define ES_dump_args                                                   0
+#define ES_dumpAll_args                                                0
+#define ES_dumpDef_args                                                0
+#define ES_md5_str                                                     0
+#define ES_blend_dest                                                  0
+#define ES_blend_src                                                   1
+#define ES_blend_overwrite                                             2
+#define ES_eval_script                                                 0
+#define ES_eval_cache                                                  1
+#define ES_hashcode_o                                                  0
+#define ES_isNaN_arg                                                   0
+#define ES_isFinite_arg                                                0
+#define ES_load_file                                                   0
+#define ES_load_options                                                1
+#define ES_print_args                                                  0
+#define ES_printf_fmt                                                  0
+#define ES_printf_args                                                 1
+#define ES_parse_str                                                   0
+#define ES_parse_preferredType                                         1
+#define ES_parseFloat_str                                              0
+#define ES_parseInt_str                                                0
+#define ES_parseInt_radix                                              1
+#define ES_printHash_name                                              0
+#define ES_printHash_o                                                 1
+#define ES_instanceOf_obj                                              0
+#define ES_instanceOf_target                                           1
+#define ES_toOrdinal_number                                            0
+#define ES_toPlural_word                                               0
+#define ES_toPlural_count                                              1
+#define ES_toSingular_word                                             0
+#define ES_deserialize_str                                             0
+#define ES_serialize_obj                                               0
+#define ES_serialize_options                                           1
+#define ES_require_id                                                  0
+#define ES_typeOf_o                                                    0
+#define ES_setInterval_callback                                        0
+#define ES_setInterval_delay                                           1
+#define ES_setInterval_args                                            2
+#define ES_clearInterval_timer                                         0
+#define ES_setTimeout_callback                                         0
+#define ES_setTimeout_delay                                            1
+#define ES_setTimeout_args                                             2
+#define ES_clearTimeout_timer                                          0
+#define ES_decodeURI_str                                               0
+#define ES_decodeURIComponent_str                                      0
+#define ES_encodeURI_str                                               0
+#define ES_encodeURIComponent_str                                      0
+#define ES_encodeObjects_items                                         0
+#define ES_ejs_worker_postMessage_data                                 0
+#define ES_ejs_worker_postMessage_ports                                1
+
+
+/*
+    Class property slots for the "LocalCache" type 
+ */
+#define ES_ejs_cache_local_LocalCache_NUM_CLASS_PROP                   0
+
+/*
+   Prototype (instance) slots for "LocalCache" type 
+ */
+#define ES_ejs_cache_local_LocalCache_destroy                          0
+#define ES_ejs_cache_local_LocalCache_expire                           1
+#define ES_ejs_cache_local_LocalCache_inc                              2
+#define ES_ejs_cache_local_LocalCache_limits                           3
+#define ES_ejs_cache_local_LocalCache_read                             4
+#define ES_ejs_cache_local_LocalCache_remove                           5
+#define ES_ejs_cache_local_LocalCache_setLimits                        6
+#define ES_ejs_cache_local_LocalCache_write                            7
+#define ES_ejs_cache_local_LocalCache_NUM_INSTANCE_PROP                8
+#define ES_ejs_cache_local_LocalCache_NUM_INHERITED_PROP               0
+
+#define _ES_CHECKSUM_ejs_cache_local   16538
+
+#endif
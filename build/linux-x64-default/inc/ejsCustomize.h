@@ -0,0 +1,12 @@
+/*
+    customize.h -- Place to override standard product defintions
+ */
+
+#ifndef _h_CUSTOMIZE_h
+#define _h_CUSTOMIZE_h 1
+
+/*
+    Override definitions here. This file is included after all other headers are parsed.
+ */
+
+#endif /* _h_CUSTOMIZE_h */
@@ -173,6 +173,7 @@ clean:
 	rm -f "$(BUILD)/obj/ejsPot.o"
 	rm -f "$(BUILD)/obj/ejsRegExp.o"
 	rm -f "$(BUILD)/obj/ejsRequest.o"
+	rm -f "$(BUILD)/obj/ejsRouter.o"
 	rm -f "$(BUILD)/obj/ejsScope.o"
 	rm -f "$(BUILD)/obj/ejsService.o"
 	rm -f "$(BUILD)/obj/ejsSession.o"
@@ -184,6 +185,7 @@ clean:
 	rm -f "$(BUILD)/obj/ejsType.o"
 	rm -f "$(BUILD)/obj/ejsUri.o"
 	rm -f "$(BUILD)/obj/ejsVoid.o"
+	rm -f "$(BUILD)/obj/ejsVMPool.o"
 	rm -f "$(BUILD)/obj/ejsWeb.o"
 	rm -f "$(BUILD)/obj/ejsWebSocket.o"
 	rm -f "$(BUILD)/obj/ejsWorker.o"
@@ -1032,6 +1034,14 @@ $(BUILD)/obj/ejsRequest.o: \
 	@echo '   [Compile] $(BUILD)/obj/ejsRequest.o'
 	$(CC) -c -o $(BUILD)/obj/ejsRequest.o $(LDFLAGS) $(DFLAGS) -D_FILE_OFFSET_BITS=64 -DMBEDTLS_USER_CONFIG_FILE=\"embedtls.h\" $(IFLAGS) src/ejs.web/ejsRequest.c
 
+#
+#   ejsRouter.o
+#
+$(BUILD)/obj/ejsRouter.o: \
+    src/ejs.web/ejsRouter.c $(DEPS_82)
+	@echo '   [Compile] $(BUILD)/obj/ejsRouter.o'
+	$(CC) -c -o $(BUILD)/obj/ejsRouter.o $(LDFLAGS) $(DFLAGS) -D_FILE_OFFSET_BITS=64 -DMBEDTLS_USER_CONFIG_FILE=\"embedtls.h\" $(IFLAGS) src/ejs.web/ejsRouter.c
+
 #
 #   ejsScope.o
 #
@@ -1146,6 +1156,14 @@ $(BUILD)/obj/ejsVoid.o: \
 	@echo '   [Compile] $(BUILD)/obj/ejsVoid.o'
 	$(CC) -c -o $(BUILD)/obj/ejsVoid.o $(LDFLAGS) $(DFLAGS) -D_FILE_OFFSET_BITS=64 -DMBEDTLS_USER_CONFIG_FILE=\"embedtls.h\" $(IFLAGS) src/core/src/ejsVoid.c
 
+#
+#   ejsVMPool.o
+#
+$(BUILD)/obj/ejsVMPool.o: \
+    src/ejs.web/ejsVMPool.c $(DEPS_82)
+	@echo '   [Compile] $(BUILD)/obj/ejsVMPool.o'
+	$(CC) -c -o $(BUILD)/obj/ejsVMPool.o $(LDFLAGS) $(DFLAGS) -D_FILE_OFFSET_BITS=64 -DMBEDTLS_USER_CONFIG_FILE=\"embedtls.h\" $(IFLAGS) src/ejs.web/ejsVMPool.c
+
 #
 #   ejsWeb.o
 #
@@ -1273,6 +1291,7 @@ $(BUILD)/obj/http.o: \
 #
 DEPS_106 += src/http/http.h
 DEPS_106 += $(BUILD)/inc/pcre.h
+DEPS_106 += $(BUILD)/inc/zlib.h
 
 $(BUILD)/obj/httpLib.o: \
     src/http/httpLib.c $(DEPS_106)
@@ -1512,6 +1531,9 @@ DEPS_129 += $(BUILD)/bin/libmpr.a
 ifeq ($(ME_COM_PCRE),1)
     DEPS_129 += $(BUILD)/bin/libpcre.a
 endif
+ifeq ($(ME_COM_ZLIB),1)
+    DEPS_129 += $(BUILD)/bin/libzlib.a
+endif
 DEPS_129 += $(BUILD)/inc/http.h
 DEPS_129 += $(BUILD)/obj/httpLib.o
 
@@ -1629,6 +1651,9 @@ endif
 ifeq ($(ME_COM_HTTP),1)
     LIBS_131 += -lhttp
 endif
+ifeq ($(ME_COM_ZLIB),1)
+    LIBS_131 += -lzlib
+endif
 ifeq ($(ME_COM_PCRE),1)
     LIBS_131 += -lpcre
 endif
@@ -1637,6 +1662,9 @@ LIBS_131 += -lejs
 ifeq ($(ME_COM_HTTP),1)
     LIBS_131 += -lhttp
 endif
+ifeq ($(ME_COM_ZLIB),1)
+    LIBS_131 += -lzlib
+endif
 
 $(BUILD)/bin/ejs: $(DEPS_131)
 	@echo '      [Link] $(BUILD)/bin/ejs'
@@ -1670,6 +1698,9 @@ endif
 ifeq ($(ME_COM_HTTP),1)
     LIBS_132 += -lhttp
 endif
+ifeq ($(ME_COM_ZLIB),1)
+    LIBS_132 += -lzlib
+endif
 ifeq ($(ME_COM_PCRE),1)
     LIBS_132 += -lpcre
 endif
@@ -1678,6 +1709,9 @@ LIBS_132 += -lejs
 ifeq ($(ME_COM_HTTP),1)
     LIBS_132 += -lhttp
 endif
+ifeq ($(ME_COM_ZLIB),1)
+    LIBS_132 += -lzlib
+endif
 
 $(BUILD)/bin/ejsc: $(DEPS_132)
 	@echo '      [Link] $(BUILD)/bin/ejsc'
@@ -1716,6 +1750,9 @@ endif
 ifeq ($(ME_COM_HTTP),1)
     LIBS_133 += -lhttp
 endif
+ifeq ($(ME_COM_ZLIB),1)
+    LIBS_133 += -lzlib
+endif
 ifeq ($(ME_COM_PCRE),1)
     LIBS_133 += -lpcre
 endif
@@ -1724,6 +1761,9 @@ LIBS_133 += -lejs
 ifeq ($(ME_COM_HTTP),1)
     LIBS_133 += -lhttp
 endif
+ifeq ($(ME_COM_ZLIB),1)
+    LIBS_133 += -lzlib
+endif
 
 $(BUILD)/bin/ejsmod: $(DEPS_133)
 	@echo '      [Link] $(BUILD)/bin/ejsmod'
@@ -1881,6 +1921,7 @@ DEPS_139 += src/ejs.web/Template.es
 DEPS_139 += src/ejs.web/UploadFile.es
 DEPS_139 += src/ejs.web/UrlMap.es
 DEPS_139 += src/ejs.web/Utils.es
+DEPS_139 += src/ejs.web/VMPool.es
 DEPS_139 += src/ejs.web/View.es
 DEPS_139 += $(BUILD)/bin/ejsc
 DEPS_139 += $(BUILD)/bin/ejsmod
@@ -1890,7 +1931,7 @@ $(BUILD)/bin/ejs.web.mod: $(DEPS_139)
 	( \
 	cd src/ejs.web; \
 	echo '   [Compile] ejs.web.mod' ; \
-	"../../$(BUILD)/bin/ejsc" --out "../../$(BUILD)/bin/ejs.web.mod"  --optimize 9 Cascade.es CommonLog.es ContentType.es Controller.es Dir.es Google.es Head.es Html.es HttpServer.es MethodOverride.es Middleware.es Mvc.es Request.es Router.es Script.es Session.es ShowExceptions.es Static.es Template.es UploadFile.es UrlMap.es Utils.es View.es ; \
+	"../../$(BUILD)/bin/ejsc" --out "../../$(BUILD)/bin/ejs.web.mod"  --optimize 9 Cascade.es CommonLog.es ContentType.es Controller.es Dir.es Google.es Head.es Html.es HttpServer.es MethodOverride.es Middleware.es Mvc.es Request.es Router.es Script.es Session.es ShowExceptions.es Static.es Template.es UploadFile.es UrlMap.es Utils.es VMPool.es View.es ; \
 	"../../$(BUILD)/bin/ejsmod" --cslots --dir "../../$(BUILD)/bin" "../../$(BUILD)/bin/ejs.web.mod" ; \
 	)
 
@@ -2024,6 +2065,9 @@ endif
 ifeq ($(ME_COM_HTTP),1)
     LIBS_147 += -lhttp
 endif
+ifeq ($(ME_COM_ZLIB),1)
+    LIBS_147 += -lzlib
+endif
 ifeq ($(ME_COM_PCRE),1)
     LIBS_147 += -lpcre
 endif
@@ -2032,6 +2076,9 @@ LIBS_147 += -lejs
 ifeq ($(ME_COM_HTTP),1)
     LIBS_147 += -lhttp
 endif
+ifeq ($(ME_COM_ZLIB),1)
+    LIBS_147 += -lzlib
+endif
 
 $(BUILD)/bin/ejsrun: $(DEPS_147)
 	@echo '      [Link] $(BUILD)/bin/ejsrun'
@@ -2064,6 +2111,9 @@ ifeq ($(ME_COM_PCRE),1)
     LIBS_148 += -lpcre
 endif
 LIBS_148 += -lhttp
+ifeq ($(ME_COM_ZLIB),1)
+    LIBS_148 += -lzlib
+endif
 ifeq ($(ME_COM_PCRE),1)
     LIBS_148 += -lpcre
 endif
@@ -2137,12 +2187,14 @@ DEPS_152 += $(BUILD)/bin/ejs.mod
 DEPS_152 += $(BUILD)/inc/ejsWeb.h
 DEPS_152 += $(BUILD)/obj/ejsHttpServer.o
 DEPS_152 += $(BUILD)/obj/ejsRequest.o
+DEPS_152 += $(BUILD)/obj/ejsRouter.o
 DEPS_152 += $(BUILD)/obj/ejsSession.o
+DEPS_152 += $(BUILD)/obj/ejsVMPool.o
 DEPS_152 += $(BUILD)/obj/ejsWeb.o
 
 $(BUILD)/bin/libejs.web.a: $(DEPS_152)
 	@echo '      [Link] $(BUILD)/bin/libejs.web.a'
-	ar -cr $(BUILD)/bin/libejs.web.a "$(BUILD)/obj/ejsHttpServer.o" "$(BUILD)/obj/ejsRequest.o" "$(BUILD)/obj/ejsSession.o" "$(BUILD)/obj/ejsWeb.o"
+	ar -cr $(BUILD)/bin/libejs.web.a "$(BUILD)/obj/ejsHttpServer.o" "$(BUILD)/obj/ejsRequest.o" "$(BUILD)/obj/ejsRouter.o" "$(BUILD)/obj/ejsSession.o" "$(BUILD)/obj/ejsVMPool.o" "$(BUILD)/obj/ejsWeb.o"
 
 #
 #   mvc.es
@@ -2183,6 +2235,9 @@ endif
 ifeq ($(ME_COM_HTTP),1)
     LIBS_154 += -lhttp
 endif
+ifeq ($(ME_COM_ZLIB),1)
+    LIBS_154 += -lzlib
+endif
 ifeq ($(ME_COM_PCRE),1)
     LIBS_154 += -lpcre
 endif
@@ -2191,6 +2246,9 @@ LIBS_154 += -lejs
 ifeq ($(ME_COM_HTTP),1)
     LIBS_154 += -lhttp
 endif
+ifeq ($(ME_COM_ZLIB),1)
+    LIBS_154 += -lzlib
+endif
 
 $(BUILD)/bin/mvc: $(DEPS_154)
 	@echo '      [Link] $(BUILD)/bin/mvc'
@@ -2246,6 +2304,9 @@ endif
 ifeq ($(ME_COM_HTTP),1)
     LIBS_157 += -lhttp
 endif
+ifeq ($(ME_COM_ZLIB),1)
+    LIBS_157 += -lzlib
+endif
 ifeq ($(ME_COM_PCRE),1)
     LIBS_157 += -lpcre
 endif
@@ -2254,6 +2315,9 @@ LIBS_157 += -lejs
 ifeq ($(ME_COM_HTTP),1)
     LIBS_157 += -lhttp
 endif
+ifeq ($(ME_COM_ZLIB),1)
+    LIBS_157 += -lzlib
+endif
 
 $(BUILD)/bin/utest: $(DEPS_157)
 	@echo '      [Link] $(BUILD)/bin/utest'
@@ -173,6 +173,7 @@ clean:
 	rm -f "$(BUILD)/obj/ejsPot.o"
 	rm -f "$(BUILD)/obj/ejsRegExp.o"
 	rm -f "$(BUILD)/obj/ejsRequest.o"
+	rm -f "$(BUILD)/obj/ejsRouter.o"
 	rm -f "$(BUILD)/obj/ejsScope.o"
 	rm -f "$(BUILD)/obj/ejsService.o"
 	rm -f "$(BUILD)/obj/ejsSession.o"
@@ -184,6 +185,7 @@ clean:
 	rm -f "$(BUILD)/obj/ejsType.o"
 	rm -f "$(BUILD)/obj/ejsUri.o"
 	rm -f "$(BUILD)/obj/ejsVoid.o"
+	rm -f "$(BUILD)/obj/ejsVMPool.o"
 	rm -f "$(BUILD)/obj/ejsWeb.o"
 	rm -f "$(BUILD)/obj/ejsWebSocket.o"
 	rm -f "$(BUILD)/obj/ejsWorker.o"
@@ -1032,6 +1034,14 @@ $(BUILD)/obj/ejsRequest.o: \
 	@echo '   [Compile] $(BUILD)/obj/ejsRequest.o'
 	$(CC) -c -o $(BUILD)/obj/ejsRequest.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) -D_FILE_OFFSET_BITS=64 -DMBEDTLS_USER_CONFIG_FILE=\"embedtls.h\" $(IFLAGS) src/ejs.web/ejsRequest.c
 
+#
+#   ejsRouter.o
+#
+$(BUILD)/obj/ejsRouter.o: \
+    src/ejs.web/ejsRouter.c $(DEPS_82)
+	@echo '   [Compile] $(BUILD)/obj/ejsRouter.o'
+	$(CC) -c -o $(BUILD)/obj/ejsRouter.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) -D_FILE_OFFSET_BITS=64 -DMBEDTLS_USER_CONFIG_FILE=\"embedtls.h\" $(IFLAGS) src/ejs.web/ejsRouter.c
+
 #
 #   ejsScope.o
 #
@@ -1146,6 +1156,14 @@ $(BUILD)/obj/ejsVoid.o: \
 	@echo '   [Compile] $(BUILD)/obj/ejsVoid.o'
 	$(CC) -c -o $(BUILD)/obj/ejsVoid.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) -D_FILE_OFFSET_BITS=64 -DMBEDTLS_USER_CONFIG_FILE=\"embedtls.h\" $(IFLAGS) src/core/src/ejsVoid.c
 
+#
+#   ejsVMPool.o
+#
+$(BUILD)/obj/ejsVMPool.o: \
+    src/ejs.web/ejsVMPool.c $(DEPS_82)
+	@echo '   [Compile] $(BUILD)/obj/ejsVMPool.o'
+	$(CC) -c -o $(BUILD)/obj/ejsVMPool.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) -D_FILE_OFFSET_BITS=64 -DMBEDTLS_USER_CONFIG_FILE=\"embedtls.h\" $(IFLAGS) src/ejs.web/ejsVMPool.c
+
 #
 #   ejsWeb.o
 #
@@ -1273,6 +1291,7 @@ $(BUILD)/obj/http.o: \
 #
 DEPS_106 += src/http/http.h
 DEPS_106 += $(BUILD)/inc/pcre.h
+DEPS_106 += $(BUILD)/inc/zlib.h
 
 $(BUILD)/obj/httpLib.o: \
     src/http/httpLib.c $(DEPS_106)
@@ -1528,6 +1547,9 @@ DEPS_129 += $(BUILD)/bin/libmpr.dylib
 ifeq ($(ME_COM_PCRE),1)
     DEPS_129 += $(BUILD)/bin/libpcre.dylib
 endif
+ifeq ($(ME_COM_ZLIB),1)
+    DEPS_129 += $(BUILD)/bin/libzlib.dylib
+endif
 DEPS_129 += $(BUILD)/inc/http.h
 DEPS_129 += $(BUILD)/obj/httpLib.o
 
@@ -1553,6 +1575,9 @@ endif
 ifeq ($(ME_COM_PCRE),1)
     LIBS_129 += -lpcre
 endif
+ifeq ($(ME_COM_ZLIB),1)
+    LIBS_129 += -lzlib
+endif
 LIBS_129 += -lmpr
 
 $(BUILD)/bin/libhttp.dylib: $(DEPS_129)
@@ -1951,6 +1976,7 @@ DEPS_139 += src/ejs.web/Template.es
 DEPS_139 += src/ejs.web/UploadFile.es
 DEPS_139 += src/ejs.web/UrlMap.es
 DEPS_139 += src/ejs.web/Utils.es
+DEPS_139 += src/ejs.web/VMPool.es
 DEPS_139 += src/ejs.web/View.es
 DEPS_139 += $(BUILD)/bin/ejsc
 DEPS_139 += $(BUILD)/bin/ejsmod
@@ -1960,7 +1986,7 @@ $(BUILD)/bin/ejs.web.mod: $(DEPS_139)
 	( \
 	cd src/ejs.web; \
 	echo '   [Compile] ejs.web.mod' ; \
-	"../../$(BUILD)/bin/ejsc" --out "../../$(BUILD)/bin/ejs.web.mod"  --optimize 9 Cascade.es CommonLog.es ContentType.es Controller.es Dir.es Google.es Head.es Html.es HttpServer.es MethodOverride.es Middleware.es Mvc.es Request.es Router.es Script.es Session.es ShowExceptions.es Static.es Template.es UploadFile.es UrlMap.es Utils.es View.es ; \
+	"../../$(BUILD)/bin/ejsc" --out "../../$(BUILD)/bin/ejs.web.mod"  --optimize 9 Cascade.es CommonLog.es ContentType.es Controller.es Dir.es Google.es Head.es Html.es HttpServer.es MethodOverride.es Middleware.es Mvc.es Request.es Router.es Script.es Session.es ShowExceptions.es Static.es Template.es UploadFile.es UrlMap.es Utils.es VMPool.es View.es ; \
 	"../../$(BUILD)/bin/ejsmod" --cslots --dir "../../$(BUILD)/bin" "../../$(BUILD)/bin/ejs.web.mod" ; \
 	)
 
@@ -2283,7 +2309,9 @@ DEPS_152 += $(BUILD)/bin/ejs.mod
 DEPS_152 += $(BUILD)/inc/ejsWeb.h
 DEPS_152 += $(BUILD)/obj/ejsHttpServer.o
 DEPS_152 += $(BUILD)/obj/ejsRequest.o
+DEPS_152 += $(BUILD)/obj/ejsRouter.o
 DEPS_152 += $(BUILD)/obj/ejsSession.o
+DEPS_152 += $(BUILD)/obj/ejsVMPool.o
 DEPS_152 += $(BUILD)/obj/ejsWeb.o
 
 ifeq ($(ME_COM_MBEDTLS),1)
@@ -2320,7 +2348,7 @@ LIBS_152 += -lejs
 
 $(BUILD)/bin/libejs.web.dylib: $(DEPS_152)
 	@echo '      [Link] $(BUILD)/bin/libejs.web.dylib'
-	$(CC) -dynamiclib -o $(BUILD)/bin/libejs.web.dylib -arch $(CC_ARCH) $(LDFLAGS) $(LIBPATHS) -install_name @rpath/libejs.web.dylib -compatibility_version 2.7 -current_version 2.7 "$(BUILD)/obj/ejsHttpServer.o" "$(BUILD)/obj/ejsRequest.o" "$(BUILD)/obj/ejsSession.o" "$(BUILD)/obj/ejsWeb.o" $(LIBPATHS_152) $(LIBS_152) $(LIBS_152) $(LIBS) -lpam 
+	$(CC) -dynamiclib -o $(BUILD)/bin/libejs.web.dylib -arch $(CC_ARCH) $(LDFLAGS) $(LIBPATHS) -install_name @rpath/libejs.web.dylib -compatibility_version 2.7 -current_version 2.7 "$(BUILD)/obj/ejsHttpServer.o" "$(BUILD)/obj/ejsRequest.o" "$(BUILD)/obj/ejsRouter.o" "$(BUILD)/obj/ejsSession.o" "$(BUILD)/obj/ejsVMPool.o" "$(BUILD)/obj/ejsWeb.o" $(LIBPATHS_152) $(LIBS_152) $(LIBS_152) $(LIBS) -lpam 
 
 #
 #   mvc.es
@@ -182,6 +182,7 @@ clean:
 	rm -f "$(BUILD)/obj/ejsPot.o"
 	rm -f "$(BUILD)/obj/ejsRegExp.o"
 	rm -f "$(BUILD)/obj/ejsRequest.o"
+	rm -f "$(BUILD)/obj/ejsRouter.o"
 	rm -f "$(BUILD)/obj/ejsScope.o"
 	rm -f "$(BUILD)/obj/ejsService.o"
 	rm -f "$(BUILD)/obj/ejsSession.o"
@@ -193,6 +194,7 @@ clean:
 	rm -f "$(BUILD)/obj/ejsType.o"
 	rm -f "$(BUILD)/obj/ejsUri.o"
 	rm -f "$(BUILD)/obj/ejsVoid.o"
+	rm -f "$(BUILD)/obj/ejsVMPool.o"
 	rm -f "$(BUILD)/obj/ejsWeb.o"
 	rm -f "$(BUILD)/obj/ejsWebSocket.o"
 	rm -f "$(BUILD)/obj/ejsWorker.o"
@@ -1041,6 +1043,14 @@ $(BUILD)/obj/ejsRequest.o: \
 	@echo '   [Compile] $(BUILD)/obj/ejsRequest.o'
 	$(CC) -c -o $(BUILD)/obj/ejsRequest.o $(CFLAGS) -DME_DEBUG=1 -DVXWORKS -DRW_MULTI_THREAD -DCPU=PENTIUM -DTOOL_FAMILY=gnu -DTOOL=gnu -D_GNU_TOOL -D_WRS_KERNEL_ -D_VSB_CONFIG_FILE=\"/WindRiver/vxworks-7/samples/prebuilt_projects/vsb_vxsim_linux/h/config/vsbConfig.h\" -D_FILE_OFFSET_BITS=64 -DMBEDTLS_USER_CONFIG_FILE=\"embedtls.h\" $(IFLAGS) src/ejs.web/ejsRequest.c
 
+#
+#   ejsRouter.o
+#
+$(BUILD)/obj/ejsRouter.o: \
+    src/ejs.web/ejsRouter.c $(DEPS_82)
+	@echo '   [Compile] $(BUILD)/obj/ejsRouter.o'
+	$(CC) -c -o $(BUILD)/obj/ejsRouter.o $(CFLAGS) -DME_DEBUG=1 -DVXWORKS -DRW_MULTI_THREAD -DCPU=PENTIUM -DTOOL_FAMILY=gnu -DTOOL=gnu -D_GNU_TOOL -D_WRS_KERNEL_ -D_VSB_CONFIG_FILE=\"/WindRiver/vxworks-7/samples/prebuilt_projects/vsb_vxsim_linux/h/config/vsbConfig.h\" -D_FILE_OFFSET_BITS=64 -DMBEDTLS_USER_CONFIG_FILE=\"embedtls.h\" $(IFLAGS) src/ejs.web/ejsRouter.c
+
 #
 #   ejsScope.o
 #
@@ -1155,6 +1165,14 @@ $(BUILD)/obj/ejsVoid.o: \
 	@echo '   [Compile] $(BUILD)/obj/ejsVoid.o'
 	$(CC) -c -o $(BUILD)/obj/ejsVoid.o $(CFLAGS) -DME_DEBUG=1 -DVXWORKS -DRW_MULTI_THREAD -DCPU=PENTIUM -DTOOL_FAMILY=gnu -DTOOL=gnu -D_GNU_TOOL -D_WRS_KERNEL_ -D_VSB_CONFIG_FILE=\"/WindRiver/vxworks-7/samples/prebuilt_projects/vsb_vxsim_linux/h/config/vsbConfig.h\" -D_FILE_OFFSET_BITS=64 -DMBEDTLS_USER_CONFIG_FILE=\"embedtls.h\" $(IFLAGS) src/core/src/ejsVoid.c
 
+#
+#   ejsVMPool.o
+#
+$(BUILD)/obj/ejsVMPool.o: \
+    src/ejs.web/ejsVMPool.c $(DEPS_82)
+	@echo '   [Compile] $(BUILD)/obj/ejsVMPool.o'
+	$(CC) -c -o $(BUILD)/obj/ejsVMPool.o $(CFLAGS) -DME_DEBUG=1 -DVXWORKS -DRW_MULTI_THREAD -DCPU=PENTIUM -DTOOL_FAMILY=gnu -DTOOL=gnu -D_GNU_TOOL -D_WRS_KERNEL_ -D_VSB_CONFIG_FILE=\"/WindRiver/vxworks-7/samples/prebuilt_projects/vsb_vxsim_linux/h/config/vsbConfig.h\" -D_FILE_OFFSET_BITS=64 -DMBEDTLS_USER_CONFIG_FILE=\"embedtls.h\" $(IFLAGS) src/ejs.web/ejsVMPool.c
+
 #
 #   ejsWeb.o
 #
@@ -1282,6 +1300,7 @@ $(BUILD)/obj/http.o: \
 #
 DEPS_106 += src/http/http.h
 DEPS_106 += $(BUILD)/inc/pcre.h
+DEPS_106 += $(BUILD)/inc/zlib.h
 
 $(BUILD)/obj/httpLib.o: \
     src/http/httpLib.c $(DEPS_106)
@@ -1521,6 +1540,9 @@ DEPS_129 += $(BUILD)/bin/libmpr.a
 ifeq ($(ME_COM_PCRE),1)
     DEPS_129 += $(BUILD)/bin/libpcre.a
 endif
+ifeq ($(ME_COM_ZLIB),1)
+    DEPS_129 += $(BUILD)/bin/libzlib.a
+endif
 DEPS_129 += $(BUILD)/inc/http.h
 DEPS_129 += $(BUILD)/obj/httpLib.o
 
@@ -1638,6 +1660,9 @@ endif
 ifeq ($(ME_COM_HTTP),1)
     LIBS_131 += -lhttp
 endif
+ifeq ($(ME_COM_ZLIB),1)
+    LIBS_131 += -lzlib
+endif
 ifeq ($(ME_COM_PCRE),1)
     LIBS_131 += -lpcre
 endif
@@ -1646,6 +1671,9 @@ LIBS_131 += -lejs
 ifeq ($(ME_COM_HTTP),1)
     LIBS_131 += -lhttp
 endif
+ifeq ($(ME_COM_ZLIB),1)
+    LIBS_131 += -lzlib
+endif
 
 $(BUILD)/bin/ejs.out: $(DEPS_131)
 	@echo '      [Link] $(BUILD)/bin/ejs.out'
@@ -1679,6 +1707,9 @@ endif
 ifeq ($(ME_COM_HTTP),1)
     LIBS_132 += -lhttp
 endif
+ifeq ($(ME_COM_ZLIB),1)
+    LIBS_132 += -lzlib
+endif
 ifeq ($(ME_COM_PCRE),1)
     LIBS_132 += -lpcre
 endif
@@ -1687,6 +1718,9 @@ LIBS_132 += -lejs
 ifeq ($(ME_COM_HTTP),1)
     LIBS_132 += -lhttp
 endif
+ifeq ($(ME_COM_ZLIB),1)
+    LIBS_132 += -lzlib
+endif
 
 $(BUILD)/bin/ejsc.out: $(DEPS_132)
 	@echo '      [Link] $(BUILD)/bin/ejsc.out'
@@ -1725,6 +1759,9 @@ endif
 ifeq ($(ME_COM_HTTP),1)
     LIBS_133 += -lhttp
 endif
+ifeq ($(ME_COM_ZLIB),1)
+    LIBS_133 += -lzlib
+endif
 ifeq ($(ME_COM_PCRE),1)
     LIBS_133 += -lpcre
 endif
@@ -1733,6 +1770,9 @@ LIBS_133 += -lejs
 ifeq ($(ME_COM_HTTP),1)
     LIBS_133 += -lhttp
 endif
+ifeq ($(ME_COM_ZLIB),1)
+    LIBS_133 += -lzlib
+endif
 
 $(BUILD)/bin/ejsmod.out: $(DEPS_133)
 	@echo '      [Link] $(BUILD)/bin/ejsmod.out'
@@ -1890,6 +1930,7 @@ DEPS_139 += src/ejs.web/Template.es
 DEPS_139 += src/ejs.web/UploadFile.es
 DEPS_139 += src/ejs.web/UrlMap.es
 DEPS_139 += src/ejs.web/Utils.es
+DEPS_139 += src/ejs.web/VMPool.es
 DEPS_139 += src/ejs.web/View.es
 DEPS_139 += $(BUILD)/bin/ejsc.out
 DEPS_139 += $(BUILD)/bin/ejsmod.out
@@ -1899,7 +1940,7 @@ $(BUILD)/bin/ejs.web.mod: $(DEPS_139)
 	( \
 	cd src/ejs.web; \
 	echo '   [Compile] ejs.web.mod' ; \
-	"../../$(BUILD)/bin/ejsc" --out "../../$(BUILD)/bin/ejs.web.mod"  --optimize 9 Cascade.es CommonLog.es ContentType.es Controller.es Dir.es Google.es Head.es Html.es HttpServer.es MethodOverride.es Middleware.es Mvc.es Request.es Router.es Script.es Session.es ShowExceptions.es Static.es Template.es UploadFile.es UrlMap.es Utils.es View.es ; \
+	"../../$(BUILD)/bin/ejsc" --out "../../$(BUILD)/bin/ejs.web.mod"  --optimize 9 Cascade.es CommonLog.es ContentType.es Controller.es Dir.es Google.es Head.es Html.es HttpServer.es MethodOverride.es Middleware.es Mvc.es Request.es Router.es Script.es Session.es ShowExceptions.es Static.es Template.es UploadFile.es UrlMap.es Utils.es VMPool.es View.es ; \
 	"../../$(BUILD)/bin/ejsmod" --cslots --dir "../../$(BUILD)/bin" "../../$(BUILD)/bin/ejs.web.mod" ; \
 	)
 
@@ -2033,6 +2074,9 @@ endif
 ifeq ($(ME_COM_HTTP),1)
     LIBS_147 += -lhttp
 endif
+ifeq ($(ME_COM_ZLIB),1)
+    LIBS_147 += -lzlib
+endif
 ifeq ($(ME_COM_PCRE),1)
     LIBS_147 += -lpcre
 endif
@@ -2041,6 +2085,9 @@ LIBS_147 += -lejs
 ifeq ($(ME_COM_HTTP),1)
     LIBS_147 += -lhttp
 endif
+ifeq ($(ME_COM_ZLIB),1)
+    LIBS_147 += -lzlib
+endif
 
 $(BUILD)/bin/ejsrun.out: $(DEPS_147)
 	@echo '      [Link] $(BUILD)/bin/ejsrun.out'
@@ -2073,6 +2120,9 @@ ifeq ($(ME_COM_PCRE),1)
     LIBS_148 += -lpcre
 endif
 LIBS_148 += -lhttp
+ifeq ($(ME_COM_ZLIB),1)
+    LIBS_148 += -lzlib
+endif
 ifeq ($(ME_COM_PCRE),1)
     LIBS_148 += -lpcre
 endif
@@ -2146,12 +2196,14 @@ DEPS_152 += $(BUILD)/bin/ejs.mod
 DEPS_152 += $(BUILD)/inc/ejsWeb.h
 DEPS_152 += $(BUILD)/obj/ejsHttpServer.o
 DEPS_152 += $(BUILD)/obj/ejsRequest.o
+DEPS_152 += $(BUILD)/obj/ejsRouter.o
 DEPS_152 += $(BUILD)/obj/ejsSession.o
+DEPS_152 += $(BUILD)/obj/ejsVMPool.o
 DEPS_152 += $(BUILD)/obj/ejsWeb.o
 
 $(BUILD)/bin/libejs.web.a: $(DEPS_152)
 	@echo '      [Link] $(BUILD)/bin/libejs.web.a'
-	arundefined -cr $(BUILD)/bin/libejs.web.a "$(BUILD)/obj/ejsHttpServer.o" "$(BUILD)/obj/ejsRequest.o" "$(BUILD)/obj/ejsSession.o" "$(BUILD)/obj/ejsWeb.o"
+	arundefined -cr $(BUILD)/bin/libejs.web.a "$(BUILD)/obj/ejsHttpServer.o" "$(BUILD)/obj/ejsRequest.o" "$(BUILD)/obj/ejsRouter.o" "$(BUILD)/obj/ejsSession.o" "$(BUILD)/obj/ejsVMPool.o" "$(BUILD)/obj/ejsWeb.o"
 
 #
 #   mvc.es
@@ -2192,6 +2244,9 @@ endif
 ifeq ($(ME_COM_HTTP),1)
     LIBS_154 += -lhttp
 endif
+ifeq ($(ME_COM_ZLIB),1)
+    LIBS_154 += -lzlib
+endif
 ifeq ($(ME_COM_PCRE),1)
     LIBS_154 += -lpcre
 endif
@@ -2200,6 +2255,9 @@ LIBS_154 += -lejs
 ifeq ($(ME_COM_HTTP),1)
     LIBS_154 += -lhttp
 endif
+ifeq ($(ME_COM_ZLIB),1)
+    LIBS_154 += -lzlib
+endif
 
 $(BUILD)/bin/mvc.out: $(DEPS_154)
 	@echo '      [Link] $(BUILD)/bin/mvc.out'
@@ -2255,6 +2313,9 @@ endif
 ifeq ($(ME_COM_HTTP),1)
     LIBS_157 += -lhttp
 endif
+ifeq ($(ME_COM_ZLIB),1)
+    LIBS_157 += -lzlib
+endif
 ifeq ($(ME_COM_PCRE),1)
     LIBS_157 += -lpcre
 endif
@@ -2263,6 +2324,9 @@ LIBS_157 += -lejs
 ifeq ($(ME_COM_HTTP),1)
     LIBS_157 += -lhttp
 endif
+ifeq ($(ME_COM_ZLIB),1)
+    LIBS_157 += -lzlib
+endif
 
 $(BUILD)/bin/utest.out: $(DEPS_157)
 	@echo '      [Link] $(BUILD)/bin/utest.out'
@@ -480,9 +480,9 @@ static int decodeOperands(EjsMod *mp, EjsOptable *opt, char *argbuf, int argbufL
     EjsString   *sval;
     int         *argp;
     char        *bufp;
-    uchar       *start;
+    uchar       *start, *pc;
     double      dval;
-    int         i, argc, ival, len, buflen, j, numEntries;
+    int         i, argc, ival, len, buflen, j, numEntries, end;
 
     *stackEffect = opt->stackEffect;
 
@@ -556,6 +556,11 @@ static int decodeOperands(EjsMod *mp, EjsOptable *opt, char *argbuf, int argbufL
             fmt(bufp, buflen,  "<%d> ", ival);
             break;
 
+        case EBC_SITE:
+            ival = getInt32(mp);
+            fmt(bufp, buflen,  "<site: %d> ", ival);
+            break;
+
         case EBC_JMP8:
             ival = getByte(mp);
             fmt(bufp, buflen,  "<addr: %d> ", ((char) ival) + address + 1);
@@ -596,6 +601,54 @@ static int decodeOperands(EjsMod *mp, EjsOptable *opt, char *argbuf, int argbufL
             }
             break;
 
+        case EBC_SWITCH_TABLE:
+            ival = (int) getNum(mp);
+            numEntries = (int) getNum(mp);
+            fmt(bufp, buflen,  "<min: %d> <%d> ", ival, numEntries);
+            end = address + (int) (mp->pc - start) + (numEntries + 1) * 4;
+            for (j = 0; j <= numEntries; j++) {
+                len = (int) strlen(bufp);
+                bufp += len;
+                buflen -= len;
+                ival = getInt32(mp);
+                if (buflen > 32) {
+                    fmt(bufp, buflen,  (j < numEntries) ? "<addr: %d> " : "<default: %d> ", ival + end);
+                }
+            }
+            break;
+
+        case EBC_SWITCH_LOOKUP:
+            /*
+                String operands are variable length. Find the end of the table first.
+             */
+            pc = mp->pc;
+            numEntries = (int) ejsDecodeNum(mp->ejs, &pc);
+            for (j = 0; j < numEntries; j++) {
+                ejsDecodeNum(mp->ejs, &pc);
+                pc += 4;
+            }
+            end = address + (int) (pc + 4 - start);
+            numEntries = (int) getNum(mp);
+            fmt(bufp, buflen,  "<%d> ", numEntries);
+            for (j = 0; j < numEntries; j++) {
+                len = (int) strlen(bufp);
+                bufp += len;
+                buflen -= len;
+                sval = getString(mp->ejs, mp);
+                ival = getInt32(mp);
+                if (buflen > 32) {
+                    fmt(bufp, buflen,  "<%@: %d> ", sval, ival + end);
+                }
+            }
+            len = (int) strlen(bufp);
+            bufp += len;
+            buflen -= len;
+            ival = getInt32(mp);
+            if (buflen > 32) {
+                fmt(bufp, buflen,  "<default: %d> ", ival + end);
+            }
+            break;
+
         case EBC_STRING:
             sval = getString(mp->ejs, mp);
             assert(sval);
@@ -21,6 +21,17 @@
 #undef LEAVE
 #define LEAVE(cp) ecLeaveState(cp)
 
+/*
+    Variable definition tracked for constant propagation. Only const variables with a single definition and a literal
+    initializer are propagated to their references.
+ */
+typedef struct EcConstant {
+    EcNode      *var;                   /* First variable definition */
+    int         count;                  /* Count of definitions of the same property */
+    int         literal;                /* Definition is a const with a literal initializer */
+    int         active;                 /* Definition has been passed in source order */
+} EcConstant;
+
 /***************************** Forward Declarations ***************************/
 
 static void     addGlobalProperty(EcCompiler *cp, EcNode *np, EjsName *qname);
@@ -69,21 +80,31 @@ static void     astWith(EcCompiler *cp, EcNode *np);
 static void     badAst(EcCompiler *cp, EcNode *np);
 static void     bindVariableDefinition(EcCompiler *cp, EcNode *np);
 static void     closeBlock(EcCompiler *cp);
+static void     collectConstants(EcCompiler *cp, EcNode *np, MprList *constants);
 #if KEEP
 static EjsNamespace *createHoistNamespace(EcCompiler *cp, EjsObj *obj);
 #endif
 static EjsModule    *createModule(EcCompiler *cp, EcNode *np);
+static void     eliminateDeadCode(EcCompiler *cp, EcNode *np);
+static EcConstant *findConstant(MprList *constants, EjsLookup *lookup);
+static void     foldNode(EcCompiler *cp, EcNode *np);
 static EjsFunction *createModuleInitializer(EcCompiler *cp, EcNode *np, EjsModule *mp);
 static int      defineParameters(EcCompiler *cp, EcNode *np);
 static void     defineVar(EcCompiler *cp, EcNode *np, int varKind, EjsObj *value);
 static void     fixupClass(EcCompiler *cp, EjsType *type);
 static EjsBlock *getBlockForDefinition(EcCompiler *cp, EcNode *np, EjsBlock *block, int attributes);
+static EcNode   *getLiteral(EcNode *np);
+static int      getLinkedNodes(EcNode *np, EcNode **nodes);
 static EcNode   *getNextAstNode(EcCompiler *cp, EcNode *np, int *next);
 static EjsObj   *getTypeProperty(EcCompiler *cp, EjsObj *vp, EjsName name);
 #if KEEP
 static bool     hoistBlockVar(EcCompiler *cp, EcNode *np);
 #endif
+static bool     hasDefinitions(EcNode *np);
+static int      isTerminal(EcCompiler *cp, EcNode *np);
+static void     makeLiteral(EcNode *np, EjsAny *value);
 static void     openBlock(EcCompiler *cp, EcNode *np, EjsBlock *block);
+static void     optimizeNode(EcCompiler *cp, EcNode *np, MprList *constants);
 static void     processAstNode(EcCompiler *cp, EcNode *np);
 static void     removeProperty(EcCompiler *cp, EjsObj *block, EcNode *np);
 static EjsNamespace *resolveNamespace(EcCompiler *cp, EcNode *np, EjsAny *block, bool *modified);
@@ -171,6 +192,511 @@ PUBLIC int ecAstProcess(EcCompiler *cp)
 }
 
 
+/*
+    Optimize the AST before code generation. This folds constant expressions and string catenations, propagates
+    the values of const variables with literal initializers and removes unreachable statements. Must be called after
+    ecAstProcess so that names are bound.
+ */
+PUBLIC int ecAstOptimize(EcCompiler *cp)
+{
+    MprList     *constants;
+    int         i, count;
+
+    if (cp->optimizeLevel <= 0 || cp->errorCount > 0) {
+        return 0;
+    }
+    if ((constants = mprCreateList(0, 0)) == 0) {
+        return EJS_ERR;
+    }
+    /*
+        Nodes for loaded modules are null
+     */
+    count = mprGetListLength(cp->nodes);
+    for (i = 0; i < count; i++) {
+        collectConstants(cp, mprGetItem(cp->nodes, i), constants);
+    }
+    for (i = 0; i < count; i++) {
+        optimizeNode(cp, mprGetItem(cp->nodes, i), constants);
+    }
+    return (cp->errorCount > 0) ? EJS_ERR : 0;
+}
+
+
+/*
+    Get the nodes referenced by the node union that are not in the children list. Returns the count of nodes.
+ */
+static int getLinkedNodes(EcNode *np, EcNode **nodes)
+{
+    int     count;
+
+    count = 0;
+    switch (np->kind) {
+    case N_CASE_LABEL:
+        nodes[count++] = np->caseLabel.expression;
+        break;
+
+    case N_DO:
+        nodes[count++] = np->forLoop.body;
+        nodes[count++] = np->forLoop.cond;
+        break;
+
+    case N_FIELD:
+        nodes[count++] = np->field.expr;
+        break;
+
+    case N_FOR:
+        nodes[count++] = np->forLoop.initializer;
+        nodes[count++] = np->forLoop.cond;
+        nodes[count++] = np->forLoop.body;
+        nodes[count++] = np->forLoop.perLoop;
+        break;
+
+    case N_FOR_IN:
+        nodes[count++] = np->forInLoop.iterGet;
+        nodes[count++] = np->forInLoop.body;
+        break;
+
+    case N_FUNCTION:
+        nodes[count++] = np->function.body;
+        break;
+
+    case N_IF:
+        nodes[count++] = np->tenary.cond;
+        nodes[count++] = np->tenary.thenBlock;
+        nodes[count++] = np->tenary.elseBlock;
+        break;
+
+    case N_TRY:
+        nodes[count++] = np->exception.tryBlock;
+        nodes[count++] = np->exception.catchClauses;
+        nodes[count++] = np->exception.finallyBlock;
+        break;
+
+    case N_WITH:
+        nodes[count++] = np->with.object;
+        nodes[count++] = np->with.statement;
+        break;
+    }
+    return count;
+}
+
+
+/*
+    Find the variable definitions and count the definitions of each property
+ */
+static void collectConstants(EcCompiler *cp, EcNode *np, MprList *constants)
+{
+    EcConstant  *cn;
+    EcNode      *child, *linked[4];
+    int         next, i, count;
+
+    if (np == 0 || np->kind == N_HASH) {
+        return;
+    }
+    if (np->kind == N_VAR && np->lookup.obj && np->lookup.slotNum >= 0) {
+        if ((cn = findConstant(constants, &np->lookup)) != 0) {
+            cn->count++;
+
+        } else if ((cn = mprAllocStruct(EcConstant)) != 0) {
+            cn->var = np;
+            cn->count = 1;
+            cn->literal = (np->name.varKind & KIND_CONST) && !(np->attributes & EJS_PROP_NATIVE) &&
+                !np->name.isNamespace && !ejsIsPrototype(cp->ejs, np->lookup.obj) && np->left &&
+                np->left->kind == N_ASSIGN_OP && getLiteral(np->left->right);
+            mprAddItem(constants, cn);
+        }
+    }
+    for (next = 0; (child = getNextAstNode(cp, np, &next)) != 0; ) {
+        collectConstants(cp, child, constants);
+    }
+    count = getLinkedNodes(np, linked);
+    for (i = 0; i < count; i++) {
+        collectConstants(cp, linked[i], constants);
+    }
+}
+
+
+static EcConstant *findConstant(MprList *constants, EjsLookup *lookup)
+{
+    EcConstant  *cn;
+    int         next;
+
+    for (next = 0; (cn = mprGetNextItem(constants, &next)) != 0; ) {
+        if (cn->var->lookup.obj == lookup->obj && cn->var->lookup.slotNum == lookup->slotNum) {
+            return cn;
+        }
+    }
+    return 0;
+}
+
+
+/*
+    Optimize a node and its descendants. Nodes are visited in source order so const values are only propagated to
+    references that follow the definition.
+ */
+static void optimizeNode(EcCompiler *cp, EcNode *np, MprList *constants)
+{
+    Ejs         *ejs;
+    EcConstant  *cn;
+    EcNode      *child, *linked[4];
+    EjsAny      *value;
+    cchar       *word;
+    int         next, i, count;
+
+    if (np == 0 || cp->fatalError) {
+        return;
+    }
+    ejs = cp->ejs;
+    switch (np->kind) {
+    case N_HASH:
+    case N_DASSIGN:
+    case N_POSTFIX_OP:
+        /* Conditional compilation and assignment targets are not modified */
+        return;
+
+    case N_ASSIGN_OP:
+        optimizeNode(cp, np->right, constants);
+        return;
+
+    case N_CALL:
+    case N_NEW:
+        /* Don't replace the callee */
+        for (next = 0; (child = getNextAstNode(cp, np, &next)) != 0; ) {
+            if (child->kind != N_QNAME) {
+                optimizeNode(cp, child, constants);
+            }
+        }
+        return;
+
+    case N_DOT:
+        /* Don't replace the property name */
+        optimizeNode(cp, np->left, constants);
+        if (np->right && np->right->kind != N_QNAME) {
+            optimizeNode(cp, np->right, constants);
+        }
+        return;
+
+    case N_UNARY_OP:
+        if (np->tokenId == T_PLUS_PLUS || np->tokenId == T_MINUS_MINUS || np->tokenId == T_DELETE) {
+            return;
+        }
+        break;
+
+    case N_QNAME:
+        if (np->name.nameExpr || np->name.qualifierExpr) {
+            return;
+        }
+        if (np->lookup.obj && np->lookup.slotNum >= 0 && (cn = findConstant(constants, &np->lookup)) != 0 &&
+                cn->literal && cn->active && cn->count == 1) {
+            makeLiteral(np, getLiteral(cn->var->left->right)->literal.var);
+
+        } else {
+            /*
+                The parser emits names for these reserved words if the VM was not initialized. The tokenId alone is
+                not sufficient: a name node referencing a function expression has the tokenId of the last token
+                of the function body. Such names are never the reserved word text.
+             */
+            switch (np->tokenId) {
+            case T_FALSE:       value = ESV(false); word = "false"; break;
+            case T_NULL:        value = ESV(null); word = "null"; break;
+            case T_TRUE:        value = ESV(true); word = "true"; break;
+            case T_UNDEFINED:   value = ESV(undefined); word = "undefined"; break;
+            default:            value = 0; word = 0; break;
+            }
+            if (value && np->qname.name && ejsCompareAsc(ejs, np->qname.name, word) == 0) {
+                makeLiteral(np, value);
+            }
+        }
+        return;
+    }
+    for (next = 0; (child = getNextAstNode(cp, np, &next)) != 0; ) {
+        optimizeNode(cp, child, constants);
+    }
+    count = getLinkedNodes(np, linked);
+    for (i = 0; i < count; i++) {
+        optimizeNode(cp, linked[i], constants);
+    }
+    switch (np->kind) {
+    case N_BINARY_OP:
+    case N_UNARY_OP:
+        foldNode(cp, np);
+        break;
+
+    case N_BLOCK:
+    case N_DIRECTIVES:
+        eliminateDeadCode(cp, np);
+        break;
+
+    case N_FOR:
+        /* Loops with a constant true condition do not need to test the condition */
+        if ((child = getLiteral(np->forLoop.cond)) != 0 && ejsCast(ejs, child->literal.var, Boolean) == ESV(true)) {
+            np->forLoop.cond = 0;
+        }
+        break;
+
+    case N_IF:
+        /*
+            Drop the branch that cannot be taken. The surviving branch becomes the "then" block and the condition is
+            always true. If statements without a surviving branch are removed.
+         */
+        if ((child = getLiteral(np->tenary.cond)) == 0) {
+            break;
+        }
+        if (ejsCast(ejs, child->literal.var, Boolean) == ESV(true)) {
+            if (!hasDefinitions(np->tenary.elseBlock)) {
+                np->tenary.elseBlock = 0;
+            }
+        } else if (!hasDefinitions(np->tenary.thenBlock)) {
+            if (np->tenary.elseBlock) {
+                np->tenary.thenBlock = np->tenary.elseBlock;
+                np->tenary.elseBlock = 0;
+                makeLiteral(np->tenary.cond, ESV(true));
+            } else {
+                np->kind = N_NOP;
+                np->kindName = "n_nop";
+            }
+        }
+        break;
+
+    case N_VAR:
+        if ((cn = findConstant(constants, &np->lookup)) != 0 && cn->var == np) {
+            cn->active = 1;
+        }
+        break;
+    }
+}
+
+
+/*
+    Get the literal value of a node. Parenthesized expressions with a single literal are unwrapped. Only primitive
+    values that can be encoded as literals are returned.
+ */
+static EcNode *getLiteral(EcNode *np)
+{
+    if (np && np->kind == N_EXPRESSIONS && mprGetListLength(np->children) == 1) {
+        np = mprGetFirstItem(np->children);
+    }
+    if (np == 0 || np->kind != N_LITERAL || np->literal.var == 0) {
+        return 0;
+    }
+    switch (TYPE(np->literal.var)->sid) {
+    case ES_Boolean:
+    case ES_Null:
+    case ES_String:
+    case ES_Void:
+        return np;
+
+    case ES_Number:
+        if (mprIsNan(((EjsNumber*) np->literal.var)->value) || mprIsInfinite(((EjsNumber*) np->literal.var)->value)) {
+            return 0;
+        }
+        return np;
+    }
+    return 0;
+}
+
+
+/*
+    Convert a node in-place into a literal node
+ */
+static void makeLiteral(EcNode *np, EjsAny *value)
+{
+    np->kind = N_LITERAL;
+    np->kindName = "n_literal";
+    np->literal.var = value;
+    np->literal.data = 0;
+    np->left = np->right = 0;
+    mprClearList(np->children);
+}
+
+
+/*
+    Fold unary and binary operators with literal operands. The operators are evaluated by the VM so the result is
+    identical to that computed at run-time.
+ */
+static void foldNode(EcCompiler *cp, EcNode *np)
+{
+    Ejs         *ejs;
+    EcNode      *left, *right;
+    EjsAny      *result;
+    double      value;
+    int         opcode;
+
+    ejs = cp->ejs;
+    result = 0;
+
+    if ((left = getLiteral(np->left)) == 0) {
+        return;
+    }
+    if (np->kind == N_UNARY_OP) {
+        switch (np->tokenId) {
+        case T_LOGICAL_NOT:
+            result = ejsCast(ejs, left->literal.var, Boolean) == ESV(true) ? ESV(false) : ESV(true);
+            break;
+        case T_MINUS:
+        case T_TILDE:
+            if (ejsIs(ejs, left->literal.var, Number)) {
+                result = ejsInvokeOperator(ejs, left->literal.var, (np->tokenId == T_MINUS) ? EJS_OP_NEG : EJS_OP_NOT, 0);
+            }
+            break;
+        case T_PLUS:
+            if (ejsIs(ejs, left->literal.var, Number)) {
+                result = left->literal.var;
+            }
+            break;
+        }
+
+    } else {
+        if ((right = getLiteral(np->right)) == 0) {
+            return;
+        }
+        switch (np->tokenId) {
+        case T_PLUS:        opcode = EJS_OP_ADD; break;
+        case T_MINUS:       opcode = EJS_OP_SUB; break;
+        case T_MUL:         opcode = EJS_OP_MUL; break;
+        case T_DIV:         opcode = EJS_OP_DIV; break;
+        case T_MOD:         opcode = EJS_OP_REM; break;
+        case T_LSH:         opcode = EJS_OP_SHL; break;
+        case T_RSH:         opcode = EJS_OP_SHR; break;
+        case T_RSH_ZERO:    opcode = EJS_OP_USHR; break;
+        case T_BIT_AND:     opcode = EJS_OP_AND; break;
+        case T_BIT_OR:      opcode = EJS_OP_OR; break;
+        case T_BIT_XOR:     opcode = EJS_OP_XOR; break;
+        case T_EQ:          opcode = EJS_OP_COMPARE_EQ; break;
+        case T_NE:          opcode = EJS_OP_COMPARE_NE; break;
+        case T_STRICT_EQ:   opcode = EJS_OP_COMPARE_STRICTLY_EQ; break;
+        case T_STRICT_NE:   opcode = EJS_OP_COMPARE_STRICTLY_NE; break;
+        case T_LT:          opcode = EJS_OP_COMPARE_LT; break;
+        case T_LE:          opcode = EJS_OP_COMPARE_LE; break;
+        case T_GT:          opcode = EJS_OP_COMPARE_GT; break;
+        case T_GE:          opcode = EJS_OP_COMPARE_GE; break;
+        default:
+            return;
+        }
+        result = ejsInvokeOperator(ejs, left->literal.var, opcode, right->literal.var);
+    }
+    if (ejs->exception) {
+        ejsClearException(ejs);
+        return;
+    }
+    if (result == 0) {
+        return;
+    }
+    switch (TYPE(result)->sid) {
+    case ES_Number:
+        /* Negative zero cannot be encoded as an integer literal */
+        value = ((EjsNumber*) result)->value;
+        if (mprIsNan(value) || mprIsInfinite(value) || (value == 0 && 1 / value < 0)) {
+            return;
+        }
+        break;
+    case ES_Boolean:
+    case ES_Null:
+    case ES_String:
+    case ES_Void:
+        break;
+    default:
+        return;
+    }
+    makeLiteral(np, result);
+}
+
+
+/*
+    Remove statements that follow a return, throw, break or continue. Unreachable statements that define functions,
+    classes, variables or namespaces are retained as they are hoisted.
+ */
+static void eliminateDeadCode(EcCompiler *cp, EcNode *np)
+{
+    EcNode      *child;
+    int         next, dead;
+
+    dead = 0;
+    for (next = 0; (child = getNextAstNode(cp, np, &next)) != 0; ) {
+        if (dead && child->kind != N_END_FUNCTION && !hasDefinitions(child)) {
+            child->kind = N_NOP;
+            child->kindName = "n_nop";
+        } else if (isTerminal(cp, child)) {
+            dead = 1;
+        }
+    }
+}
+
+
+/*
+    Test if a statement always transfers control elsewhere. Return values in Void functions are evaluated but do not
+    return.
+ */
+static int isTerminal(EcCompiler *cp, EcNode *np)
+{
+    Ejs         *ejs;
+    EcNode      *fp;
+    EjsFunction *fun;
+
+    ejs = cp->ejs;
+    switch (np->kind) {
+    case N_BREAK:
+    case N_CONTINUE:
+    case N_THROW:
+        return 1;
+
+    case N_RETURN:
+        if (np->left) {
+            for (fp = np->parent; fp && fp->kind != N_FUNCTION; fp = fp->parent) ;
+            fun = fp ? fp->function.functionVar : 0;
+            if (fun == 0 || fun->resultType == EST(Void)) {
+                return 0;
+            }
+        }
+        return 1;
+    }
+    return 0;
+}
+
+
+/*
+    Test if a node (or its descendants) make definitions that must be retained even if the code is unreachable
+ */
+static bool hasDefinitions(EcNode *np)
+{
+    EcNode      *child, *linked[4];
+    int         next, i, count;
+
+    if (np == 0) {
+        return 0;
+    }
+    switch (np->kind) {
+    case N_CLASS:
+    case N_FUNCTION:
+    case N_HASH:
+    case N_MODULE:
+    case N_PRAGMAS:
+    case N_USE_MODULE:
+    case N_USE_NAMESPACE:
+    case N_VAR_DEFINITION:
+        return 1;
+
+    case N_BLOCK:
+        if (np->createBlockObject) {
+            return 1;
+        }
+        break;
+    }
+    for (next = 0; (child = mprGetNextItem(np->children, &next)) != 0; ) {
+        if (hasDefinitions(child)) {
+            return 1;
+        }
+    }
+    count = getLinkedNodes(np, linked);
+    for (i = 0; i < count; i++) {
+        if (hasDefinitions(linked[i])) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+
 static void astArgs(EcCompiler *cp, EcNode *np)
 {
     EcNode      *child;
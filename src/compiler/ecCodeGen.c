@@ -29,9 +29,23 @@
 #define RESTORE_ONLEFT(cp)                                  \
     cp->state->onLeft = cp->state->saveOnLeft
 
+/*
+    Switch dispatch. Switches with at least EC_SWITCH_MIN_CASES integer or string constant cases use a jump table
+    or hashed lookup instead of comparing each case in turn. Integer cases must fill at least 1 / EC_SWITCH_DENSITY
+    of their range.
+ */
+#define EC_SWITCH_LINEAR        0           /* Compare each case in turn */
+#define EC_SWITCH_TABLE         1           /* Jump table indexed by integer value */
+#define EC_SWITCH_LOOKUP        2           /* Hashed lookup by string value */
+
+#define EC_SWITCH_MIN_CASES     4
+#define EC_SWITCH_DENSITY       3
+#define EC_SWITCH_MAX_RANGE     0x10000
+
 /***************************** Forward Declarations ***************************/
 
 static void     addDebug(EcCompiler *cp, EcNode *np);
+static int      alwaysReturns(EcCompiler *cp, EcNode *np);
 static void     addDebugLine(EcCompiler *cp, EcCodeGen *code, int offset, wchar *source);
 static void     addException(EcCompiler *cp, uint tryStart, uint tryEnd, EjsType *catchType, uint handlerStart, 
                     uint handlerEnd, int numBlocks, int numStack, int flags);
@@ -45,6 +59,7 @@ static void     discardBlockItems(EcCompiler *cp, int preserve);
 static void     discardStackItems(EcCompiler *cp, int preserve);
 static void     emitNamespace(EcCompiler *cp, EjsNamespace *nsp);
 static int      flushModule(MprFile *file, EcCodeGen *code);
+static int      fuseLocalIncrement(EcCompiler *cp);
 static void     genBinaryOp(EcCompiler *cp, EcNode *np);
 static void     genBlock(EcCompiler *cp, EcNode *np);
 static void     genBreak(EcCompiler *cp, EcNode *np);
@@ -82,6 +97,7 @@ static void     genPostfixOp(EcCompiler *cp, EcNode *np);
 static void     genReturn(EcCompiler *cp, EcNode *np);
 static void     genSuper(EcCompiler *cp, EcNode *np);
 static void     genSwitch(EcCompiler *cp, EcNode *np);
+static void     genSwitchDispatch(EcCompiler *cp, EcNode *elements, int dispatch, int min, int range);
 static void     genThis(EcCompiler *cp, EcNode *np);
 static void     genThrow(EcCompiler *cp, EcNode *np);
 static void     genTry(EcCompiler *cp, EcNode *np);
@@ -91,12 +107,19 @@ static void     genUseNamespace(EcCompiler *cp, EcNode *np);
 static void     genVar(EcCompiler *cp, EcNode *np);
 static void     genVarDefinition(EcCompiler *cp, EcNode *np);
 static void     genWith(EcCompiler *cp, EcNode *np);
+static int      getCaseConstant(EcCompiler *cp, EcNode *np, int *ival, EjsString **sval);
 static int      getCodeLength(EcCompiler *cp, EcCodeGen *code);
+static EcNode   *getCompareOperands(EcCompiler *cp, EcNode *np);
 static EcNode   *getNextNode(EcCompiler *cp, EcNode *np, int *next);
+static EcNode   *getNotOperand(EcCompiler *cp, EcNode *np);
 static EcNode   *getPrevNode(EcCompiler *cp, EcNode *np, int *next);
 static int      getStackCount(EcCompiler *cp);
+static int      getSwitchDispatch(EcCompiler *cp, EcNode *elements, int *minp, int *rangep);
+static int      isTrueLiteral(EcCompiler *cp, EcNode *np);
 static int      mapToken(EcCompiler *cp, int tokenId);
+static void     markLocalIncrement(EcCompiler *cp, int start);
 static MprFile  *openModuleFile(EcCompiler *cp, cchar *filename);
+static int      closeModuleFile(EcCompiler *cp);
 static void     orderModule(EcCompiler *cp, MprList *list, EjsModule *mp);
 static void     patchJumps(EcCompiler *cp, int kind, int target);
 static void     popStack(EcCompiler *cp, int count);
@@ -105,6 +128,7 @@ static void     processModule(EcCompiler *cp, EjsModule *mp);
 static void     pushStack(EcCompiler *cp, int count);
 static void     setCodeBuffer(EcCompiler *cp, EcCodeGen *saveCode);
 static void     setFunctionCode(EcCompiler *cp, EjsFunction *fun, EcCodeGen *code);
+static int      setSites(Ejs *ejs, EcCodeGen *code, int base);
 static void     setStack(EcCompiler *cp, int count);
 
 /************************************ Code ************************************/
@@ -196,10 +220,10 @@ PUBLIC int ecCodeGen(EcCompiler *cp)
     cp->modules = modules;
 
     if (cp->outputFile) {
-        if (flushModule(cp->file, cp->state->code) < 0) {
+        if (cp->file && flushModule(cp->file, cp->state->code) < 0) {
             genError(cp, 0, "Cannot write to module file %s", cp->outputFile);
         }
-        mprCloseFile(cp->file);
+        closeModuleFile(cp);
     }
     cp->file = 0;
     ecLeaveState(cp);
@@ -332,6 +356,9 @@ static void genAssignOp(EcCompiler *cp, EcNode *np)
 static void genBinaryOp(EcCompiler *cp, EcNode *np)
 {
     EcState     *state;
+    EcCodeGen   *code;
+    uchar       *pc;
+    int         start, left, right;
 
     ENTER(cp);
 
@@ -347,13 +374,31 @@ static void genBinaryOp(EcCompiler *cp, EcNode *np)
         break;
 
     default:
+        code = state->code;
+        start = (int) mprGetBufLength(code->buf);
         if (np->left) {
             processNode(cp, np->left);
         }
         if (np->right) {
             processNode(cp, np->right);
         }
-        ecEncodeOpcode(cp, mapToken(cp, np->tokenId));
+        pc = (uchar*) mprGetBufStart(code->buf) + start;
+        if (np->tokenId == T_PLUS && cp->optimizeLevel > 0 && state->code == code && 
+                mprGetBufLength(code->buf) == start + 2 &&
+                pc[0] >= EJS_OP_GET_LOCAL_SLOT_0 && pc[0] <= EJS_OP_GET_LOCAL_SLOT_9 &&
+                pc[1] >= EJS_OP_GET_LOCAL_SLOT_0 && pc[1] <= EJS_OP_GET_LOCAL_SLOT_9) {
+            /*
+                Fuse the loads of two local variables and the add
+             */
+            left = pc[0] - EJS_OP_GET_LOCAL_SLOT_0;
+            right = pc[1] - EJS_OP_GET_LOCAL_SLOT_0;
+            mprAdjustBufEnd(code->buf, -2);
+            ecEncodeOpcode(cp, EJS_OP_ADD_LOCAL_SLOTS);
+            ecEncodeNum(cp, left);
+            ecEncodeNum(cp, right);
+        } else {
+            ecEncodeOpcode(cp, mapToken(cp, np->tokenId));
+        }
         popStack(cp, 2);
         pushStack(cp, 1);
         break;
@@ -767,6 +812,7 @@ static void genClassName(EcCompiler *cp, EjsType *type)
         ecEncodeOpcode(cp, EJS_OP_LOAD_GLOBAL);
         pushStack(cp, 1);
         ecEncodeOpcode(cp, EJS_OP_GET_OBJ_NAME);
+        ecEncodeSite(cp);
         ecEncodeName(cp, type->qname);
         popStack(cp, 1);
         pushStack(cp, 1);
@@ -952,6 +998,7 @@ static void genCallSequence(EcCompiler *cp, EcNode *np)
             }
             argc = genCallArgs(cp, right);
             ecEncodeOpcode(cp, EJS_OP_CALL_OBJ_NAME);
+            ecEncodeSite(cp);
             ecEncodeName(cp, np->qname);
             popStack(cp, 1);
             
@@ -1194,13 +1241,14 @@ static int injectCode(Ejs *ejs, EjsFunction *fun, EcCodeGen *extra)
     EjsEx       *ex;
     EjsDebug    *debug;
     uchar       *byteCode;
-    int         next, i, len, codeLen, extraCodeLen;
+    int         next, i, len, codeLen, extraCodeLen, numSites;
 
     if (extra == NULL || extra->buf == NULL) {
         return 0;
     }
     old = fun->body.code;
     codeLen = (fun->body.code) ? old->codeLen : 0;
+    numSites = (fun->body.code) ? old->numSites : 0;
     extraCodeLen = (int) mprGetBufLength(extra->buf);
     len = codeLen + extraCodeLen;
 
@@ -1210,11 +1258,16 @@ static int injectCode(Ejs *ejs, EjsFunction *fun, EcCodeGen *extra)
     if ((byteCode = mprAllocZeroed(len)) == 0) {
         return MPR_ERR_MEMORY;
     }
+    /*
+        Existing sites keep their numbers. Injected sites follow them.
+     */
+    numSites += setSites(ejs, extra, numSites);
     mprMemcpy(byteCode, extraCodeLen, mprGetBufStart(extra->buf), extraCodeLen);
     if (codeLen) {
         mprMemcpy(&byteCode[extraCodeLen], codeLen, old->byteCode, codeLen);
     }
     ejsSetFunctionCode(ejs, fun, old->module, byteCode, len, extra->debug);
+    fun->body.code->numSites = numSites;
 
     debug = old->debug;
     if (debug && debug->numLines > 0) {
@@ -1390,6 +1443,7 @@ static void genDassign(EcCompiler *cp, EcNode *np)
             ecEncodeNum(cp, field->field.index);
         } else {
             ecEncodeOpcode(cp, EJS_OP_GET_OBJ_NAME);
+            ecEncodeSite(cp);
             ecEncodeName(cp, field->field.fieldName->qname);
         }
         assert(field->field.expr);
@@ -1533,10 +1587,10 @@ static void genEndFunction(EcCompiler *cp, EcNode *np)
     ejs = cp->ejs;
     fun = cp->state->currentFunction;
     
-    if (cp->lastOpcode != EJS_OP_RETURN_VALUE && cp->lastOpcode != EJS_OP_RETURN) {
+    if (cp->lastOpcode != EJS_OP_RETURN_VALUE && cp->lastOpcode != EJS_OP_RETURN && 
+            !(cp->optimizeLevel > 0 && alwaysReturns(cp, np->parent))) {
         /*
             Ensure code cannot run off the end of a method.
-            TODO OPT - must do a better job of basic block analysis and check if all paths out of a function have a return.
          */
         if (fun->isConstructor) {
             ecEncodeOpcode(cp, EJS_OP_LOAD_THIS);
@@ -1602,7 +1656,8 @@ static void genDo(EcCompiler *cp, EcNode *np)
 {
     EcCodeGen   *outerBlock, *code;
     EcState     *state;
-    int         condLen, bodyLen, len, condShortJump, continueLabel, breakLabel, mark;
+    EcNode      *cond;
+    int         condLen, bodyLen, len, condShortJump, continueLabel, breakLabel, mark, branch;
 
     ENTER(cp);
     assert(np->kind == N_DO);
@@ -1621,10 +1676,24 @@ static void genDo(EcCompiler *cp, EcNode *np)
         processNode(cp, np->forLoop.body);
         discardStackItems(cp, mark);
     }
+    branch = 0;
     if (np->forLoop.cond) {
         np->forLoop.condCode = state->code = allocCodeBuffer(cp);
         state->needsValue = 1;
-        processNode(cp, np->forLoop.cond);
+        if ((cond = getCompareOperands(cp, np->forLoop.cond)) != 0) {
+            /*
+                Fuse the comparison and the branch back to the top
+             */
+            processNode(cp, cond->left);
+            processNode(cp, cond->right);
+            state->conditional = 1;
+            branch = mapToken(cp, cond->tokenId);
+            state->conditional = 0;
+            popStack(cp, 2);
+            pushStack(cp, 1);
+        } else {
+            processNode(cp, np->forLoop.cond);
+        }
         state->needsValue = 0;
     }
     /*
@@ -1639,12 +1708,13 @@ static void genDo(EcCompiler *cp, EcNode *np)
     }
 
     /*
-        Now that we know the body length, we can calculate the jump back to the top.
+        Now that we know the body length, we can calculate the jump back to the top. Fused compare and branch
+        instructions only have a long form.
      */
     condShortJump = 0;
     len = bodyLen + condLen;
     if (len > 0) {
-        if (len < 0x7f && cp->optimizeLevel > 0) {
+        if (len < 0x7f && cp->optimizeLevel > 0 && !branch) {
             condShortJump = 1;
             condLen += 2;
         } else {
@@ -1675,7 +1745,7 @@ static void genDo(EcCompiler *cp, EcNode *np)
             ecEncodeOpcode(cp, EJS_OP_BRANCH_TRUE_8);
             ecEncodeByte(cp, -len);
         } else {
-            ecEncodeOpcode(cp, EJS_OP_BRANCH_TRUE);
+            ecEncodeOpcode(cp, branch ? branch : EJS_OP_BRANCH_TRUE);
             ecEncodeInt32(cp, -len);
         }
         popStack(cp, 1);
@@ -1712,8 +1782,9 @@ static void genFor(EcCompiler *cp, EcNode *np)
 {
     EcCodeGen   *outerBlock, *code;
     EcState     *state;
+    EcNode      *cond, *compare;
     int         condLen, bodyLen, perLoopLen, len, condShortJump, perLoopShortJump, continueLabel, breakLabel, mark;
-    int         startMark;
+    int         startMark, branch;
 
     ENTER(cp);
 
@@ -1740,10 +1811,26 @@ static void genFor(EcCompiler *cp, EcNode *np)
      */
     ecStartBreakableStatement(cp, EC_JUMP_BREAK | EC_JUMP_CONTINUE);
 
+    cond = 0;
+    branch = 0;
     if (np->forLoop.cond) {
         np->forLoop.condCode = state->code = allocCodeBuffer(cp);
         state->needsValue = 1;
-        processNode(cp, np->forLoop.cond);
+        if ((compare = getCompareOperands(cp, np->forLoop.cond)) != 0) {
+            /*
+                Fuse the comparison and the branch. The loop is rotated so the test is at the bottom.
+             */
+            processNode(cp, compare->left);
+            processNode(cp, compare->right);
+            state->conditional = 1;
+            branch = mapToken(cp, compare->tokenId);
+            state->conditional = 0;
+            popStack(cp, 2);
+            pushStack(cp, 1);
+        } else {
+            cond = getNotOperand(cp, np->forLoop.cond);
+            processNode(cp, cond ? cond : np->forLoop.cond);
+        }
         state->needsValue = 0;
         /* Leaves one item on the stack, but this will be cleared when compared */
         assert(state->code->stackCount >= 1);
@@ -1781,6 +1868,48 @@ static void genFor(EcCompiler *cp, EcNode *np)
     if (np->forLoop.perLoopCode) {
         perLoopLen = (int) mprGetBufLength(np->forLoop.perLoopCode->buf);
     }
+    if (branch) {
+        /*
+            Rotated loop with the conditional at the bottom
+
+                    goto conditional
+                topOfBody:
+                    body
+                continueLabel:
+                    perLoop
+                conditional:
+                    conditional
+                    bxx topOfBody
+                endLoop:
+         */
+        setCodeBuffer(cp, code);
+        len = bodyLen + perLoopLen;
+        if (len < 0x7f && cp->optimizeLevel > 0) {
+            ecEncodeOpcode(cp, EJS_OP_GOTO_8);
+            ecEncodeByte(cp, len);
+        } else {
+            ecEncodeOpcode(cp, EJS_OP_GOTO);
+            ecEncodeInt32(cp, len);
+        }
+        if (np->forLoop.bodyCode) {
+            copyCodeBuffer(cp, state->code, np->forLoop.bodyCode);
+        }
+        continueLabel = (int) mprGetBufLength(state->code->buf);
+        if (np->forLoop.perLoopCode) {
+            copyCodeBuffer(cp, state->code, np->forLoop.perLoopCode);
+        }
+        copyCodeBuffer(cp, state->code, np->forLoop.condCode);
+        ecEncodeOpcode(cp, branch);
+        ecEncodeInt32(cp, -(bodyLen + perLoopLen + condLen + 5));
+
+        breakLabel = (int) mprGetBufLength(state->code->buf);
+        discardStackItems(cp, startMark);
+        patchJumps(cp, EC_JUMP_BREAK, breakLabel);
+        patchJumps(cp, EC_JUMP_CONTINUE, continueLabel);
+        copyCodeBuffer(cp, outerBlock, state->code);
+        LEAVE(cp);
+        return;
+    }
 
     /*
         Now that we know the body length, we can calculate the jump at the top. This is the shorter of
@@ -1820,10 +1949,10 @@ static void genFor(EcCompiler *cp, EcNode *np)
         copyCodeBuffer(cp, state->code, np->forLoop.condCode);
         len = bodyLen + perLoopLen;
         if (condShortJump) {
-            ecEncodeOpcode(cp, EJS_OP_BRANCH_FALSE_8);
+            ecEncodeOpcode(cp, cond ? EJS_OP_BRANCH_TRUE_8 : EJS_OP_BRANCH_FALSE_8);
             ecEncodeByte(cp, len);
         } else {
-            ecEncodeOpcode(cp, EJS_OP_BRANCH_FALSE);
+            ecEncodeOpcode(cp, cond ? EJS_OP_BRANCH_TRUE : EJS_OP_BRANCH_FALSE);
             ecEncodeInt32(cp, len);
         }
     }
@@ -1934,6 +2063,7 @@ static void genForIn(EcCompiler *cp, EcNode *np)
         ecEncodeNum(cp, np->forInLoop.iterNext->lookup.slotNum);
     } else {
         ecEncodeOpcode(cp, EJS_OP_CALL_OBJ_NAME);
+        ecEncodeSite(cp);
         ecEncodeName(cp, np->forInLoop.iterNext->qname);
     }
     ecEncodeNum(cp, 0);
@@ -2259,6 +2389,7 @@ static void genIf(EcCompiler *cp, EcNode *np)
 {
     EcCodeGen   *saveCode;
     EcState     *state;
+    EcNode      *cond;
     int         thenLen, elseLen, mark;
 
     ENTER(cp);
@@ -2268,12 +2399,25 @@ static void genIf(EcCompiler *cp, EcNode *np)
     state = cp->state;
     saveCode = state->code;
 
+    if (cp->optimizeLevel > 0 && !np->tenary.elseBlock && isTrueLiteral(cp, np->tenary.cond)) {
+        /*
+            The optimizer has removed the branch that cannot be taken
+         */
+        mark = getStackCount(cp);
+        state->needsValue = state->next->needsValue;
+        processNode(cp, np->tenary.thenBlock);
+        discardStackItems(cp, state->next->needsValue ? mark + 1 : mark);
+        LEAVE(cp);
+        return;
+    }
+
     /*
         Process the conditional. Put the popStack for the branch here so the stack is correct for the "then" and 
-        "else" blocks.
+        "else" blocks. A logical not is folded into the branch.
      */
+    cond = getNotOperand(cp, np->tenary.cond);
     state->needsValue = 1;
-    processNode(cp, np->tenary.cond);
+    processNode(cp, cond ? cond : np->tenary.cond);
     state->needsValue = 0;
     popStack(cp, 1);
 
@@ -2319,11 +2463,13 @@ static void genIf(EcCompiler *cp, EcNode *np)
 
     /*
         Calculate jump lengths. Then length will vary depending on if the jump at the end of the "then" block
-        can jump over the "else" block with a short jump.
+        can jump over the "else" block with a short jump. If there is no "else" code, the jump is omitted.
      */
     elseLen = (np->tenary.elseCode) ? (int) mprGetBufLength(np->tenary.elseCode->buf) : 0;
     thenLen = (int) mprGetBufLength(np->tenary.thenCode->buf);
-    thenLen += (elseLen < 0x7f && cp->optimizeLevel > 0) ? 2 : 5;
+    if (elseLen > 0 || cp->optimizeLevel <= 0) {
+        thenLen += (elseLen < 0x7f && cp->optimizeLevel > 0) ? 2 : 5;
+    }
 
     /*
         Now copy the basic blocks into the output code buffer, starting with the jump around the "then" code.
@@ -2331,10 +2477,10 @@ static void genIf(EcCompiler *cp, EcNode *np)
     setCodeBuffer(cp, saveCode);
 
     if (thenLen < 0x7f && cp->optimizeLevel > 0) {
-        ecEncodeOpcode(cp, EJS_OP_BRANCH_FALSE_8);
+        ecEncodeOpcode(cp, cond ? EJS_OP_BRANCH_TRUE_8 : EJS_OP_BRANCH_FALSE_8);
         ecEncodeByte(cp, thenLen);
     } else {
-        ecEncodeOpcode(cp, EJS_OP_BRANCH_FALSE);
+        ecEncodeOpcode(cp, cond ? EJS_OP_BRANCH_TRUE : EJS_OP_BRANCH_FALSE);
         ecEncodeInt32(cp, thenLen);
     }
 
@@ -2346,12 +2492,14 @@ static void genIf(EcCompiler *cp, EcNode *np)
     /*
         Create the jump to the end of the if statement
      */
-    if (elseLen < 0x7f && cp->optimizeLevel > 0) {
-        ecEncodeOpcode(cp, EJS_OP_GOTO_8);
-        ecEncodeByte(cp, elseLen);
-    } else {
-        ecEncodeOpcode(cp, EJS_OP_GOTO);
-        ecEncodeInt32(cp, elseLen);
+    if (elseLen > 0 || cp->optimizeLevel <= 0) {
+        if (elseLen < 0x7f && cp->optimizeLevel > 0) {
+            ecEncodeOpcode(cp, EJS_OP_GOTO_8);
+            ecEncodeByte(cp, elseLen);
+        } else {
+            ecEncodeOpcode(cp, EJS_OP_GOTO);
+            ecEncodeInt32(cp, elseLen);
+        }
     }
     if (np->tenary.elseCode) {
         copyCodeBuffer(cp, state->code, np->tenary.elseCode);
@@ -2409,6 +2557,7 @@ static void genLiteral(EcCompiler *cp, EcNode *np)
 
     if (TYPE(np->literal.var) == EST(XML)) {
         ecEncodeOpcode(cp, EJS_OP_LOAD_XML);
+        ecEncodeSite(cp);
         //  UNICODE
         data = ejsCreateString(ejs, (wchar*) mprGetBufStart(np->literal.data), 
                 mprGetBufLength(np->literal.data) / sizeof(wchar));
@@ -2640,17 +2789,21 @@ static void genField(EcCompiler *cp, EcNode *np)
 
 static void genPostfixOp(EcCompiler *cp, EcNode *np)
 {
+    int     start;
+
     ENTER(cp);
 
     /*
         Dup before inc
      */
+    start = (int) mprGetBufLength(cp->state->code->buf);
     processNode(cp, np->left);
     ecEncodeOpcode(cp, EJS_OP_DUP);
     ecEncodeOpcode(cp, EJS_OP_INC);
     ecEncodeByte(cp, (np->tokenId == T_PLUS_PLUS) ? 1 : -1);
     genLeftHandSide(cp, np->left);
     pushStack(cp, 1);
+    markLocalIncrement(cp, start);
     LEAVE(cp);
 }
 
@@ -2772,7 +2925,7 @@ static void genSwitch(EcCompiler *cp, EcNode *np)
     EcNode      *caseItem, *elements;
     EcCodeGen   *code, *outerBlock;
     EcState     *state;
-    int         next, len, nextCaseLen, nextCodeLen, totalLen, mark;
+    int         next, len, nextCaseLen, nextCodeLen, totalLen, mark, dispatch, min, range;
 
     ENTER(cp);
 
@@ -2796,6 +2949,7 @@ static void genSwitch(EcCompiler *cp, EcNode *np)
      */
     elements = np->right;
     assert(elements->kind == N_CASE_ELEMENTS);
+    dispatch = getSwitchDispatch(cp, elements, &min, &range);
 
     next = 0;
     while ((caseItem = getNextNode(cp, elements, &next)) && !cp->error) {
@@ -2804,7 +2958,7 @@ static void genSwitch(EcCompiler *cp, EcNode *np)
          */
         mark = getStackCount(cp);
         assert(caseItem->kind == N_CASE_LABEL);
-        if (caseItem->caseLabel.kind == EC_SWITCH_KIND_CASE) {
+        if (caseItem->caseLabel.kind == EC_SWITCH_KIND_CASE && dispatch == EC_SWITCH_LINEAR) {
             caseItem->caseLabel.expressionCode = state->code = allocCodeBuffer(cp);
             /*
                 Dup the switch expression value to preserve it for later cases.
@@ -2825,98 +2979,104 @@ static void genSwitch(EcCompiler *cp, EcNode *np)
         setStack(cp, mark);
     }
 
-    /*
-        Calculate jump lengths. Start from the last case and work backwards.
-     */
-    nextCaseLen = 0;
-    nextCodeLen = 0;
-    totalLen = 0;
-
-    next = -1;
-    while ((caseItem = getPrevNode(cp, elements, &next)) && !cp->error) {
-        if (caseItem->kind != N_CASE_LABEL) {
-            break;
-        }
-        /*
-            CODE jump
-            Jump to the code block of the next case. In the last block, we just fall out the bottom.
-         */
-        caseItem->caseLabel.nextCaseCode = nextCodeLen;
-        if (nextCodeLen > 0) {
-            len = (caseItem->caseLabel.nextCaseCode < 0x7f && cp->optimizeLevel > 0) ? 2 : 5;
-            nextCodeLen += len;
-            nextCaseLen += len;
-            totalLen += len;
-        }
+    if (dispatch != EC_SWITCH_LINEAR) {
+        setCodeBuffer(cp, code);
+        genSwitchDispatch(cp, elements, dispatch, min, range);
 
+    } else {
         /*
-            CASE jump
-            Jump to the next case expression evaluation.
+            Calculate jump lengths. Start from the last case and work backwards.
          */
-        len = getCodeLength(cp, caseItem->code);
-        nextCodeLen += len;
-        nextCaseLen += len;
-        totalLen += len;
-
-        caseItem->jumpLength = nextCaseLen;
+        nextCaseLen = 0;
         nextCodeLen = 0;
+        totalLen = 0;
+
+        next = -1;
+        while ((caseItem = getPrevNode(cp, elements, &next)) && !cp->error) {
+            if (caseItem->kind != N_CASE_LABEL) {
+                break;
+            }
+            /*
+                CODE jump
+                Jump to the code block of the next case. In the last block, we just fall out the bottom.
+             */
+            caseItem->caseLabel.nextCaseCode = nextCodeLen;
+            if (nextCodeLen > 0) {
+                len = (caseItem->caseLabel.nextCaseCode < 0x7f && cp->optimizeLevel > 0) ? 2 : 5;
+                nextCodeLen += len;
+                nextCaseLen += len;
+                totalLen += len;
+            }
 
-        if (caseItem->caseLabel.kind == EC_SWITCH_KIND_CASE) {
             /*
-                Jump to the next case expression test. Increment the length depending on whether we are using a
-                goto_8 (2 bytes) or goto (4 bytes). Add one for the CMPEQ instruction (3 vs 6)
+                CASE jump
+                Jump to the next case expression evaluation.
              */
-            len = (caseItem->jumpLength < 0x7f && cp->optimizeLevel > 0) ? 3 : 6;
+            len = getCodeLength(cp, caseItem->code);
             nextCodeLen += len;
+            nextCaseLen += len;
             totalLen += len;
 
-            if (caseItem->caseLabel.expressionCode) {
-                len = getCodeLength(cp, caseItem->caseLabel.expressionCode);
+            caseItem->jumpLength = nextCaseLen;
+            nextCodeLen = 0;
+
+            if (caseItem->caseLabel.kind == EC_SWITCH_KIND_CASE) {
+                /*
+                    Jump to the next case expression test. Increment the length depending on whether we are using a
+                    goto_8 (2 bytes) or goto (4 bytes). Add one for the CMPEQ instruction (3 vs 6)
+                 */
+                len = (caseItem->jumpLength < 0x7f && cp->optimizeLevel > 0) ? 3 : 6;
                 nextCodeLen += len;
                 totalLen += len;
+
+                if (caseItem->caseLabel.expressionCode) {
+                    len = getCodeLength(cp, caseItem->caseLabel.expressionCode);
+                    nextCodeLen += len;
+                    totalLen += len;
+                }
             }
+            nextCaseLen = 0;
         }
-        nextCaseLen = 0;
-    }
 
-    /*
-        Now copy the basic blocks into the output code buffer.
-     */
-    setCodeBuffer(cp, code);
+        /*
+            Now copy the basic blocks into the output code buffer.
+         */
+        setCodeBuffer(cp, code);
 
-    next = 0;
-    while ((caseItem = getNextNode(cp, elements, &next)) && !cp->error) {
+        next = 0;
+        while ((caseItem = getNextNode(cp, elements, &next)) && !cp->error) {
 
-        if (caseItem->caseLabel.expressionCode) {
-            copyCodeBuffer(cp, state->code, caseItem->caseLabel.expressionCode);
-        }
+            if (caseItem->caseLabel.expressionCode) {
+                copyCodeBuffer(cp, state->code, caseItem->caseLabel.expressionCode);
+            }
 
-        /*
-            Encode the jump to the next case
-         */
-        if (caseItem->caseLabel.kind == EC_SWITCH_KIND_CASE) {
-            ecEncodeOpcode(cp, EJS_OP_COMPARE_STRICTLY_EQ);
-            if (caseItem->jumpLength < 0x7f && cp->optimizeLevel > 0) {
-                ecEncodeOpcode(cp, EJS_OP_BRANCH_FALSE_8);
-                ecEncodeByte(cp, caseItem->jumpLength);
-            } else {
-                ecEncodeOpcode(cp, EJS_OP_BRANCH_FALSE);
-                ecEncodeInt32(cp, caseItem->jumpLength);
+            /*
+                Encode the jump to the next case
+             */
+            if (caseItem->caseLabel.kind == EC_SWITCH_KIND_CASE) {
+                ecEncodeOpcode(cp, EJS_OP_COMPARE_STRICTLY_EQ);
+                if (caseItem->jumpLength < 0x7f && cp->optimizeLevel > 0) {
+                    ecEncodeOpcode(cp, EJS_OP_BRANCH_FALSE_8);
+                    ecEncodeByte(cp, caseItem->jumpLength);
+                } else {
+                    ecEncodeOpcode(cp, EJS_OP_BRANCH_FALSE);
+                    ecEncodeInt32(cp, caseItem->jumpLength);
+                }
             }
-        }
-        assert(caseItem->code);
-        copyCodeBuffer(cp, state->code, caseItem->code);
+            assert(caseItem->code);
+            copyCodeBuffer(cp, state->code, caseItem->code);
 
-        /*
-            Encode the jump to the next case's code. Last case/default block may have zero length jump.
-         */
-        if (caseItem->caseLabel.nextCaseCode > 0) {
-            if (caseItem->caseLabel.nextCaseCode < 0x7f && cp->optimizeLevel > 0) {
-                ecEncodeOpcode(cp, EJS_OP_GOTO_8);
-                ecEncodeByte(cp, caseItem->caseLabel.nextCaseCode);
-            } else {
-                ecEncodeOpcode(cp, EJS_OP_GOTO);
-                ecEncodeInt32(cp, caseItem->caseLabel.nextCaseCode);
+            /*
+                Encode the jump to the next case's code. Last case/default block may have zero length jump.
+             */
+            if (caseItem->caseLabel.nextCaseCode > 0) {
+                if (caseItem->caseLabel.nextCaseCode < 0x7f && cp->optimizeLevel > 0) {
+                    ecEncodeOpcode(cp, EJS_OP_GOTO_8);
+                    ecEncodeByte(cp, caseItem->caseLabel.nextCaseCode);
+                } else {
+                    ecEncodeOpcode(cp, EJS_OP_GOTO);
+                    ecEncodeInt32(cp, caseItem->caseLabel.nextCaseCode);
+                }
             }
         }
     }
@@ -2934,6 +3094,178 @@ static void genSwitch(EcCompiler *cp, EcNode *np)
 }
 
 
+/*
+    Get the value of a constant case label expression. Returns EC_SWITCH_TABLE for integers and EC_SWITCH_LOOKUP for
+    strings. Otherwise returns EC_SWITCH_LINEAR.
+ */
+static int getCaseConstant(EcCompiler *cp, EcNode *np, int *ival, EjsString **sval)
+{
+    EjsNumber   *num;
+    int         negate;
+
+    if (np && np->kind == N_EXPRESSIONS && mprGetListLength(np->children) == 1) {
+        np = mprGetFirstItem(np->children);
+    }
+    negate = 0;
+    if (np && np->kind == N_UNARY_OP && np->tokenId == T_MINUS) {
+        np = np->left;
+        negate = 1;
+    }
+    if (np == 0 || np->kind != N_LITERAL || np->literal.var == 0) {
+        return EC_SWITCH_LINEAR;
+    }
+    switch (TYPE(np->literal.var)->sid) {
+    case ES_Number:
+        num = (EjsNumber*) np->literal.var;
+        if (num->value != floor(num->value) || fabs(num->value) > EJS_ENCODE_MAX_WORD) {
+            return EC_SWITCH_LINEAR;
+        }
+        *ival = (int) (negate ? -num->value : num->value);
+        return EC_SWITCH_TABLE;
+
+    case ES_String:
+        if (negate) {
+            return EC_SWITCH_LINEAR;
+        }
+        *sval = (EjsString*) np->literal.var;
+        return EC_SWITCH_LOOKUP;
+    }
+    return EC_SWITCH_LINEAR;
+}
+
+
+/*
+    Select how to dispatch a switch. Switches with enough cases that are all dense integer constants use a jump
+    table. Switches with enough string literal cases use a hashed lookup. Otherwise each case is compared in turn.
+ */
+static int getSwitchDispatch(EcCompiler *cp, EcNode *elements, int *minp, int *rangep)
+{
+    EcNode      *caseItem;
+    EjsString   *sval;
+    int         next, kind, dispatch, count, ival, min, max;
+
+    if (cp->optimizeLevel <= 0) {
+        return EC_SWITCH_LINEAR;
+    }
+    dispatch = EC_SWITCH_LINEAR;
+    count = min = max = 0;
+    for (next = 0; (caseItem = getNextNode(cp, elements, &next)) != 0; ) {
+        if (caseItem->caseLabel.kind != EC_SWITCH_KIND_CASE) {
+            continue;
+        }
+        kind = getCaseConstant(cp, caseItem->caseLabel.expression, &ival, &sval);
+        if (kind == EC_SWITCH_LINEAR || (count > 0 && kind != dispatch)) {
+            return EC_SWITCH_LINEAR;
+        }
+        if (kind == EC_SWITCH_TABLE) {
+            if (count == 0 || ival < min) {
+                min = ival;
+            }
+            if (count == 0 || ival > max) {
+                max = ival;
+            }
+        }
+        dispatch = kind;
+        count++;
+    }
+    if (count < EC_SWITCH_MIN_CASES) {
+        return EC_SWITCH_LINEAR;
+    }
+    if (dispatch == EC_SWITCH_TABLE) {
+        if ((max - min) >= EC_SWITCH_MAX_RANGE || (max - min + 1) > count * EC_SWITCH_DENSITY) {
+            return EC_SWITCH_LINEAR;
+        }
+        *minp = min;
+        *rangep = max - min + 1;
+    }
+    return dispatch;
+}
+
+
+/*
+    Generate a jump table or hashed lookup for a switch followed by the case blocks in source order, so that cases
+    fall through as before. The switch value remains on the stack. Jump offsets are relative to the end of the table.
+    The first matching case wins for duplicate case values.
+        SwitchTable     <min> <range> <offset.32> ... <default.32>
+        SwitchLookup    <count> (<string> <offset.32>) ... <default.32>
+ */
+static void genSwitchDispatch(EcCompiler *cp, EcNode *elements, int dispatch, int min, int range)
+{
+    EcNode      *caseItem;
+    EcState     *state;
+    EjsString   *sval;
+    MprHash     *seen;
+    MprList     *cases;
+    int         *offsets, *table, next, index, count, len, ival, defaultOffset;
+
+    state = cp->state;
+    count = mprGetListLength(elements->children);
+    offsets = mprAlloc(count * sizeof(int));
+
+    /*
+        Compute the offset of each case block from the end of the table. Unmatched values without a default case
+        jump over all the case blocks.
+     */
+    len = 0;
+    defaultOffset = -1;
+    for (next = 0; (caseItem = getNextNode(cp, elements, &next)) != 0; ) {
+        offsets[next - 1] = len;
+        if (caseItem->caseLabel.kind == EC_SWITCH_KIND_DEFAULT) {
+            defaultOffset = len;
+        }
+        len += getCodeLength(cp, caseItem->code);
+    }
+    if (defaultOffset < 0) {
+        defaultOffset = len;
+    }
+    if (dispatch == EC_SWITCH_TABLE) {
+        table = mprAlloc(range * sizeof(int));
+        for (index = 0; index < range; index++) {
+            table[index] = defaultOffset;
+        }
+        for (next = count; next > 0; next--) {
+            caseItem = mprGetItem(elements->children, next - 1);
+            if (caseItem->caseLabel.kind == EC_SWITCH_KIND_CASE) {
+                getCaseConstant(cp, caseItem->caseLabel.expression, &ival, &sval);
+                table[ival - min] = offsets[next - 1];
+            }
+        }
+        ecEncodeOpcode(cp, EJS_OP_SWITCH_TABLE);
+        ecEncodeNum(cp, min);
+        ecEncodeNum(cp, range);
+        for (index = 0; index < range; index++) {
+            ecEncodeInt32(cp, table[index]);
+        }
+
+    } else {
+        seen = mprCreateHash(0, MPR_HASH_STABLE);
+        cases = mprCreateList(0, MPR_LIST_STABLE);
+        for (next = 0; (caseItem = getNextNode(cp, elements, &next)) != 0; ) {
+            if (caseItem->caseLabel.kind == EC_SWITCH_KIND_CASE) {
+                getCaseConstant(cp, caseItem->caseLabel.expression, &ival, &sval);
+                if (!mprLookupKeyEntry(seen, ejsToMulti(cp->ejs, sval))) {
+                    mprAddKey(seen, ejsToMulti(cp->ejs, sval), caseItem);
+                    mprAddItem(cases, caseItem);
+                }
+            }
+        }
+        ecEncodeOpcode(cp, EJS_OP_SWITCH_LOOKUP);
+        ecEncodeSite(cp);
+        ecEncodeNum(cp, mprGetListLength(cases));
+        for (next = 0; (caseItem = mprGetNextItem(cases, &next)) != 0; ) {
+            getCaseConstant(cp, caseItem->caseLabel.expression, &ival, &sval);
+            ecEncodeConst(cp, sval);
+            ecEncodeInt32(cp, offsets[mprLookupItem(elements->children, caseItem)]);
+        }
+    }
+    ecEncodeInt32(cp, defaultOffset);
+
+    for (next = 0; (caseItem = getNextNode(cp, elements, &next)) != 0; ) {
+        copyCodeBuffer(cp, state->code, caseItem->code);
+    }
+}
+
+
 /*
     Load the this pointer.
  */
@@ -3147,6 +3479,8 @@ static void genTry(EcCompiler *cp, EcNode *np)
 
 static void genUnaryOp(EcCompiler *cp, EcNode *np)
 {
+    int     start;
+
     ENTER(cp);
 
     assert(np->kind == N_UNARY_OP);
@@ -3169,12 +3503,14 @@ static void genUnaryOp(EcCompiler *cp, EcNode *np)
         break;
 
     case T_PLUS_PLUS:
+        start = (int) mprGetBufLength(cp->state->code->buf);
         processNode(cp, np->left);
         ecEncodeOpcode(cp, EJS_OP_INC);
         ecEncodeByte(cp, 1);
         ecEncodeOpcode(cp, EJS_OP_DUP);
         pushStack(cp, 1);
         genLeftHandSide(cp, np->left);
+        markLocalIncrement(cp, start);
         break;
 
     case T_MINUS:
@@ -3183,12 +3519,14 @@ static void genUnaryOp(EcCompiler *cp, EcNode *np)
         break;
 
     case T_MINUS_MINUS:
+        start = (int) mprGetBufLength(cp->state->code->buf);
         processNode(cp, np->left);
         ecEncodeOpcode(cp, EJS_OP_INC);
         ecEncodeByte(cp, -1);
         ecEncodeOpcode(cp, EJS_OP_DUP);
         pushStack(cp, 1);
         genLeftHandSide(cp, np->left);
+        markLocalIncrement(cp, start);
         break;
 
     case T_TILDE:
@@ -3285,6 +3623,7 @@ static void genUnboundName(EcCompiler *cp, EcNode *np)
          */
         code = (!state->onLeft) ?  EJS_OP_GET_OBJ_NAME :  EJS_OP_PUT_OBJ_NAME;
         ecEncodeOpcode(cp, code);
+        ecEncodeSite(cp);
         ecEncodeName(cp, np->qname);
 
         popStack(cp, 1);
@@ -3301,6 +3640,7 @@ static void genUnboundName(EcCompiler *cp, EcNode *np)
         }
         code = (!state->onLeft) ?  EJS_OP_GET_OBJ_NAME :  EJS_OP_PUT_OBJ_NAME;
         ecEncodeOpcode(cp, code);
+        ecEncodeSite(cp);
         ecEncodeName(cp, np->qname);
 
         /*
@@ -3322,6 +3662,7 @@ static void genUnboundName(EcCompiler *cp, EcNode *np)
         }
         code = (!state->onLeft) ?  EJS_OP_GET_OBJ_NAME :  EJS_OP_PUT_OBJ_NAME;
         ecEncodeOpcode(cp, code);
+        ecEncodeSite(cp);
         ecEncodeName(cp, np->qname);
 
         /*
@@ -3484,9 +3825,14 @@ static MprFile *openModuleFile(EcCompiler *cp, cchar *filename)
     if (cp->noout) {
         return 0;
     }
-    filename = mprJoinPath(cp->outputDir, filename);
-    if ((cp->file = mprOpenFile(filename,  O_CREAT | O_WRONLY | O_TRUNC | O_BINARY, 0664)) == 0) {
-        genError(cp, 0, "Cannot create module file \"%s\"", filename);
+    /*
+        Write to a temporary file and rename when complete. Running programs may have the existing module file mapped
+        and rewriting it in place would change their byte code and constant pools.
+     */
+    cp->filePath = mprJoinPath(cp->outputDir, filename);
+    cp->tempPath = sfmt("%s.%d.tmp", cp->filePath, getpid());
+    if ((cp->file = mprOpenFile(cp->tempPath,  O_CREAT | O_WRONLY | O_TRUNC | O_BINARY, 0664)) == 0) {
+        genError(cp, 0, "Cannot create module file \"%s\"", cp->tempPath);
         return 0;
     }
 
@@ -3496,18 +3842,53 @@ static MprFile *openModuleFile(EcCompiler *cp, cchar *filename)
     state->code = allocCodeBuffer(cp);
     if (ecCreateModuleHeader(cp) < 0) {
         genError(cp, 0, "Cannot write module file header");
+        closeModuleFile(cp);
         return 0;
     }
     return cp->file;
 }
 
 
+/*
+    Close the module file and replace any prior module file. If the module was not written successfully, the 
+    temporary file is removed and any prior module file is preserved.
+ */
+static int closeModuleFile(EcCompiler *cp)
+{
+    int     rc;
+
+    rc = 0;
+    if (cp->file) {
+        mprCloseFile(cp->file);
+        cp->file = 0;
+    }
+    if (cp->tempPath) {
+        if (cp->fatalError) {
+            unlink(cp->tempPath);
+        } else {
+#if ME_WIN_LIKE
+            unlink(cp->filePath);
+#endif
+            if (rename(cp->tempPath, cp->filePath) < 0) {
+                genError(cp, 0, "Cannot rename module file \"%s\" to \"%s\"", cp->tempPath, cp->filePath);
+                unlink(cp->tempPath);
+                rc = MPR_ERR_CANT_WRITE;
+            }
+        }
+        cp->tempPath = 0;
+        cp->filePath = 0;
+    }
+    return rc;
+}
+
+
 static void manageCodeGen(EcCodeGen *code, int flags)
 {
     if (flags & MPR_MANAGE_MARK) {
         mprMark(code->buf);
         mprMark(code->jumps);
         mprMark(code->exceptions);
+        mprMark(code->sites);
         if (code->debug) {
             assert(code->debug->magic == EJS_DEBUG_MAGIC);
         }
@@ -3542,6 +3923,10 @@ static EcCodeGen *allocCodeBuffer(EcCompiler *cp)
         assert(0);
         return 0;
     }
+    if ((code->sites = mprCreateList(-1, MPR_LIST_STATIC_VALUES)) == 0) {
+        assert(0);
+        return 0;
+    }
     /*
         Jumps are fully processed before the state is freed
      */
@@ -3577,7 +3962,7 @@ static void copyCodeBuffer(EcCompiler *cp, EcCodeGen *dest, EcCodeGen *src)
     EjsDebug        *debug;
     EcJump          *jump;
     uint            baseOffset;
-    int             next, len, i;
+    int             next, len, i, offset;
 
     assert(dest != src);
 
@@ -3621,6 +4006,14 @@ static void copyCodeBuffer(EcCompiler *cp, EcCodeGen *dest, EcCodeGen *src)
         }
     }
 
+    /*
+        Copy and fix inline cache site operand offsets. Site operands follow an opcode so the offset is never zero.
+     */
+    next = 0;
+    while ((offset = PTOI(mprGetNextItem(src->sites, &next))) != 0) {
+        mprAddItem(dest->sites, ITOP(offset + baseOffset));
+    }
+
     /*
         Copy and fix debug offsets
      */
@@ -3725,6 +4118,114 @@ static void createInitializer(EcCompiler *cp, EjsModule *mp)
 }
 
 
+/*
+    Test if all paths through a statement end in a return or throw
+ */
+static int alwaysReturns(EcCompiler *cp, EcNode *np)
+{
+    Ejs             *ejs;
+    EjsFunction     *fun;
+    EcNode          *child;
+    int             next;
+
+    ejs = cp->ejs;
+    if (np == 0) {
+        return 0;
+    }
+    switch (np->kind) {
+    case N_THROW:
+        return 1;
+
+    case N_RETURN:
+        /* Return values in Void functions are evaluated but do not return */
+        fun = cp->state->currentFunction;
+        return !np->left || fun->resultType == NULL || fun->resultType != EST(Void);
+
+    case N_BLOCK:
+    case N_DIRECTIVES:
+        next = -1;
+        while ((child = getPrevNode(cp, np, &next)) != 0) {
+            if (child->kind != N_NOP && child->kind != N_END_FUNCTION) {
+                return alwaysReturns(cp, child);
+            }
+        }
+        return 0;
+
+    case N_IF:
+        if (np->tenary.elseBlock == 0) {
+            return isTrueLiteral(cp, np->tenary.cond) && alwaysReturns(cp, np->tenary.thenBlock);
+        }
+        return alwaysReturns(cp, np->tenary.thenBlock) && alwaysReturns(cp, np->tenary.elseBlock);
+    }
+    return 0;
+}
+
+
+/*
+    Get the operands of a comparison that may be fused with a branch
+ */
+static EcNode *getCompareOperands(EcCompiler *cp, EcNode *np)
+{
+    if (cp->optimizeLevel <= 0) {
+        return 0;
+    }
+    if (np->kind == N_EXPRESSIONS && mprGetListLength(np->children) == 1) {
+        np = np->left;
+    }
+    if (np->kind != N_BINARY_OP || np->left == 0 || np->right == 0) {
+        return 0;
+    }
+    switch (np->tokenId) {
+    case T_EQ:
+    case T_NE:
+    case T_GT:
+    case T_GE:
+    case T_LT:
+    case T_LE:
+    case T_STRICT_EQ:
+    case T_STRICT_NE:
+        return np;
+    }
+    return 0;
+}
+
+
+/*
+    Get the operand of a logical not so the not may be folded into a branch
+ */
+static EcNode *getNotOperand(EcCompiler *cp, EcNode *np)
+{
+    if (cp->optimizeLevel <= 0) {
+        return 0;
+    }
+    if (np->kind == N_EXPRESSIONS && mprGetListLength(np->children) == 1) {
+        np = np->left;
+    }
+    if (np->kind == N_UNARY_OP && np->tokenId == T_LOGICAL_NOT && np->left) {
+        return np->left;
+    }
+    return 0;
+}
+
+
+/*
+    Test if a node is a literal that is always true
+ */
+static int isTrueLiteral(EcCompiler *cp, EcNode *np)
+{
+    Ejs     *ejs;
+
+    ejs = cp->ejs;
+    if (np && np->kind == N_EXPRESSIONS && mprGetListLength(np->children) == 1) {
+        np = np->left;
+    }
+    if (np == 0 || np->kind != N_LITERAL || np->literal.var == 0) {
+        return 0;
+    }
+    return ejsIs(ejs, np->literal.var, Boolean) && ((EjsBoolean*) np->literal.var)->value;
+}
+
+
 static EcNode *getNextNode(EcCompiler *cp, EcNode *np, int *next)
 {
     if (cp->error) {
@@ -4111,18 +4612,17 @@ static void processModule(EcCompiler *cp, EjsModule *mp)
     }
     if (ecCreateModuleSection(cp) < 0) {
         genError(cp, 0, "Cannot write module sections");
-        LEAVE(cp);
-        return;
-    }
-    if (flushModule(mp->file, code) < 0) {
+    } else if (flushModule(mp->file, code) < 0) {
         genError(cp, 0, "Cannot write to module file %s", mp->name);
-        LEAVE(cp);
-        return;
     }
     if (!cp->outputFile) {
-        mprCloseFile(mp->file);
+        closeModuleFile(cp);
     }
     mp->file = 0;
+    if (cp->fatalError) {
+        LEAVE(cp);
+        return;
+    }
 #if UNUSED
     /*
         Can't remove because then compileInner can't add the compiled modules to the interpreter if code is zero.
@@ -4225,6 +4725,55 @@ static int getStackCount(EcCompiler *cp)
 }
 
 
+/*
+    Remember an increment of a local variable so it can be fused into IncLocalSlot if the result is discarded.
+    Matches GetLocalSlotN, Dup, Inc, PutLocalSlotN (postfix) and GetLocalSlotN, Inc, Dup, PutLocalSlotN (prefix).
+ */
+static void markLocalIncrement(EcCompiler *cp, int start)
+{
+    EcCodeGen   *code;
+    uchar       *pc;
+
+    code = cp->state->code;
+    if (cp->optimizeLevel <= 0 || mprGetBufLength(code->buf) != start + 5) {
+        return;
+    }
+    pc = (uchar*) mprGetBufStart(code->buf) + start;
+    if (pc[0] >= EJS_OP_GET_LOCAL_SLOT_0 && pc[0] <= EJS_OP_GET_LOCAL_SLOT_9 &&
+            pc[4] == pc[0] - EJS_OP_GET_LOCAL_SLOT_0 + EJS_OP_PUT_LOCAL_SLOT_0 &&
+            ((pc[1] == EJS_OP_DUP && pc[2] == EJS_OP_INC) || (pc[1] == EJS_OP_INC && pc[3] == EJS_OP_DUP))) {
+        code->incrementEnd = start + 5;
+    }
+}
+
+
+/*
+    Replace a local variable increment at the end of the code buffer with IncLocalSlot. Only done if the
+    increment was the last code generated into this buffer, so no jump can target the end of the sequence.
+ */
+static int fuseLocalIncrement(EcCompiler *cp)
+{
+    EcCodeGen   *code;
+    uchar       *pc;
+    int         slotNum, incr, len;
+
+    code = cp->state->code;
+    len = (int) mprGetBufLength(code->buf);
+    if (code->incrementEnd == 0 || code->incrementEnd != len) {
+        return 0;
+    }
+    code->incrementEnd = 0;
+    pc = (uchar*) mprGetBufStart(code->buf) + len - 5;
+    slotNum = pc[0] - EJS_OP_GET_LOCAL_SLOT_0;
+    incr = (pc[1] == EJS_OP_DUP) ? pc[3] : pc[2];
+    mprAdjustBufEnd(code->buf, -5);
+    ecEncodeOpcode(cp, EJS_OP_INC_LOCAL_SLOT);
+    ecEncodeNum(cp, slotNum);
+    ecEncodeByte(cp, incr);
+    return 1;
+}
+
+
 static void discardStackItems(EcCompiler *cp, int preserve)
 {
     EcCodeGen       *code;
@@ -4238,13 +4787,16 @@ static void discardStackItems(EcCompiler *cp, int preserve)
     if (count <= 0) {
         return;
     }
+    code->stackCount -= count;
+    if (fuseLocalIncrement(cp)) {
+        count--;
+    }
     if (count == 1) {
         ecEncodeOpcode(cp, EJS_OP_POP);
-    } else {
+    } else if (count > 1) {
         ecEncodeOpcode(cp, EJS_OP_POP_ITEMS);
         ecEncodeByte(cp, count);
     }
-    code->stackCount -= count;
     assert(code->stackCount >= 0);
     mprDebug("ejs compiler", level, "Stack %d, after discard\n", code->stackCount);
 }
@@ -4328,12 +4880,14 @@ static void addJump(EcCompiler *cp, EcNode *np, int kind)
 static void setFunctionCode(EcCompiler *cp, EjsFunction *fun, EcCodeGen *code)
 {
     EjsEx       *ex;
-    int         next, len;
+    int         next, len, numSites;
 
     len = (int) mprGetBufLength(code->buf);
     assert(len >= 0);
     if (len > 0) {
+        numSites = setSites(cp->ejs, code, 0);
         ejsSetFunctionCode(cp->ejs, fun, cp->state->currentModule, (uchar*) mprGetBufStart(code->buf), len, code->debug);
+        fun->body.code->numSites = numSites;
     }
     /*
         Define any try/catch blocks encountered
@@ -4346,6 +4900,24 @@ static void setFunctionCode(EcCompiler *cp, EjsFunction *fun, EcCodeGen *code)
 }
 
 
+/*
+    Number the inline cache site operands in a function code buffer starting at "base". The interpreter uses site
+    numbers to index the per-function table of inline caches. Returns the number of sites.
+ */
+static int setSites(Ejs *ejs, EcCodeGen *code, int base)
+{
+    uchar   *start;
+    int     next, offset, site;
+
+    start = (uchar*) mprGetBufStart(code->buf);
+    site = base;
+    for (next = 0; (offset = PTOI(mprGetNextItem(code->sites, &next))) != 0; site++) {
+        ejsEncodeInt32AtPos(ejs, &start[offset], site);
+    }
+    return site - base;
+}
+
+
 static void emitNamespace(EcCompiler *cp, EjsNamespace *nsp)
 {
     ecEncodeOpcode(cp, EJS_OP_ADD_NAMESPACE);
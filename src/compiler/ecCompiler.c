@@ -69,6 +69,8 @@ static void manageCompiler(EcCompiler *cp, int flags)
         mprMark(cp->docToken);
         mprMark(cp->extraFiles);
         mprMark(cp->file);
+        mprMark(cp->filePath);
+        mprMark(cp->tempPath);
         mprMark(cp->keywords);
         mprMark(cp->peekToken);
         mprMark(cp->putback);
@@ -189,7 +191,7 @@ static int compileInner(EcCompiler *cp, int argc, char **argv)
     paused = ejsBlockGC(ejs);
     if (!cp->parseOnly && cp->errorCount == 0) {
         ecResetParser(cp);
-        if (ecAstProcess(cp) < 0) {
+        if (ecAstProcess(cp) < 0 || ecAstOptimize(cp) < 0) {
             ejsPopBlock(ejs);
             cp->nodes = NULL;
             ejsUnblockGC(ejs, paused);
@@ -444,6 +444,7 @@ static void createFunctionSection(EcCompiler *cp, EjsPot *block, int slotNum, Ej
         assert(code->codeLen > 0);
         ecEncodeNum(cp, code->numHandlers);
         ecEncodeNum(cp, code->codeLen);
+        ecEncodeNum(cp, code->numSites);
         ecEncodeBlock(cp, code->byteCode, code->codeLen);
         if (code->numHandlers > 0) {
             createExceptionSection(cp, fun);
@@ -998,6 +999,19 @@ PUBLIC void ecEncodeInt32(EcCompiler *cp, int number)
 }
 
 
+/*
+    Encode an instruction site operand for an inline cache. The site number is set when the function code is defined.
+ */
+PUBLIC void ecEncodeSite(EcCompiler *cp)
+{
+    EcCodeGen   *code;
+
+    code = cp->state->code;
+    mprAddItem(code->sites, ITOP(mprGetBufLength(code->buf)));
+    ecEncodeInt32(cp, 0);
+}
+
+
 PUBLIC void ecEncodeByteAtPos(EcCompiler *cp, int offset, int value)
 {
     ejsEncodeByteAtPos(cp->ejs, (uchar*) mprGetBufStart(cp->state->code->buf) + offset, value);
@@ -0,0 +1,37 @@
+/*
+    Test by-name property access in instance initializers injected before constructor code
+ */
+var config = {size: 4, name: "box", xml: <shape><kind>square</kind></shape>}
+
+class Box {
+    public var size = config.size
+    public var label = config.name
+    public var kind = config.xml.kind.toString()
+
+    function Box(other) {
+        config.size = size * 2
+        switch (other.name) {
+        case "box":
+            label = "same"
+            break
+        case "ball":
+            label = "different"
+            break
+        case "cone":
+            label = "pointed"
+            break
+        case "cube":
+            label = "solid"
+            break
+        }
+    }
+}
+
+for (i = 0; i < 4; i++) {
+    config.size = 4
+    let b = new Box(i & 1 ? {name: "ball"} : config)
+    assert(b.size == 4)
+    assert(config.size == 8)
+    assert(b.label == (i & 1 ? "different" : "same"))
+    assert(b.kind == "square")
+}
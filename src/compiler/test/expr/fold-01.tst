@@ -0,0 +1,63 @@
+/*
+    Test constant folding, constant propagation and unreachable code removal
+ */
+
+const K = 7
+const S = "ab"
+
+//  Folded expressions must give the same results as evaluated ones
+function fold() {
+    return [1 + 2 * 3, "x" + "y" + 1, -(4) + K, S + "c", 1 / 3, 5 == 5, "a" < "b", !0, ~1, 7 % 3].join(",")
+}
+assert(fold() == "7,xy1,3,abc,0.3333333333333333,true,true,true,-2,1")
+
+//  Values that are not folded
+assert(1 / 0 == Infinity)
+assert(isNaN(0 / 0))
+
+//  Constant conditions
+function cond(x) {
+    const L = 3
+    let a = 1
+    if (false) {
+        a = 100
+    }
+    if (!x) {
+        return "none"
+    }
+    if (true) {
+        a += L
+    } else {
+        a = 0
+    }
+    return a
+    a = 200
+}
+assert(cond(1) == 4)
+assert(cond(0) == "none")
+
+//  Loops with fused and constant conditions
+function loop(n) {
+    let i = 0
+    do { i++ } while (i < n)
+    while (true) {
+        if (i > 2 * n) break
+        i++
+    }
+    return i
+}
+assert(loop(5) == 11)
+assert(loop(0) == 1)
+
+//  Functions and variables after a return are still defined
+function hoisted() {
+    return inner()
+    function inner() { return "inner" }
+}
+assert(hoisted() == "inner")
+
+function branches(x) {
+    if (x) { return 1 } else { return 2 }
+}
+assert(branches(true) == 1 && branches(false) == 2)
+assert(typeof K == "number" && S.length == 2)
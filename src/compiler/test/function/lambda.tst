@@ -10,3 +10,16 @@ assert(truth() == true)
 
 var total = function() 1 + 5
 assert(total() == 6)
+
+//  Function expressions ending in reserved word values are still functions
+
+var yes = function () true
+assert(typeof yes == "function")
+assert(yes() === true)
+
+var nothing = function () null
+assert(typeof nothing == "function")
+assert(nothing() === null)
+
+var no = function () false
+assert(no() === false)
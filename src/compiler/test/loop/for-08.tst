@@ -0,0 +1,69 @@
+/*
+    Loops using fused local increments, local adds and bottom tested conditions
+ */
+
+function count(n) {
+    let sum = 0
+    for (var i = 0; i < n; i++) {
+        sum = sum + i
+    }
+    return [i, sum]
+}
+assert(count(5) == "5,10")
+assert(count(0) == "0,0")
+assert(count(NaN) == "0,0")
+
+function down(n) {
+    let steps = 0
+    while (n >= 0) {
+        n--;
+        --n;
+        ++steps
+    }
+    return [n, steps]
+}
+assert(down(5) == "-1,3")
+
+function skip(n) {
+    let odd = 0, i
+    for (i = 0; i <= n; i++) {
+        if (i % 2 == 0) {
+            continue
+        }
+        if (i > 7) {
+            break
+        }
+        odd++
+    }
+    return [i, odd]
+}
+assert(skip(20) == "9,4")
+assert(skip(3) == "4,2")
+
+function nested(n) {
+    let total = 0
+    for (var i = 0; i < n; i++) {
+        for (var j = i; j != n; j++) {
+            total++
+        }
+    }
+    return total
+}
+assert(nested(4) == 10)
+
+//  Add of two locals is not only numeric
+function join(a, b) {
+    return a + b
+}
+assert(join("a", "b") == "ab")
+assert(join(1, "2") == "12")
+assert(join(1, 2) == 3)
+
+//  The increment result is still available when used
+function used() {
+    let i = 1
+    let a = i++
+    let b = ++i
+    return [a, b, i]
+}
+assert(used() == "1,3,3")
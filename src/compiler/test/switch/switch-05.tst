@@ -0,0 +1,80 @@
+/*
+    Test switch statements that dispatch via jump tables and string lookups
+ */
+
+//  Dense integer cases use a jump table
+function byNumber(x) {
+    let r = ""
+    switch (x) {
+    case 1:
+        r += "a"
+    case 2:
+        r += "b"
+        break
+    case 3:
+        r += "c"
+        break
+    case 5:
+        r += "e"
+        break
+    case -1:
+        r += "m"
+        break
+    default:
+        r += "d"
+    case 7:
+        r += "g"
+    }
+    return r
+}
+
+assert(byNumber(1) == "ab")
+assert(byNumber(2) == "b")
+assert(byNumber(3) == "c")
+assert(byNumber(4) == "dg")
+assert(byNumber(5) == "e")
+assert(byNumber(-1) == "m")
+assert(byNumber(7) == "g")
+assert(byNumber(100) == "dg")
+assert(byNumber(1.5) == "dg")
+assert(byNumber("1") == "dg")
+assert(byNumber(null) == "dg")
+
+//  String cases use a hashed lookup. The first duplicate case wins.
+function byString(s) {
+    switch (s) {
+    case "get":
+        return 1
+    case "put":
+        return 2
+    case "post":
+        return 3
+    case "delete":
+        return 4
+    case "get":
+        return 99
+    }
+    return 0
+}
+
+assert(byString("get") == 1)
+assert(byString("put") == 2)
+assert(byString("post") == 3)
+assert(byString("delete") == 4)
+assert(byString("g" + "et") == 1)
+assert(byString("head") == 0)
+assert(byString(1) == 0)
+assert(byString(undefined) == 0)
+
+//  Switch inside a loop leaves the stack balanced
+let total = 0
+for (i = 0; i < 1000; i++) {
+    switch (i % 5) {
+    case 0: total += 1; break
+    case 1: total += 2; break
+    case 2: total += 3; break
+    case 3: total += 4; break
+    default: total += 5
+    }
+}
+assert(total == 3000)
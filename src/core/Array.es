@@ -400,16 +400,18 @@ module ejs {
             return false
         }
 
-	//TODO - comparator differ from ECMA
         /**
-            Sort the array. The array is sorted in lexical order. A compare function may be supplied.
+            Sort the array. The array is sorted in lexical order. A compare function may be supplied. The sort is stable:
+            items that compare equal keep their relative order.
             @param compare Function to use to compare. A null comparator will use a text compare. The compare signature is:
                 function comparator (array: Array, index1: Number, index2: Number): Number
                 The comparison function should return 0 if the items are equal, -1 if the item at index1 is less and should
-                return 1 otherwise.
+                return 1 otherwise. The array is not modified until the sort completes.
+                A comparator declared with exactly two parameters is passed the items directly:
+                function comparator (item1, item2): Number
             @param order If order is >= 0, then an ascending lexical order is used. Otherwise descending.
             @return the sorted array reference
-            @spec ejs Added the order argument.
+            @spec ejs Added the order argument and the comparator with array and index arguments.
          */
         native function sort(compare: Function? = null, order: Number = 1): Array 
 
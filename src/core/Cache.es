@@ -153,6 +153,15 @@ module ejs {
         function setLimits(limits: Object): Void
             adapter.setLimits(limits)
 
+        /**
+            Cache statistics. The statistics are specific to the cache backend and may be null if the backend does 
+            not collect statistics. The "local" backend provides hits, misses, evictions, expired, keys and memory
+            counters.
+            @return An object hash of statistics.
+         */
+        function get stats(): Object
+            adapter.stats
+
         /**
             Write the key and associated value to the cache. The value is written according to the optional mode option.  
             @param key Key to modify
@@ -23,7 +23,8 @@ module ejs {
 
         /**
             The quota of work to perform before the GC will be invoked. Set to the number of work units that will 
-            trigger the GC to run. This roughly corresponds to the number of allocated objects.
+            trigger the GC to run. This roughly corresponds to the number of allocated objects. The collector raises
+            the quota in proportion to the live heap after each collection. Setting the quota defines its minimum.
          */
         native static function get newQuota(): Number
         native static function set newQuota(quota: Number): Void
@@ -91,6 +91,18 @@ module ejs {
          */
         native function setLimits(limits: Object): Void
 
+        /**
+            Cache statistics. Counters are cumulative since the cache was created.
+            @return An object hash with the following properties:
+            @option evictions Number of keys removed to satisfy the key or memory limits
+            @option expired Number of keys removed because they expired
+            @option hits Number of reads that found a key
+            @option keys Number of keys currently in the cache
+            @option memory Memory in use for keys and data
+            @option misses Number of reads for missing or expired keys
+         */
+        native function get stats(): Object
+
         /**
             Write the key and associated value to the cache. The value is written according to the optional mode option.  
             The key's expiry will be updated based on the defined lifespan from the current time.
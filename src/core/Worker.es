@@ -134,10 +134,12 @@ module ejs {
 
         /**
             Post a message to the Worker's parent
-            @param data Data to pass to the worker's onmessage callback.
-            @param ports Not implemented
+            @param data Data to pass to the worker's onmessage callback. The data is copied using a structured clone
+                and is received as the event "data" property. Strings are shared without copying.
+            @param transfer Optional array of ByteArrays to transfer to the receiver rather than copy. Transferred
+                ByteArrays are left empty in the sender.
          */
-        native function postMessage(data: Object, ports: Array? = null): Void
+        native function postMessage(data: Object, transfer: Array? = null): Void
 
         //  TODO - more description?
         /**
@@ -187,11 +189,13 @@ module ejs {
 
     /**
         Post a message to the Worker's parent. This is only valid inside Worker scripts.
-        @param data Data to pass to the worker's onmessage callback.
-        @param ports Not implemented
+        @param data Data to pass to the worker's onmessage callback. The data is copied using a structured clone
+            and is received as the event "data" property. Strings are shared without copying.
+        @param transfer Optional array of ByteArrays to transfer to the receiver rather than copy. Transferred
+            ByteArrays are left empty in the sender.
      */
-    function postMessage(data: Object, ports: Array? = null): Void
-        self.postMessage(data, ports)
+    function postMessage(data: Object, transfer: Array? = null): Void
+        self.postMessage(data, transfer)
 
     /**
         The error callback function.  This is the callback function to receive incoming data from postMessage() calls.
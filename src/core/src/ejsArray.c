@@ -367,91 +367,178 @@ static int setArrayPropertyByName(Ejs *ejs, EjsArray *ap, EjsName qname, EjsObj
 }
 
 
-static EjsArray *makeIntersection(Ejs *ejs, EjsArray *lhs, EjsArray *rhs)
+/*
+    Temporary hash set of array elements for the set operators. Numbers, strings and paths hash by value and other
+    objects by reference. Candidates are matched using compareArrayElement. The set does not mark its elements which
+    must be held by the arrays being operated on.
+ */
+typedef struct ArraySet {
+    EjsAny      **items;                /* Open addressed hash table */
+    int         mask;                   /* Table size - 1 */
+} ArraySet;
+
+
+static int openArraySet(ArraySet *set, int count)
 {
-    EjsArray    *result;
-    EjsObj      **l, **r, **resultSlots;
-    int         i, j, k;
+    int     size;
 
-    result = ejsCreateArray(ejs, 0);
-    l = lhs->data;
-    r = rhs->data;
+    for (size = 16; size < count * 2; size *= 2) ;
+    if ((set->items = mprAllocZeroed(size * sizeof(EjsAny*))) == 0) {
+        return MPR_ERR_MEMORY;
+    }
+    mprHold(set->items);
+    set->mask = size - 1;
+    return 0;
+}
 
-    for (i = 0; i < lhs->length; i++) {
-        for (j = 0; j < rhs->length; j++) {
-            if (compareArrayElement(ejs, l[i], r[j])) {
-                resultSlots = result->data;
-                for (k = 0; k < result->length; k++) {
-                    if (compareArrayElement(ejs, l[i], resultSlots[k])) {
-                        break;
-                    }
-                }
-                if (result->length == 0 || k == result->length) {
-                    setArrayProperty(ejs, result, -1, l[i]);
-                }
-            }
+
+static void closeArraySet(ArraySet *set)
+{
+    mprRelease(set->items);
+    set->items = 0;
+}
+
+
+static uint hashArrayElement(Ejs *ejs, EjsAny *item)
+{
+    EjsString   *str;
+    MprNumber   n;
+    uint64      bits;
+    cchar       *path;
+
+    if (ejsIs(ejs, item, Number)) {
+        /* Zero and negative zero compare equal */
+        n = ((EjsNumber*) item)->value;
+        if (n == 0) {
+            n = 0;
         }
+        memcpy(&bits, &n, sizeof(bits));
+        bits *= 0x9E3779B97F4A7C15ULL;
+        return (uint) (bits >> 32);
     }
-    return result;
+    if (ejsIs(ejs, item, String)) {
+        str = (EjsString*) item;
+        return whash(str->value, str->length);
+    }
+    if (ejsIs(ejs, item, Path)) {
+        path = ((EjsPath*) item)->value;
+        return shash(path, slen(path));
+    }
+    return (uint) ((uint64) PTOL(item) >> 4) * 0x9E3779B1U;
 }
 
 
-static int addUnique(Ejs *ejs, EjsArray *ap, EjsObj *element)
+/*
+    Add an element if not already present. Returns true if added.
+ */
+static bool addArraySet(Ejs *ejs, ArraySet *set, EjsAny *item)
 {
+    EjsAny  *prior;
     int     i;
 
-    for (i = 0; i < ap->length; i++) {
-        if (compareArrayElement(ejs, ap->data[i], element)) {
-            break;
+    for (i = hashArrayElement(ejs, item) & set->mask; (prior = set->items[i]) != 0; i = (i + 1) & set->mask) {
+        if (compareArrayElement(ejs, prior, item)) {
+            return 0;
         }
     }
-    if (i == ap->length) {
-        if (setArrayProperty(ejs, ap, -1, element) < 0) {
-            return EJS_ERR;
+    set->items[i] = item;
+    return 1;
+}
+
+
+static bool inArraySet(Ejs *ejs, ArraySet *set, EjsAny *item)
+{
+    EjsAny  *prior;
+    int     i;
+
+    for (i = hashArrayElement(ejs, item) & set->mask; (prior = set->items[i]) != 0; i = (i + 1) & set->mask) {
+        if (compareArrayElement(ejs, prior, item)) {
+            return 1;
         }
     }
     return 0;
 }
 
 
-static EjsArray *makeUnion(Ejs *ejs, EjsArray *lhs, EjsArray *rhs)
+static EjsArray *makeIntersection(Ejs *ejs, EjsArray *lhs, EjsArray *rhs)
 {
     EjsArray    *result;
-    EjsObj      **l, **r;
+    ArraySet    rset, found;
     int         i;
 
     result = ejsCreateArray(ejs, 0);
-    l = lhs->data;
-    r = rhs->data;
+    if (openArraySet(&rset, rhs->length) < 0) {
+        return result;
+    }
+    if (openArraySet(&found, min(lhs->length, rhs->length)) < 0) {
+        closeArraySet(&rset);
+        return result;
+    }
+    for (i = 0; i < rhs->length; i++) {
+        addArraySet(ejs, &rset, rhs->data[i]);
+    }
+    for (i = 0; i < lhs->length; i++) {
+        if (inArraySet(ejs, &rset, lhs->data[i]) && addArraySet(ejs, &found, lhs->data[i])) {
+            setArrayProperty(ejs, result, -1, lhs->data[i]);
+        }
+    }
+    closeArraySet(&found);
+    closeArraySet(&rset);
+    return result;
+}
 
+
+static EjsArray *makeUnion(Ejs *ejs, EjsArray *lhs, EjsArray *rhs)
+{
+    EjsArray    *result;
+    ArraySet    set;
+    int         i;
+
+    result = ejsCreateArray(ejs, 0);
+    if (openArraySet(&set, lhs->length + rhs->length) < 0) {
+        return result;
+    }
     for (i = 0; i < lhs->length; i++) {
-        addUnique(ejs, result, l[i]);
+        if (addArraySet(ejs, &set, lhs->data[i])) {
+            setArrayProperty(ejs, result, -1, lhs->data[i]);
+        }
     }
     for (i = 0; i < rhs->length; i++) {
-        addUnique(ejs, result, r[i]);
+        if (addArraySet(ejs, &set, rhs->data[i])) {
+            setArrayProperty(ejs, result, -1, rhs->data[i]);
+        }
     }
+    closeArraySet(&set);
     return result;
 }
 
 
+/*
+    Remove all elements of lhs that match an element of rhs. The lhs array is compacted in place.
+ */
 PUBLIC EjsArray *ejsRemoveItems(Ejs *ejs, EjsArray *lhs, EjsArray *rhs)
 {
-    EjsObj  **l, **r;
-    int     i, j, k;
-
-    l = lhs->data;
-    r = rhs->data;
+    ArraySet    set;
+    EjsObj      **data;
+    int         i, k;
 
-    for (j = 0; j < rhs->length; j++) {
-        for (i = 0; i < lhs->length; i++) {
-            if (compareArrayElement(ejs, l[i], r[j])) {
-                for (k = i + 1; k < lhs->length; k++) {
-                    l[k - 1] = l[k];
-                }
-                lhs->length--;
-            }
+    if (rhs->length == 0) {
+        return lhs;
+    }
+    if (openArraySet(&set, rhs->length) < 0) {
+        return lhs;
+    }
+    for (i = 0; i < rhs->length; i++) {
+        addArraySet(ejs, &set, rhs->data[i]);
+    }
+    data = lhs->data;
+    for (i = k = 0; i < lhs->length; i++) {
+        if (!inArraySet(ejs, &set, data[i])) {
+            data[k++] = data[i];
         }
     }
+    lhs->length = k;
+    closeArraySet(&set);
     return lhs;
 }
 
@@ -800,7 +887,11 @@ static bool compareArrayElement(Ejs *ejs, EjsObj *v1, EjsObj *v2)
         return ((EjsNumber*) v1)->value == ((EjsNumber*) v2)->value;
     }
     if (ejsIs(ejs, v1, String)) {
-        return (EjsString*) v1 == (EjsString*) v2;
+        /* Interned strings are unique. Long joined strings may not be interned yet */
+        if (ejsIsInterned((EjsString*) v1) && ejsIsInterned((EjsString*) v2)) {
+            return 0;
+        }
+        return ejsCompareString(ejs, (EjsString*) v1, (EjsString*) v2) == 0;
     }
     if (ejsIs(ejs, v1, Path)) {
         return smatch(((EjsPath*) v1)->value, ((EjsPath*) v2)->value);
@@ -1234,69 +1325,323 @@ static EjsArray *sliceArray(Ejs *ejs, EjsArray *ap, int argc, EjsObj **argv)
 
 
 /*
-    Quick sort partition
+    Array sorting. A stable bottom-up merge sort runs over a permutation of element indexes so the array is not modified
+    until the sort completes. This keeps the elements seen by an index based comparator stable and leaves the array
+    unchanged if the comparator throws. Short runs are sorted by binary insertion and adjacent runs that are already
+    in order are not merged, so sorted input takes linear time.
  */
-static int partition(Ejs *ejs, EjsArray *array, EjsFunction *compare, int direction, int p, int r)
+#define SORT_RUN            32          /* Length of runs sorted by insertion */
+#define SORT_MAX_INTEGER    1e15        /* Largest magnitude integer compared as text without conversion */
+
+#define SORT_COMPARE        1           /* Compare function of the form: compare(array, index1, index2) */
+#define SORT_COMPARE_ITEMS  2           /* Compare function of the form: compare(item1, item2) */
+#define SORT_INTEGERS       3           /* All items are integers compared as their decimal text */
+#define SORT_STRINGS        4           /* All items are strings */
+#define SORT_KEYS           5           /* Items are compared using their string conversions */
+
+typedef struct ArraySort {
+    Ejs         *ejs;
+    EjsArray    *array;                 /* Array being sorted */
+    EjsFunction *compare;               /* User compare function */
+    EjsAny      **items;                /* Array elements at the start of the sort */
+    EjsAny      **keys;                 /* Cached string keys or boxed indexes for SORT_COMPARE */
+    int         *order;                 /* Sorted permutation of element indexes */
+    int         *merge;                 /* Merge buffer */
+    int         length;                 /* Number of elements */
+    int         direction;              /* Sort direction multiplier */
+    int         kind;                   /* Comparison method */
+} ArraySort;
+
+
+static void manageArraySort(ArraySort *sp, int flags)
 {
-    EjsString   *sx, *so;
-    EjsNumber   *result;
-    EjsAny      *argv[3], *tmp;
-    EjsObj      *x;
-    int         i, j, order;
-
-    x = array->data[r];
-    sx = 0;
+    int     i;
 
-    if (compare) {
-        if ((argv[1] = ejsCreateNumber(ejs, r)) == 0) {
-            return 0;
+    if (flags & MPR_MANAGE_MARK) {
+        mprMark(sp->array);
+        mprMark(sp->compare);
+        mprMark(sp->items);
+        mprMark(sp->keys);
+        mprMark(sp->order);
+        mprMark(sp->merge);
+        if (sp->items) {
+            for (i = 0; i < sp->length; i++) {
+                mprMark(sp->items[i]);
+            }
         }
-    } else {
-        if ((sx = ejsToString(ejs, x)) == 0) {
-            return 0;
+        if (sp->keys) {
+            for (i = 0; i < sp->length; i++) {
+                mprMark(sp->keys[i]);
+            }
         }
     }
-    j = p - 1;
+}
 
-    for (i = p; i < r; i++) {
-        if (compare) {
-            argv[0] = array;
-            argv[2] = ejsCreateNumber(ejs, i);
-            result = ejsRunFunction(ejs, compare, NULL, 3, argv);
-            if (!ejsIs(ejs, result, Number)) {
-                return 0;
+
+static int countDigits(int64 value)
+{
+    int     digits;
+
+    for (digits = 1; value >= 10; digits++) {
+        value /= 10;
+    }
+    return digits;
+}
+
+
+/*
+    Compare integers in the order of their decimal text. This matches comparing Number.toString() of integers below
+    SORT_MAX_INTEGER where "-" sorts before the digits.
+ */
+static int compareIntegerText(int64 a, int64 b)
+{
+    int     da, db, i;
+
+    if (a == b) {
+        return 0;
+    }
+    if ((a < 0) != (b < 0)) {
+        return (a < 0) ? -1 : 1;
+    }
+    if (a < 0) {
+        a = -a;
+        b = -b;
+    }
+    /*
+        Pad the shorter number with zeros. If then equal, the shorter text is a prefix of the longer and sorts first.
+     */
+    da = countDigits(a);
+    db = countDigits(b);
+    for (i = da; i < db; i++) {
+        a *= 10;
+    }
+    for (i = db; i < da; i++) {
+        b *= 10;
+    }
+    if (a == b) {
+        return (da < db) ? -1 : 1;
+    }
+    return (a < b) ? -1 : 1;
+}
+
+
+/*
+    Compare the elements at two indexes. Returns the order multiplied by the sort direction.
+ */
+static int compareSortItems(ArraySort *sp, int i, int j)
+{
+    Ejs         *ejs;
+    EjsAny      *argv[3], *result;
+    MprNumber   n;
+    int         order;
+
+    ejs = sp->ejs;
+    switch (sp->kind) {
+    case SORT_COMPARE:
+        argv[0] = sp->array;
+        argv[1] = sp->keys[i];
+        argv[2] = sp->keys[j];
+        result = ejsRunFunction(ejs, sp->compare, NULL, 3, argv);
+        break;
+
+    case SORT_COMPARE_ITEMS:
+        argv[0] = sp->items[i];
+        argv[1] = sp->items[j];
+        result = ejsRunFunction(ejs, sp->compare, NULL, 2, argv);
+        break;
+
+    case SORT_INTEGERS:
+        return compareIntegerText((int64) ((EjsNumber*) sp->items[i])->value, 
+            (int64) ((EjsNumber*) sp->items[j])->value) * sp->direction;
+
+    case SORT_STRINGS:
+        return ejsCompareString(ejs, sp->items[i], sp->items[j]) * sp->direction;
+
+    case SORT_KEYS:
+    default:
+        return ejsCompareString(ejs, sp->keys[i], sp->keys[j]) * sp->direction;
+    }
+    if (result == 0 || ejs->exception) {
+        return 0;
+    }
+    if (!ejsIs(ejs, result, Number) && (result = ejsToNumber(ejs, result)) == 0) {
+        return 0;
+    }
+    n = ((EjsNumber*) result)->value;
+    order = (n < 0) ? -1 : ((n > 0) ? 1 : 0);
+    return order * sp->direction;
+}
+
+
+/*
+    Sort order[lo..hi) by binary insertion
+ */
+static void insertionSort(ArraySort *sp, int lo, int hi)
+{
+    Ejs     *ejs;
+    int     *order, i, item, left, right, mid;
+
+    ejs = sp->ejs;
+    order = sp->order;
+    for (i = lo + 1; i < hi && !ejs->exception; i++) {
+        item = order[i];
+        if (compareSortItems(sp, order[i - 1], item) <= 0) {
+            continue;
+        }
+        /* Find the position after any equal items to keep the sort stable */
+        for (left = lo, right = i - 1; left < right && !ejs->exception; ) {
+            mid = (left + right) / 2;
+            if (compareSortItems(sp, order[mid], item) <= 0) {
+                left = mid + 1;
+            } else {
+                right = mid;
             }
-            order = ejsGetInt(ejs, result);
+        }
+        memmove(&order[left + 1], &order[left], (i - left) * sizeof(int));
+        order[left] = item;
+    }
+}
+
+
+/*
+    Merge the sorted runs order[lo..mid) and order[mid..hi)
+ */
+static void mergeRuns(ArraySort *sp, int lo, int mid, int hi)
+{
+    Ejs     *ejs;
+    int     *order, *merge, i, j, k;
 
+    ejs = sp->ejs;
+    order = sp->order;
+    merge = sp->merge;
+    if (compareSortItems(sp, order[mid - 1], order[mid]) <= 0) {
+        return;
+    }
+    memcpy(&merge[lo], &order[lo], (mid - lo) * sizeof(int));
+    for (i = lo, j = mid, k = lo; i < mid && j < hi; k++) {
+        if (compareSortItems(sp, merge[i], order[j]) <= 0) {
+            order[k] = merge[i++];
         } else {
-            if ((so = ejsToString(ejs, array->data[i])) == 0) {
-                return 0;
+            order[k] = order[j++];
+        }
+        if (ejs->exception) {
+            return;
+        }
+    }
+    if (i < mid) {
+        memcpy(&order[k], &merge[i], (mid - i) * sizeof(int));
+    }
+}
+
+
+/*
+    Select the comparison method and cache the comparison keys
+ */
+static int prepareSort(ArraySort *sp)
+{
+    Ejs         *ejs;
+    EjsAny      *item;
+    MprNumber   n;
+    int         i, integers, strings;
+
+    ejs = sp->ejs;
+    if (sp->compare) {
+        if (sp->compare->numArgs == 2 && !sp->compare->rest) {
+            sp->kind = SORT_COMPARE_ITEMS;
+        } else {
+            sp->kind = SORT_COMPARE;
+            if ((sp->keys = mprAllocZeroed(sp->length * sizeof(EjsAny*))) == 0) {
+                return MPR_ERR_MEMORY;
+            }
+            for (i = 0; i < sp->length; i++) {
+                sp->keys[i] = ejsCreateNumber(ejs, i);
+            }
+        }
+        return 0;
+    }
+    integers = strings = 1;
+    for (i = 0; i < sp->length && (integers || strings); i++) {
+        item = sp->items[i];
+        if (ejsIs(ejs, item, Number)) {
+            n = ((EjsNumber*) item)->value;
+            if (!(n < SORT_MAX_INTEGER && n > -SORT_MAX_INTEGER) || n != (int64) n) {
+                integers = 0;
             }
-            order = ejsCompareString(ejs, sx, so);
+            strings = 0;
+        } else {
+            integers = 0;
+            if (!ejsIs(ejs, item, String)) {
+                strings = 0;
+            }
+        }
+    }
+    if (integers) {
+        sp->kind = SORT_INTEGERS;
+    } else if (strings) {
+        sp->kind = SORT_STRINGS;
+    } else {
+        sp->kind = SORT_KEYS;
+        if ((sp->keys = mprAllocZeroed(sp->length * sizeof(EjsAny*))) == 0) {
+            return MPR_ERR_MEMORY;
         }
-        order *= direction;
-        if (order > 0) {
-            j = j + 1;
-            tmp = array->data[j];
-            array->data[j] = array->data[i];
-            array->data[i] = tmp;
+        for (i = 0; i < sp->length; i++) {
+            if ((sp->keys[i] = ejsToString(ejs, sp->items[i])) == 0 || ejs->exception) {
+                return MPR_ERR_BAD_STATE;
+            }
         }
     }
-    array->data[r] = array->data[j + 1];
-    array->data[j + 1] = x;
-    return j + 1;
+    return 0;
 }
 
 
-PUBLIC void quickSort(Ejs *ejs, EjsArray *ap, EjsFunction *compare, int direction, int p, int r)
+static void sortArray(Ejs *ejs, EjsArray *ap, EjsFunction *compare, int direction)
 {
-    int     q;
+    ArraySort   *sp;
+    int         i, lo, width, length;
 
-    if (p < r && !ejs->exception) {
-        q = partition(ejs, ap, compare, direction, p, r);
-        quickSort(ejs, ap, compare, direction, p, q - 1);
-        quickSort(ejs, ap, compare, direction, q + 1, r);
+    length = ap->length;
+    if ((sp = mprAllocObj(ArraySort, manageArraySort)) == 0) {
+        return;
+    }
+    sp->ejs = ejs;
+    sp->array = ap;
+    sp->compare = compare;
+    sp->direction = (direction < 0) ? -1 : 1;
+    sp->length = length;
+    sp->items = mprMemdup(ap->data, length * sizeof(EjsAny*));
+    sp->order = mprAlloc(length * sizeof(int));
+    sp->merge = mprAlloc(length * sizeof(int));
+    if (sp->items == 0 || sp->order == 0 || sp->merge == 0) {
+        return;
+    }
+    /*
+        Computing keys and calling the compare function can run script code and garbage collect
+     */
+    mprAddRoot(sp);
+    if (prepareSort(sp) < 0) {
+        mprRemoveRoot(sp);
+        return;
     }
+    for (i = 0; i < length; i++) {
+        sp->order[i] = i;
+    }
+    for (lo = 0; lo < length && !ejs->exception; lo += SORT_RUN) {
+        insertionSort(sp, lo, min(lo + SORT_RUN, length));
+    }
+    for (width = SORT_RUN; width < length && !ejs->exception; width *= 2) {
+        for (lo = 0; lo < length - width && !ejs->exception; lo += 2 * width) {
+            mergeRuns(sp, lo, lo + width, min(lo + 2 * width, length));
+        }
+    }
+    /*
+        Only reorder if the sort completed and the compare function did not resize the array
+     */
+    if (!ejs->exception && ap->length == length) {
+        for (i = 0; i < length; i++) {
+            ap->data[i] = sp->items[sp->order[i]];
+        }
+    }
+    mprRemoveRoot(sp);
 }
 
 
@@ -1325,7 +1670,7 @@ PUBLIC EjsArray *ejsSortArray(Ejs *ejs, EjsArray *ap, int argc, EjsObj **argv)
         return 0;
     }
     direction = (argc >= 2) ? ejsGetInt(ejs, argv[1]) : 1;
-    quickSort(ejs, ap, compare, direction, 0, ap->length - 1);
+    sortArray(ejs, ap, compare, direction);
     return ap;
 }
 
@@ -1448,31 +1793,34 @@ static EjsString *toLocaleString(Ejs *ejs, EjsArray *ap, int argc, EjsObj **argv
  */
 static EjsString *arrayToString(Ejs *ejs, EjsArray *ap, int argc, EjsObj **argv)
 {
-    EjsString       *result, *comma;
-    EjsObj              *vp;
-    int             i, rc;
+    EjsString       *sp;
+    EjsObj          *vp;
+    MprBuf          *buf;
+    wchar           comma;
+    int             i;
 
-    result = ESV(empty);
-    if (result == 0) {
+    if (ap->length == 0) {
+        return ESV(empty);
+    }
+    /*
+        Catenate into a buffer rather than joining pair-wise which would copy the result for each element
+     */
+    if ((buf = mprCreateBuf(ap->length * 8 * sizeof(wchar), -1)) == 0) {
         ejsThrowMemoryError(ejs);
         return 0;
     }
-    comma = ejsCreateStringFromAsc(ejs, ",");
+    comma = ',';
     for (i = 0; i < ap->length; i++) {
         vp = ap->data[i];
-        rc = 0;
         if (i > 0) {
-            result = ejsJoinString(ejs, result, comma);
+            mprPutBlockToBuf(buf, (cchar*) &comma, sizeof(wchar));
         }
         if (ejsIsDefined(ejs, vp)) {
-            result = ejsJoinString(ejs, result, ejsToString(ejs, vp));
-        }
-        if (rc < 0) {
-            ejsThrowMemoryError(ejs);
-            return 0;
+            sp = ejsToString(ejs, vp);
+            mprPutBlockToBuf(buf, (cchar*) sp->value, sp->length * sizeof(wchar));
         }
     }
-    return result;
+    return ejsCreateString(ejs, (wchar*) mprGetBufStart(buf), mprGetBufLength(buf) / sizeof(wchar));
 }
 
 
@@ -1484,22 +1832,21 @@ static EjsString *arrayToString(Ejs *ejs, EjsArray *ap, int argc, EjsObj **argv)
  */
 static EjsArray *uniqueArray(Ejs *ejs, EjsArray *ap, int argc, EjsObj **argv)
 {
+    ArraySet    set;
     EjsObj      **data;
-    int     i, j, k;
+    int         i, k;
 
+    if (openArraySet(&set, ap->length) < 0) {
+        return ap;
+    }
     data = ap->data;
-
-    for (i = 0; i < ap->length; i++) {
-        for (j = i + 1; j < ap->length; j++) {
-            if (compareArrayElement(ejs, data[i], data[j])) {
-                for (k = j + 1; k < ap->length; k++) {
-                    data[k - 1] = data[k];
-                }
-                ap->length--;
-                j--;
-            }
+    for (i = k = 0; i < ap->length; i++) {
+        if (addArraySet(ejs, &set, data[i])) {
+            data[k++] = data[i];
         }
     }
+    ap->length = k;
+    closeArraySet(&set);
     return ap;
 }
 
@@ -84,7 +84,9 @@ PUBLIC EjsFrame *ejsCreateFrame(Ejs *ejs, EjsFunction *fun, EjsObj *thisObj, int
         //  OPT -- could the function be setup as the prototype and thus avoid doing this?
         //  OPT -- assumes that the function is sealed
         memcpy(obj->properties->slots, activation->properties->slots, numProp * sizeof(EjsSlot));
-        ejsIndexProperties(ejs, obj);
+        if (!ejsSharePotHash(ejs, obj, activation)) {
+            ejsIndexProperties(ejs, obj);
+        }
     }
     ejsZeroSlots(ejs, &obj->properties->slots[numProp], size - numProp);
     //  OPT - should not need to do this
@@ -375,6 +375,12 @@ static void manageCode(EjsCode *code, int flags)
                 mprMark(code->handlers[i]);
             }
         }
+        if (code->sites) {
+            mprMark((void*) code->sites);
+            for (i = 0; i < code->numSites; i++) {
+                mprMark(code->sites[i]);
+            }
+        }
     }
 }
 
@@ -383,6 +389,7 @@ PUBLIC EjsCode *ejsCreateCode(Ejs *ejs, EjsFunction *fun, EjsModule *module, cuc
     EjsDebug *debug)
 {
     EjsCode     *code;
+    bool        shared;
 
     assert(fun);
     assert(module);
@@ -390,7 +397,12 @@ PUBLIC EjsCode *ejsCreateCode(Ejs *ejs, EjsFunction *fun, EjsModule *module, cuc
     assert(len >= 0);
     assert(debug == 0 || debug->magic == EJS_DEBUG_MAGIC);
 
-    if ((code = mprAllocBlock(sizeof(EjsCode) + len, MPR_ALLOC_ZERO | MPR_ALLOC_MANAGER)) == 0) {
+    /*
+        Byte code in a module file mapping is never modified, so it is shared rather than copied. The code references
+        the module which holds the mapping.
+     */
+    shared = ejsIsMapped(module->map, byteCode, len);
+    if ((code = mprAllocBlock(sizeof(EjsCode) + (shared ? 0 : len), MPR_ALLOC_ZERO | MPR_ALLOC_MANAGER)) == 0) {
         return NULL;
     }
     mprSetManager(code, (MprManager) manageCode);
@@ -398,7 +410,12 @@ PUBLIC EjsCode *ejsCreateCode(Ejs *ejs, EjsFunction *fun, EjsModule *module, cuc
     code->module = module;
     code->debug = debug;
     code->magic = EJS_CODE_MAGIC;
-    memcpy(code->byteCode, byteCode, len);
+    if (shared) {
+        code->byteCode = (uchar*) byteCode;
+    } else {
+        code->byteCode = code->storage;
+        memcpy(code->byteCode, byteCode, len);
+    }
     return code;
 }
 
@@ -66,7 +66,7 @@ static EjsObj *gc_set_newQuota(Ejs *ejs, EjsObj *thisObj, int argc, EjsObj **arg
         ejsThrowArgError(ejs, "Bad work quota. Must be > 1024");
         return 0;
     }
-    mprGetMpr()->heap->workQuota = quota;
+    mprGetMpr()->heap->workQuota = mprGetMpr()->heap->workBase = quota;
     return 0;
 }
 
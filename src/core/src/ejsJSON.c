@@ -10,11 +10,15 @@
 
 /*********************************** Locals ***********************************/
 
+#define JSON_MAX_LAYOUT 8               /* Nesting levels that remember the last object parsed */
+
 typedef struct JsonState {
     wchar      *data;
     wchar      *end;
     wchar      *next;
     wchar      *error;
+    EjsPot     **layouts;               /* Last object parsed at each nest level */
+    int        depth;                   /* Current nest level */
 } JsonState;
 
 typedef struct Json {
@@ -68,6 +72,7 @@ static EjsString *g_serialize(Ejs *ejs, EjsObj *unused, int argc, EjsObj **argv)
 PUBLIC EjsAny *ejsDeserialize(Ejs *ejs, EjsString *str)
 {
     EjsObj      *obj;
+    EjsPot      *layouts[JSON_MAX_LAYOUT];
     JsonState   js;
 
     if (!ejsIs(ejs, str, String)) {
@@ -80,6 +85,9 @@ PUBLIC EjsAny *ejsDeserialize(Ejs *ejs, EjsString *str)
     js.next = js.data = str->value;
     js.end = &js.data[str->length];
     js.error = 0;
+    js.layouts = layouts;
+    js.depth = 0;
+    memset(layouts, 0, sizeof(layouts));
     if ((obj = parseLiteral(ejs, &js)) == 0) {
         if (js.error) {
             ejsThrowSyntaxError(ejs, 
@@ -101,9 +109,14 @@ PUBLIC EjsAny *ejsDeserialize(Ejs *ejs, EjsString *str)
 
 static EjsObj *parseLiteral(Ejs *ejs, JsonState *js)
 {
+    EjsObj      *obj;
+
     assert(js);
 
-    return parseLiteralInner(ejs, mprCreateBuf(0, 0), js);
+    js->depth++;
+    obj = parseLiteralInner(ejs, mprCreateBuf(0, 0), js);
+    js->depth--;
+    return obj;
 }
 
 
@@ -315,14 +328,54 @@ Token peekNextJsonToken(JsonState *js)
     Parse an object literal string pointed to by js->next into the given buffer. Update js->next to point
     to the next input token in the object literal. Supports nested object literals.
  */
+/*
+    Test if a key matches the name of a layout property
+ */
+static bool matchLayout(Ejs *ejs, EjsPot *layout, int slotNum, wchar *key)
+{
+    EjsName     *qname;
+
+    if (slotNum >= layout->numProp) {
+        return 0;
+    }
+    qname = &layout->properties->slots[slotNum].qname;
+    return qname->name && qname->space == ESV(empty) && wcmp(qname->name->value, key) == 0;
+}
+
+
+/*
+    Name the first slots of an object that followed a layout before it diverged
+ */
+static int nameLayoutSlots(Ejs *ejs, EjsAny *obj, EjsPot *layout, int count)
+{
+    int     i;
+
+    for (i = 0; i < count; i++) {
+        if (ejsSetPropertyName(ejs, obj, i, layout->properties->slots[i].qname) < 0) {
+            return EJS_ERR;
+        }
+    }
+    return 0;
+}
+
+
+/*
+    Objects are compared with the last object parsed at the same nest level (the layout). While the keys match the
+    layout names, only the values are stored. If all keys match, the object takes the layout names and shares its name
+    hash. Otherwise the names are set and hashed as usual. This avoids interning and hashing the keys of each record.
+ */
 static EjsObj *parseLiteralInner(Ejs *ejs, MprBuf *buf, JsonState *js)
 {
     EjsAny      *obj, *vp;
+    EjsPot      *layout;
     MprBuf      *valueBuf;
     wchar       *token, *key, *value;
-    int         tid, isArray;
+    int         tid, isArray, level, slotNum;
 
     isArray = 0;
+    layout = 0;
+    slotNum = 0;
+    level = js->depth - 1;
 
     tid = getNextJsonToken(buf, &token, js);
     if (tid == TOK_ERR || tid == TOK_EOF) {
@@ -333,6 +386,9 @@ static EjsObj *parseLiteralInner(Ejs *ejs, MprBuf *buf, JsonState *js)
         obj = (EjsObj*) ejsCreateArray(ejs, 0);
     } else if (tid == TOK_LBRACE) {
         obj = ejsCreateEmptyPot(ejs);
+        if (level < JSON_MAX_LAYOUT) {
+            layout = js->layouts[level];
+        }
     } else {
         return ejsParse(ejs, token, S_String);
     }
@@ -406,13 +462,41 @@ static EjsObj *parseLiteralInner(Ejs *ejs, MprBuf *buf, JsonState *js)
                 ejsThrowMemoryError(ejs);
                 return 0;
             }
+        } else if (layout && matchLayout(ejs, layout, slotNum, key)) {
+            if (ejsSetProperty(ejs, obj, slotNum++, vp) < 0) {
+                ejsThrowMemoryError(ejs);
+                return 0;
+            }
         } else {
+            if (layout) {
+                if (nameLayoutSlots(ejs, obj, layout, slotNum) < 0) {
+                    ejsThrowMemoryError(ejs);
+                    return 0;
+                }
+                layout = 0;
+            }
             if (ejsSetPropertyByName(ejs, obj, WEN(key), vp) < 0) {
                 ejsThrowMemoryError(ejs);
                 return 0;
             }
         }
     }
+    if (layout) {
+        if (slotNum == layout->numProp) {
+            if (ejsSetPotLayout(ejs, obj, layout) < 0) {
+                ejsThrowMemoryError(ejs);
+                return 0;
+            }
+            return obj;
+        }
+        if (nameLayoutSlots(ejs, obj, layout, slotNum) < 0) {
+            ejsThrowMemoryError(ejs);
+            return 0;
+        }
+    }
+    if (!isArray && level < JSON_MAX_LAYOUT && ((EjsPot*) obj)->numProp > 0) {
+        js->layouts[level] = obj;
+    }
     return obj;
 }
 
@@ -13,18 +13,54 @@
 //  TODO - should this be refactored to use MprCache?
 
 #define CACHE_TIMER_PERIOD  (60 * TPS)
-#define CACHE_HASH_SIZE     257
+#define CACHE_HASH_SIZE     31
 #define CACHE_LIFESPAN      (86400 * TPS)
+#define CACHE_SHARDS        16          /* Lock stripes. Must be a power of 2 */
+#define CACHE_WHEEL         64          /* Expiry wheel slots. Each slot spans one pruner resolution period */
+
+typedef struct CacheItem
+{
+    EjsString   *key;                   /* Original key */
+    EjsString   *data;                  /* Cache data */
+    MprTime     expires;                /* Fixed expiry date. If zero, key is imortal. */
+    MprTicks    lifespan;               /* Lifespan after each access to key (msec) */
+    int64       version;
+    struct CacheItem *prev;             /* LRU list. Most recently used at the head */
+    struct CacheItem *next;
+    struct CacheItem *wprev;            /* Expiry wheel slot list */
+    struct CacheItem *wnext;
+    int         slot;                   /* Expiry wheel slot or -1 */
+} CacheItem;
+
+/*
+    Keys are striped over shards by key hash. Each shard has its own lock, store, LRU list and expiry wheel.
+    Items are owned by the store. The list links are not marked and must be unlinked when a key is removed.
+ */
+typedef struct CacheShard
+{
+    MprMutex        *mutex;             /* Shard lock */
+    MprHash         *store;             /* Key/value store */
+    CacheItem       *head;              /* Most recently used item */
+    CacheItem       *tail;              /* Least recently used item */
+    CacheItem       *wheel[CACHE_WHEEL];/* Items by expiry period */
+    MprTime         pruned;             /* Last expiry period pruned */
+    int64           hits;               /* Reads that found a live key */
+    int64           misses;             /* Reads of missing or expired keys */
+    int64           evictions;          /* Keys removed to satisfy the key or memory limits */
+    int64           expired;            /* Keys removed because they expired */
+} CacheShard;
 
 typedef struct EjsLocalCache
 {
     EjsObj          obj;                /* Object base */
-    MprHash         *store;             /* Key/value store */
-    MprMutex        *mutex;             /* Cache lock */
+    CacheShard      *shards[CACHE_SHARDS];
+    MprMutex        *mutex;             /* Lock for the pruner timer */
     MprEvent        *timer;             /* Pruning timer */
     MprTicks        lifespan;           /* Default lifespan (msec) */
     int             resolution;         /* Frequence for pruner */
-    ssize           usedMem;            /* Memory in use for keys and data */
+    int             nextShard;          /* Shard to start limit pruning */
+    volatile int64  usedMem;            /* Memory in use for keys and data */
+    volatile int64  numKeys;            /* Number of keys in all shards */
     ssize           maxKeys;            /* Max number of keys */
     ssize           maxMem;             /* Max memory for session data */
     struct EjsLocalCache *shared;       /* Shared common cache */
@@ -32,24 +68,204 @@ typedef struct EjsLocalCache
 
 static EjsLocalCache *shared;           /* Singleton shared cache */
 
-typedef struct CacheItem
-{
-    EjsString   *key;                   /* Original key */
-    EjsString   *data;                  /* Cache data */
-    MprTime     expires;                /* Fixed expiry date. If zero, key is imortal. */
-    MprTicks    lifespan;               /* Lifespan after each access to key (msec) */
-    int64       version;
-} CacheItem;
-
 /*********************************** Forwards *********************************/
 
 static void localPruner(EjsLocalCache *cache, MprEvent *event);
-static void manageLocalCache(EjsLocalCache *cache, int flags);
 static void manageCacheItem(CacheItem *item, int flags);
-static void removeItem(EjsLocalCache *cache, CacheItem *item);
+static void manageCacheShard(CacheShard *shard, int flags);
+static void manageLocalCache(EjsLocalCache *cache, int flags);
+static void removeItem(EjsLocalCache *cache, CacheShard *shard, CacheItem *item);
 static void setLocalLimits(Ejs *ejs, EjsLocalCache *cache, EjsPot *options);
 
 /************************************* Code ***********************************/
+
+static int createShards(EjsLocalCache *cache)
+{
+    CacheShard  *shard;
+    int         i;
+
+    for (i = 0; i < CACHE_SHARDS; i++) {
+        if ((shard = mprAllocObj(CacheShard, manageCacheShard)) == 0) {
+            return MPR_ERR_MEMORY;
+        }
+        shard->mutex = mprCreateLock();
+        shard->store = mprCreateHash(CACHE_HASH_SIZE, 0);
+        shard->pruned = mprGetTime() / cache->resolution;
+        cache->shards[i] = shard;
+    }
+    return 0;
+}
+
+
+static CacheShard *getShard(EjsLocalCache *cache, EjsString *key)
+{
+    //  UNICODE
+    return cache->shards[shash(key->value, key->length) & (CACHE_SHARDS - 1)];
+}
+
+
+static void unlinkItem(CacheShard *shard, CacheItem *item)
+{
+    if (item->prev) {
+        item->prev->next = item->next;
+    } else {
+        shard->head = item->next;
+    }
+    if (item->next) {
+        item->next->prev = item->prev;
+    } else {
+        shard->tail = item->prev;
+    }
+    item->prev = item->next = 0;
+}
+
+
+/*
+    Move (or add) an item to the head of the LRU list
+ */
+static void touchItem(CacheShard *shard, CacheItem *item)
+{
+    if (shard->head == item) {
+        return;
+    }
+    if (item->prev || item->next || shard->tail == item) {
+        unlinkItem(shard, item);
+    }
+    item->next = shard->head;
+    if (shard->head) {
+        shard->head->prev = item;
+    }
+    shard->head = item;
+    if (shard->tail == 0) {
+        shard->tail = item;
+    }
+}
+
+
+static void unwheelItem(CacheShard *shard, CacheItem *item)
+{
+    if (item->slot < 0) {
+        return;
+    }
+    if (item->wprev) {
+        item->wprev->wnext = item->wnext;
+    } else {
+        shard->wheel[item->slot] = item->wnext;
+    }
+    if (item->wnext) {
+        item->wnext->wprev = item->wprev;
+    }
+    item->wprev = item->wnext = 0;
+    item->slot = -1;
+}
+
+
+/*
+    File an item in the expiry wheel slot for the period in which it expires. Slots are reused every CACHE_WHEEL periods,
+    so the pruner only removes items in a slot that have actually expired.
+ */
+static void wheelItem(EjsLocalCache *cache, CacheShard *shard, CacheItem *item)
+{
+    unwheelItem(shard, item);
+    if (item->expires) {
+        item->slot = (int) ((item->expires / cache->resolution) % CACHE_WHEEL);
+        item->wnext = shard->wheel[item->slot];
+        if (item->wnext) {
+            item->wnext->wprev = item;
+        }
+        shard->wheel[item->slot] = item;
+    }
+}
+
+
+/*
+    Re-file all items after the pruner resolution changes. Expired items are removed on the way.
+ */
+static void rewheelShard(EjsLocalCache *cache, CacheShard *shard)
+{
+    CacheItem   *item, *next;
+    MprTime     when;
+
+    when = mprGetTime();
+    lock(shard);
+    memset(shard->wheel, 0, sizeof(shard->wheel));
+    for (item = shard->head; item; item = next) {
+        next = item->next;
+        item->slot = -1;
+        item->wprev = item->wnext = 0;
+        if (item->expires && item->expires <= when) {
+            removeItem(cache, shard, item);
+            shard->expired++;
+        } else {
+            wheelItem(cache, shard, item);
+        }
+    }
+    shard->pruned = when / cache->resolution;
+    unlock(shard);
+}
+
+
+/*
+    Evict least recently used keys from a shard while the cache exceeds its key or memory limits. The keep item is not
+    evicted. Must be called with the shard locked.
+ */
+static void evictItems(EjsLocalCache *cache, CacheShard *shard, CacheItem *keep)
+{
+    CacheItem   *item;
+
+    while ((cache->numKeys > cache->maxKeys || cache->usedMem > cache->maxMem) && (item = shard->tail) != 0 && 
+            item != keep) {
+        mprDebug("ejs cache", 5, "LocalCache too big, keys %Ld, mem %Ld, evict key %s", cache->numKeys, cache->usedMem, 
+            item->key->value);
+        removeItem(cache, shard, item);
+        shard->evictions++;
+    }
+}
+
+
+/*
+    Evict from other shards if the writing shard could not free enough. Shards are visited from a rotating start so
+    eviction is spread over the cache. If wait is false, busy shards are skipped.
+ */
+static void trimCache(EjsLocalCache *cache, CacheItem *keep, int wait)
+{
+    CacheShard  *shard;
+    int         i;
+
+    for (i = 0; i < CACHE_SHARDS; i++) {
+        if (cache->numKeys <= cache->maxKeys && cache->usedMem <= cache->maxMem) {
+            break;
+        }
+        shard = cache->shards[(cache->nextShard + i) & (CACHE_SHARDS - 1)];
+        if (wait) {
+            mprLock(shard->mutex);
+        } else if (!mprTryLock(shard->mutex)) {
+            continue;
+        }
+        evictItems(cache, shard, keep);
+        mprUnlock(shard->mutex);
+    }
+    cache->nextShard++;
+}
+
+
+static void startPruner(EjsLocalCache *cache)
+{
+    if (cache->timer == 0) {
+        lock(cache);
+        if (cache->timer == 0) {
+            mprDebug("ejs cache", 5, "Start LocalCache pruner with resolution %d", cache->resolution);
+            /* 
+                Use the MPR dispatcher incase this VM is destroyed 
+             */
+            cache->timer = mprCreateTimerEvent(MPR->dispatcher, "localCacheTimer", cache->resolution, localPruner, 
+                cache, MPR_EVENT_STATIC_DATA); 
+        }
+        unlock(cache);
+    }
+}
+
+
 /*
    function Local(options)
  */
@@ -65,11 +281,14 @@ static EjsLocalCache *localConstructor(Ejs *ejs, EjsLocalCache *cache, int argc,
         cache->shared = shared;
     } else {
         cache->mutex = mprCreateLock();
-        cache->store = mprCreateHash(CACHE_HASH_SIZE, 0);
         cache->maxMem = MAXSSIZE;
         cache->maxKeys = MAXSSIZE;
         cache->resolution = CACHE_TIMER_PERIOD;
         cache->lifespan = CACHE_LIFESPAN;
+        if (createShards(cache) < 0) {
+            ejsThrowMemoryError(ejs);
+            return 0;
+        }
         setLocalLimits(ejs, cache, options);
         if (wantShared) {
             shared = cache;
@@ -99,6 +318,7 @@ static EjsAny *sl_expire(Ejs *ejs, EjsLocalCache *cache, int argc, EjsAny **argv
 {
     EjsString   *key;
     EjsDate     *expires;
+    CacheShard  *shard;
     CacheItem   *item;
 
     if (cache->shared) {
@@ -107,20 +327,22 @@ static EjsAny *sl_expire(Ejs *ejs, EjsLocalCache *cache, int argc, EjsAny **argv
     }
     key = argv[0];
     expires = argv[1];
+    shard = getShard(cache, key);
 
-    lock(cache);
+    lock(shard);
     //  UNICODE
-    if ((item = mprLookupKey(cache->store, key->value)) == 0) {
-        unlock(cache);
+    if ((item = mprLookupKey(shard->store, key->value)) == 0) {
+        unlock(shard);
         return ESV(false);
     }
     item->lifespan = 0;
     if (expires == ESV(null)) {
-        removeItem(cache, item);
+        removeItem(cache, shard, item);
     } else {
         item->expires = ejsGetDate(ejs, expires);
+        wheelItem(cache, shard, item);
     }
-    unlock(cache);
+    unlock(shard);
     return ESV(true);
 }
 
@@ -130,7 +352,8 @@ static EjsAny *sl_expire(Ejs *ejs, EjsLocalCache *cache, int argc, EjsAny **argv
  */
 static EjsAny *sl_inc(Ejs *ejs, EjsLocalCache *cache, int argc, EjsAny **argv)
 {
-    EjsString   *key;
+    EjsString   *key, *result;
+    CacheShard  *shard;
     CacheItem   *item;
     int64       amount;
 
@@ -140,27 +363,40 @@ static EjsAny *sl_inc(Ejs *ejs, EjsLocalCache *cache, int argc, EjsAny **argv)
     }
     key = argv[0];
     amount = (argc >= 2) ? ejsGetInt(ejs, argv[1]) : 1;
+    shard = getShard(cache, key);
 
-    lock(cache);
+    lock(shard);
     //  UNICODE
-    if ((item = mprLookupKey(cache->store, key->value)) == 0) {
+    if ((item = mprLookupKey(shard->store, key->value)) == 0) {
         if ((item = mprAllocObj(CacheItem, manageCacheItem)) == 0) {
-            unlock(cache);
+            unlock(shard);
             ejsThrowMemoryError(ejs);
             return 0;
         }
+        item->key = key;
+        item->slot = -1;
+        item->lifespan = cache->lifespan;
+        mprAddKey(shard->store, key->value, item);
+        mprAtomicAdd64(&cache->numKeys, 1);
+        mprAtomicAdd64(&cache->usedMem, key->length);
     } else {
         amount += stoi(item->data->value);
-    }
-    if (item->data) {
-        cache->usedMem -= item->data->length;
+        mprAtomicAdd64(&cache->usedMem, -item->data->length);
     }
     item->data = ejsCreateStringFromAsc(ejs, itos(amount));
-    cache->usedMem += item->data->length;
-    item->expires = mprGetTime() + item->lifespan;
+    mprAtomicAdd64(&cache->usedMem, item->data->length);
+    if (item->lifespan) {
+        item->expires = mprGetTime() + item->lifespan;
+        wheelItem(cache, shard, item);
+    }
     item->version++;
-    unlock(cache);
-    return item->data;
+    touchItem(shard, item);
+    evictItems(cache, shard, item);
+    result = item->data;
+    unlock(shard);
+    trimCache(cache, item, 1);
+    startPruner(cache);
+    return result;
 }
 
 
@@ -194,6 +430,7 @@ static EjsAny *sl_read(Ejs *ejs, EjsLocalCache *cache, int argc, EjsAny **argv)
     EjsString   *key;
     EjsAny      *result;
     EjsPot      *options;
+    CacheShard  *shard;
     CacheItem   *item;
     int         getVersion;
 
@@ -208,16 +445,23 @@ static EjsAny *sl_read(Ejs *ejs, EjsLocalCache *cache, int argc, EjsAny **argv)
         options = argv[1];
         getVersion = ejsGetPropertyByName(ejs, options, EN("version")) == ESV(true);
     }
-    lock(cache);
+    shard = getShard(cache, key);
+    lock(shard);
     //  UNICODE
-    if ((item = mprLookupKey(cache->store, key->value)) == 0) {
-        unlock(cache);
+    if ((item = mprLookupKey(shard->store, key->value)) == 0) {
+        shard->misses++;
+        unlock(shard);
         return ESV(null);
     }
     if (item->expires && item->expires <= mprGetTime()) {
-        unlock(cache);
+        removeItem(cache, shard, item);
+        shard->expired++;
+        shard->misses++;
+        unlock(shard);
         return ESV(null);
     }
+    shard->hits++;
+    touchItem(shard, item);
 #if UNUSED && FUTURE
     //  TODO - should reading refresh cache
     //  Perhaps option "read-refresh"
@@ -232,7 +476,7 @@ static EjsAny *sl_read(Ejs *ejs, EjsLocalCache *cache, int argc, EjsAny **argv)
     } else {
         result = item->data;
     }
-    unlock(cache);
+    unlock(shard);
     return result;
 }
 
@@ -244,31 +488,40 @@ static EjsBoolean *sl_remove(Ejs *ejs, EjsLocalCache *cache, int argc, EjsAny **
 {
     EjsString   *key;
     EjsAny      *result;
+    CacheShard  *shard;
     CacheItem   *item;
+    int         i;
 
     if (cache->shared) {
         cache = cache->shared;
         assert(cache == shared);
     }
     key = argv[0];
-    lock(cache);
     if (ejsIsDefined(ejs, key)) {
+        shard = getShard(cache, key);
+        lock(shard);
         //  UNICODE
-        if ((item = mprLookupKey(cache->store, key->value)) != 0) {
-            cache->usedMem -= (key->length + item->data->length);
-            mprRemoveKey(cache->store, key->value);
+        if ((item = mprLookupKey(shard->store, key->value)) != 0) {
+            removeItem(cache, shard, item);
             result = ESV(true);
         } else {
             result = ESV(false);
         }
+        unlock(shard);
 
     } else {
         /* Remove all keys */
-        result = mprGetHashLength(cache->store) ? ESV(true) : ESV(false);
-        cache->store = mprCreateHash(CACHE_HASH_SIZE, 0);
-        cache->usedMem = 0;
+        result = ESV(false);
+        for (i = 0; i < CACHE_SHARDS; i++) {
+            shard = cache->shards[i];
+            lock(shard);
+            while ((item = shard->head) != 0) {
+                removeItem(cache, shard, item);
+                result = ESV(true);
+            }
+            unlock(shard);
+        }
     }
-    unlock(cache);
     return result;
 }
 
@@ -276,6 +529,7 @@ static EjsBoolean *sl_remove(Ejs *ejs, EjsLocalCache *cache, int argc, EjsAny **
 static void setLocalLimits(Ejs *ejs, EjsLocalCache *cache, EjsPot *options)
 {
     EjsAny      *vp;
+    int         i, resolution;
 
     if (!options) {
         return;
@@ -300,9 +554,15 @@ static void setLocalLimits(Ejs *ejs, EjsLocalCache *cache, EjsPot *options)
         }
     }
     if ((vp = ejsGetPropertyByName(ejs, options, EN("resolution"))) != 0) {
-        cache->resolution = ejsGetInt(ejs, vp);
-        if (cache->resolution <= 0) {
-            cache->resolution = CACHE_TIMER_PERIOD;
+        resolution = ejsGetInt(ejs, vp);
+        if (resolution <= 0) {
+            resolution = CACHE_TIMER_PERIOD;
+        }
+        if (resolution != cache->resolution) {
+            cache->resolution = resolution;
+            for (i = 0; i < CACHE_SHARDS; i++) {
+                rewheelShard(cache, cache->shards[i]);
+            }
         }
     }
 }
@@ -318,15 +578,52 @@ static EjsVoid *sl_setLimits(Ejs *ejs, EjsLocalCache *cache, int argc, EjsAny **
         assert(cache == shared);
     }
     setLocalLimits(ejs, cache, argv[0]);
+    trimCache(cache, 0, 1);
     return 0;
 }
 
 
+/*
+    function get stats(): Object
+ */
+static EjsPot *sl_stats(Ejs *ejs, EjsLocalCache *cache, int argc, EjsObj **argv)
+{
+    EjsPot      *result;
+    CacheShard  *shard;
+    int64       hits, misses, evictions, expired;
+    int         i;
+
+    if (cache->shared) {
+        cache = cache->shared;
+        assert(cache == shared);
+    }
+    hits = misses = evictions = expired = 0;
+    for (i = 0; i < CACHE_SHARDS; i++) {
+        shard = cache->shards[i];
+        lock(shard);
+        hits += shard->hits;
+        misses += shard->misses;
+        evictions += shard->evictions;
+        expired += shard->expired;
+        unlock(shard);
+    }
+    result = ejsCreateEmptyPot(ejs);
+    ejsSetPropertyByName(ejs, result, EN("evictions"), ejsCreateNumber(ejs, (MprNumber) evictions));
+    ejsSetPropertyByName(ejs, result, EN("expired"), ejsCreateNumber(ejs, (MprNumber) expired));
+    ejsSetPropertyByName(ejs, result, EN("hits"), ejsCreateNumber(ejs, (MprNumber) hits));
+    ejsSetPropertyByName(ejs, result, EN("keys"), ejsCreateNumber(ejs, (MprNumber) cache->numKeys));
+    ejsSetPropertyByName(ejs, result, EN("memory"), ejsCreateNumber(ejs, (MprNumber) cache->usedMem));
+    ejsSetPropertyByName(ejs, result, EN("misses"), ejsCreateNumber(ejs, (MprNumber) misses));
+    return result;
+}
+
+
 /*
     function write(key: String~, value: String~, options: Object = null): Number
  */
 static EjsNumber *sl_write(Ejs *ejs, EjsLocalCache *cache, int argc, EjsAny **argv)
 {
+    CacheShard  *shard;
     CacheItem   *item;
     EjsString   *key, *value, *sp;
     EjsPot      *options;
@@ -376,37 +673,39 @@ static EjsNumber *sl_write(Ejs *ejs, EjsLocalCache *cache, int argc, EjsAny **ar
             checkVersion = 1;
         }
     }
-    lock(cache);
-    if ((kp = mprLookupKeyEntry(cache->store, key->value)) != 0) {
+    shard = getShard(cache, key);
+    lock(shard);
+    if ((kp = mprLookupKeyEntry(shard->store, key->value)) != 0) {
         exists++;
         item = (CacheItem*) kp->data;
         if (checkVersion) {
             if (item->version != version) {
-                unlock(cache);
+                unlock(shard);
                 if (throw) {
                     ejsThrowStateError(ejs, "Key version does not match");
                 }
                 return ESV(null);
             }
         }
+        if (add) {
+            unlock(shard);
+            return ESV(null);
+        }
     } else {
         if ((item = mprAllocObj(CacheItem, manageCacheItem)) == 0) {
-            unlock(cache);
+            unlock(shard);
             ejsThrowMemoryError(ejs);
             return 0;
         }
         //  UNICODE
-        mprAddKey(cache->store, key->value, item);
+        mprAddKey(shard->store, key->value, item);
+        mprAtomicAdd64(&cache->numKeys, 1);
         set = 1;
         item->key = key;
+        item->slot = -1;
     }
     oldLen = (item->data) ? (item->key->length + item->data->length) : 0;
-    if (set) {
-        item->data = value;
-    } else if (add) {
-        if (exists) {
-            return ESV(null);
-        }
+    if (set || add) {
         item->data = value;
     } else if (append) {
         item->data = ejsJoinString(ejs, item->data, value);
@@ -426,98 +725,98 @@ static EjsNumber *sl_write(Ejs *ejs, EjsLocalCache *cache, int argc, EjsAny **ar
     }
     item->version++;
     len = item->key->length + item->data->length;
+    mprAtomicAdd64(&cache->usedMem, len - oldLen);
 
-    cache->usedMem += (len - oldLen);
+    wheelItem(cache, shard, item);
+    touchItem(shard, item);
+    evictItems(cache, shard, item);
+    unlock(shard);
 
-    if (cache->timer == 0) {
-        mprDebug("ejs cache", 5, "Start LocalCache pruner with resolution %d", cache->resolution);
-        /* 
-            Use the MPR dispatcher incase this VM is destroyed 
-         */
-        cache->timer = mprCreateTimerEvent(MPR->dispatcher, "localCacheTimer", cache->resolution, localPruner, cache, 
-            MPR_EVENT_STATIC_DATA); 
-    }
-    unlock(cache);
+    trimCache(cache, item, 1);
+    startPruner(cache);
     //  UNICODE
     return ejsCreateNumber(ejs, (MprNumber) len);
 }
 
 
-static void removeItem(EjsLocalCache *cache, CacheItem *item)
+/*
+    Remove an item from the store and its shard lists. Must be called with the shard locked.
+ */
+static void removeItem(EjsLocalCache *cache, CacheShard *shard, CacheItem *item)
 {
-    lock(cache);
     //UNICODE
-    mprRemoveKey(cache->store, item->key->value);
-    cache->usedMem -= (item->key->length + item->data->length);
-    unlock(cache);
+    mprRemoveKey(shard->store, item->key->value);
+    unlinkItem(shard, item);
+    unwheelItem(shard, item);
+    mprAtomicAdd64(&cache->numKeys, -1);
+    mprAtomicAdd64(&cache->usedMem, -(item->key->length + (item->data ? item->data->length : 0)));
 }
 
 
 /*
-    Check for expired keys
+    Remove expired keys from the wheel slots of the periods that have fully elapsed since the last prune
  */
-static void localPruner(EjsLocalCache *cache, MprEvent *event)
+static void pruneShard(EjsLocalCache *cache, CacheShard *shard, MprTime when)
 {
-    MprTime         when, factor;
-    MprKey          *kp;
-    CacheItem       *item;
-    ssize           excessKeys;
-
-    if (mprTryLock(cache->mutex)) {
-        when = mprGetTime();
-        /*
-            Prune keys expiring first.
-         */
-        for (kp = 0; (kp = mprGetNextKey(cache->store, kp)) != 0; ) {
-            item = (CacheItem*) kp->data;
-#if KEEP
-            mprDebug("ejs cache", 6, "LocalCache: \"%@\" lifespan %d, expires in %d secs", item->key, 
-                    item->lifespan / 1000, (item->expires - when) / 1000);
-#endif
-            if (item->expires && item->expires <= when) {
-                mprDebug("ejs cache", 5, "LocalCache prune expired key %s", kp->key);
-                removeItem(cache, item);
-            }
-        }
-        assert(cache->usedMem >= 0);
-
-        /*
-            If too many keys or too much memory used. Prune oldest first.
-         */
-        if (cache->maxKeys < MAXSSIZE || cache->maxMem < MAXSSIZE) {
-            excessKeys = mprGetHashLength(cache->store) - cache->maxKeys;
-            for (factor = 3600; factor < (86400 * 1000); factor *= 4) {
-                if (excessKeys > 0 || cache->usedMem > cache->maxMem) {
-                    for (kp = 0; (kp = mprGetNextKey(cache->store, kp)) != 0; ) {
-                        item = (CacheItem*) kp->data;
-                        if (item->expires && item->expires <= when) {
-                            mprDebug("ejs cache", 5, "LocalCache too big execess keys %Ld, mem %Ld, prune key %s", 
-                                    excessKeys, (cache->maxMem - cache->usedMem), kp->key);
-                            removeItem(cache, item);
-                            excessKeys--;
-                        }
-                    }
-                    when += factor;
-                } else {
-                    break;
-                }
+    CacheItem   *item, *next;
+    MprTime     period, last;
+
+    last = when / cache->resolution;
+    period = ((last - shard->pruned) <= CACHE_WHEEL) ? shard->pruned : (last - CACHE_WHEEL);
+    for (; period < last; period++) {
+        for (item = shard->wheel[period % CACHE_WHEEL]; item; item = next) {
+            next = item->wnext;
+            if (item->expires <= when) {
+                mprDebug("ejs cache", 5, "LocalCache prune expired key %s", item->key->value);
+                removeItem(cache, shard, item);
+                shard->expired++;
             }
         }
-        assert(cache->usedMem >= 0);
+    }
+    shard->pruned = last;
+}
 
-        if (mprGetHashLength(cache->store) == 0) {
-            mprRemoveEvent(event);
-            cache->timer = 0;
+
+/*
+    Check for expired keys. Shards that are busy are skipped and pruned on the next tick.
+ */
+static void localPruner(EjsLocalCache *cache, MprEvent *event)
+{
+    CacheShard  *shard;
+    MprTime     when;
+    int         i;
+
+    when = mprGetTime();
+    for (i = 0; i < CACHE_SHARDS; i++) {
+        shard = cache->shards[i];
+        if (mprTryLock(shard->mutex)) {
+            pruneShard(cache, shard, when);
+            mprUnlock(shard->mutex);
         }
-        unlock(cache);
     }
+    /*
+        If too many keys or too much memory used, evict least recently used keys
+     */
+    trimCache(cache, 0, 0);
+    assert(cache->usedMem >= 0);
+
+    lock(cache);
+    if (cache->numKeys == 0) {
+        mprRemoveEvent(event);
+        cache->timer = 0;
+    }
+    unlock(cache);
 }
 
 
 static void manageLocalCache(EjsLocalCache *cache, int flags) 
 {
+    int     i;
+
     if (flags & MPR_MANAGE_MARK) {
-        mprMark(cache->store);
+        for (i = 0; i < CACHE_SHARDS; i++) {
+            mprMark(cache->shards[i]);
+        }
         mprMark(cache->mutex);
         mprMark(cache->timer);
         mprMark(cache->shared);
@@ -530,6 +829,15 @@ static void manageLocalCache(EjsLocalCache *cache, int flags)
 }
 
 
+static void manageCacheShard(CacheShard *shard, int flags) 
+{
+    if (flags & MPR_MANAGE_MARK) {
+        mprMark(shard->mutex);
+        mprMark(shard->store);
+    }
+}
+
+
 static void manageCacheItem(CacheItem *item, int flags) 
 {
     if (flags & MPR_MANAGE_MARK) {
@@ -551,15 +859,16 @@ static EjsLocalCache *cloneLocalCache(Ejs *ejs, EjsLocalCache *src, bool deep)
     } else if (src == shared) {
         dest->shared = src;
     } else {
-        dest->store = mprCreateHash(CACHE_HASH_SIZE, 0);
         dest->mutex = mprCreateLock();
         dest->timer = 0;
         dest->lifespan = src->lifespan;
         dest->resolution = src->resolution;
-        dest->usedMem = src->usedMem;
         dest->maxMem = src->maxMem;
         dest->maxKeys = src->maxKeys;
         dest->shared = src->shared;
+        if (createShards(dest) < 0) {
+            return 0;
+        }
     }
     return dest;
 }
@@ -586,6 +895,7 @@ PUBLIC void ejsConfigureLocalCacheType(Ejs *ejs)
     ejsBindMethod(ejs, prototype, ES_LocalCache_read, sl_read);
     ejsBindMethod(ejs, prototype, ES_LocalCache_remove, sl_remove);
     ejsBindMethod(ejs, prototype, ES_LocalCache_setLimits, sl_setLimits);
+    ejsBindAccess(ejs, prototype, ES_LocalCache_stats, sl_stats, 0);
     ejsBindMethod(ejs, prototype, ES_LocalCache_write, sl_write);
 }
 
@@ -125,8 +125,21 @@ static EjsNumber *getSystemRam(Ejs *ejs, EjsObj *thisObj, int argc, EjsObj **arg
  */
 static EjsObj *printStats(Ejs *ejs, EjsObj *thisObj, int argc, EjsObj **argv)
 {
+    EjsInternStats  stats;
+
     //  TODO - should go to log file and not to stdout
     mprPrintMem("Memory Report", 1);
+
+    ejsGetInternStats(&stats);
+    printf("Intern Stats:\n");
+    printf("  Strings         %12d\n", stats.count);
+    printf("  Shards          %12d\n", stats.shards);
+    printf("  Buckets         %12d\n", stats.buckets);
+    printf("  Lookups         %12.0f\n", (double) stats.accesses);
+    printf("  Hit rate        %12.2f %%\n", stats.accesses ? stats.reuse * 100.0 / stats.accesses : 0.0);
+    printf("  Lock waits      %12.2f %% (%d)\n", stats.accesses ? stats.contention * 100.0 / stats.accesses : 0.0, 
+        (int) stats.contention);
+    printf("\n");
     return 0;
 }
 
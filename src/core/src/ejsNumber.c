@@ -589,7 +589,19 @@ static char *ntoa(double value, int ndigits, int mode, int flags)
 PUBLIC EjsNumber *ejsCreateNumber(Ejs *ejs, MprNumber value)
 {
     EjsNumber   *vp;
+    EjsNumber   **numbers;
+    int         ival;
 
+    /*
+        Numbers are immutable, so small integers are shared from a service-wide cache rather than allocated.
+        This keeps loop counters and indexes from generating garbage.
+     */
+    if (value >= ME_EJS_NUMBER_CACHE_MIN && value <= ME_EJS_NUMBER_CACHE_MAX) {
+        ival = (int) value;
+        if (ival == value && (numbers = ejs->service->numbers) != 0) {
+            return numbers[ival - ME_EJS_NUMBER_CACHE_MIN];
+        }
+    }
     if (value == 0) {
         return ESV(zero);
     } else if (value == 1) {
@@ -604,6 +616,46 @@ PUBLIC EjsNumber *ejsCreateNumber(Ejs *ejs, MprNumber value)
 }
 
 
+/*
+    Create the shared cache of small integers. The existing zero, one and minusOne values are reused so that
+    identity is preserved for these special values.
+ */
+static void createNumberCache(Ejs *ejs, EjsType *type)
+{
+    EjsNumber   *np, **numbers;
+    int         i, count;
+
+    count = ME_EJS_NUMBER_CACHE_MAX - ME_EJS_NUMBER_CACHE_MIN + 1;
+    if ((numbers = mprAllocZeroed(count * sizeof(EjsNumber*))) == 0) {
+        return;
+    }
+    /*
+        Publish before populating so the service manager marks the numbers as they are created
+     */
+    ejs->service->numbers = numbers;
+    for (i = 0; i < count; i++) {
+        switch (i + ME_EJS_NUMBER_CACHE_MIN) {
+        case -1:
+            np = ESV(minusOne);
+            break;
+        case 0:
+            np = ESV(zero);
+            break;
+        case 1:
+            np = ESV(one);
+            break;
+        default:
+            if ((np = ejsCreateObj(ejs, type, 0)) == 0) {
+                ejs->service->numbers = 0;
+                return;
+            }
+            np->value = i + ME_EJS_NUMBER_CACHE_MIN;
+        }
+        numbers[i] = np;
+    }
+}
+
+
 PUBLIC void ejsCreateNumberType(Ejs *ejs)
 {
     EjsNumber   *np;
@@ -641,6 +693,8 @@ PUBLIC void ejsCreateNumberType(Ejs *ejs)
     np->value = 0.0 / zero;
     ejsAddImmutable(ejs, S_nan, EN("NaN"), np);
 
+    createNumberCache(ejs, type);
+
     np = ejsCreateObj(ejs, type, 0);
     np->value = 1.7976931348623157e+308;
     ejsAddImmutable(ejs, S_max, EN("max"), np);
@@ -75,6 +75,7 @@ static EjsObj *obj_set_prototype(Ejs *ejs, EjsObj *obj, int argc, EjsObj **argv)
         return ESV(undefined);
     }
     prototype = (EjsPot*) argv[0];
+    mprAtomicAdd(&ejs->service->prototypeVersion, 1);
     if (ejsIsType(ejs, obj)) {
         ((EjsType*) obj)->prototype = prototype;
     } else {
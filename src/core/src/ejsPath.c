@@ -746,7 +746,7 @@ static bool matchPath(Ejs *ejs, EjsPath *thisPath, EjsAny *matcher, cchar *path,
     } else if (ejsIs(ejs, matcher, RegExp)) {
         re = matcher;
         if (re && re->compiled) {
-            if (pcre_exec(re->compiled, NULL, path, (int) slen(path), 0, 0, NULL, 0) < 0) {
+            if (pcre_exec(re->compiled, ejsGetRegExpStudy(re), path, (int) slen(path), 0, 0, NULL, 0) < 0) {
                 match = 0;
             }
         }
@@ -20,6 +20,7 @@
 static int  growSlots(Ejs *ejs, EjsPot *obj, int size);
 static int  hashProperty(Ejs *ejs, EjsPot *obj, int slotNum, EjsName qname);
 static void removeHashEntry(Ejs *ejs, EjsPot *obj, EjsName qname);
+static int  unshareHash(Ejs *ejs, EjsPot *obj);
 
 /************************************* Code ***********************************/
 
@@ -79,7 +80,7 @@ PUBLIC EjsAny *ejsClonePot(Ejs *ejs, EjsAny *obj, bool deep)
             }
         }
     }
-    if (dest->numProp > EJS_HASH_MIN_PROP) {
+    if (dest->numProp > EJS_HASH_MIN_PROP && !ejsSharePotHash(ejs, dest, src)) {
         ejsIndexProperties(ejs, dest);
     }
     mprCopyName(dest, src);
@@ -113,6 +114,10 @@ PUBLIC void ejsFixTraits(Ejs *ejs, EjsPot *obj)
             }
         }
         if (ejsIsPot(ejs, sp->value.ref)) {
+            if (unlikely(ejs->lazyGlobals) && obj == ejs->global && ejsIsLazyGlobal(ejs, i)) {
+                /* Still shared with the master. Fixed when cloned by ejsCloneLazyGlobal */
+                continue;
+            }
             ejsFixTraits(ejs, sp->value.ref);
         }
     }
@@ -248,6 +253,9 @@ static int deletePotProperty(Ejs *ejs, EjsPot *obj, int slotNum)
     sp->value.ref = ESV(undefined);
     sp->trait.type = 0;
     sp->trait.attributes = EJS_TRAIT_DELETED | EJS_TRAIT_HIDDEN;
+    if (obj->isPrototype || obj->isType) {
+        mprAtomicAdd(&ejs->service->prototypeVersion, 1);
+    }
     return 0;
 }
 
@@ -277,6 +285,9 @@ static EjsPot *getPotProperty(Ejs *ejs, EjsPot *obj, int slotNum)
         ejsThrowReferenceError(ejs, "Property at slot \"%d\" is not found", slotNum);
         return 0;
     }
+    if (unlikely(ejs->lazyGlobals) && obj == ejs->global && ejsIsLazyGlobal(ejs, slotNum)) {
+        return ejsCloneLazyGlobal(ejs, slotNum);
+    }
     return obj->properties->slots[slotNum].value.ref;
 }
 
@@ -447,6 +458,9 @@ static int setPotProperty(Ejs *ejs, EjsPot *obj, int slotNum, EjsObj *value)
     }
     assert(slotNum < obj->numProp);
     assert(obj->numProp <= obj->properties->size);
+    if (unlikely(ejs->lazyGlobals) && obj == ejs->global && ejsIsLazyGlobal(ejs, slotNum)) {
+        ejsClearLazyGlobal(ejs, slotNum);
+    }
     obj->properties->slots[slotNum].value.ref = value;
     return slotNum;
 }
@@ -480,6 +494,10 @@ static int setPotPropertyName(Ejs *ejs, EjsPot *obj, int slotNum, EjsName qname)
         removeHashEntry(ejs, obj, props->slots[slotNum].qname);
     }
     props->slots[slotNum].qname = qname;
+    if (obj->isPrototype || obj->isType) {
+        /* Invalidate inline caches that resolved names via prototypes and types */
+        mprAtomicAdd(&ejs->service->prototypeVersion, 1);
+    }
     
     assert(slotNum < obj->numProp);
     assert(obj->numProp <= props->size);
@@ -545,6 +563,9 @@ PUBLIC int ejsInsertPotProperties(Ejs *ejs, EjsPot *obj, int incr, int offset)
         slots[i] = *sp;
     }
     ejsZeroSlots(ejs, &slots[offset], incr);
+    if (obj->isPrototype || obj->isType) {
+        mprAtomicAdd(&ejs->service->prototypeVersion, 1);
+    }
     if (ejsIndexProperties(ejs, obj) < 0) {
         return EJS_ERR;
     }   
@@ -702,6 +723,9 @@ PUBLIC int ejsRemovePotProperty(Ejs *ejs, EjsAny *vp, int slotNum)
         return EJS_ERR;
     }
     removeSlot(ejs, obj, slotNum, 1);
+    if (obj->isPrototype || obj->isType) {
+        mprAtomicAdd(&ejs->service->prototypeVersion, 1);
+    }
     return 0;
 }
 
@@ -801,6 +825,12 @@ static int hashProperty(Ejs *ejs, EjsPot *obj, int slotNum, EjsName qname)
 
     } else {
         /* Start a new hash chain */
+        if (obj->sharedHash) {
+            if (unshareHash(ejs, obj) < 0) {
+                return EJS_ERR;
+            }
+            hash = props->hash;
+        }
         hash->buckets[index] = slotNum;
     }
     slots[slotNum].hashChain = -2;
@@ -836,7 +866,7 @@ PUBLIC int ejsIndexProperties(Ejs *ejs, EjsPot *obj)
      */
     oldHash = obj->properties->hash;
     newHashSize = ejsGetHashSize(obj->numProp);
-    if (oldHash == NULL || oldHash->size < newHashSize) {
+    if (oldHash == NULL || oldHash->size < newHashSize || obj->sharedHash) {
         hash = (EjsHash*) mprAlloc(sizeof(EjsHash) + (newHashSize * sizeof(int)));
         if (hash == 0) {
             return EJS_ERR;
@@ -846,6 +876,7 @@ PUBLIC int ejsIndexProperties(Ejs *ejs, EjsPot *obj)
         assert(newHashSize > 0);
         obj->properties->hash = hash;
         obj->separateHash = 1;
+        obj->sharedHash = 0;
     }
     hash = obj->properties->hash;
     assert(hash);
@@ -908,6 +939,12 @@ static void removeHashEntry(Ejs *ejs, EjsPot *obj, EjsName qname)
             if (lastSlot >= 0) {
                 obj->properties->slots[lastSlot].hashChain = obj->properties->slots[slotNum].hashChain;
             } else {
+                if (obj->sharedHash) {
+                    if (unshareHash(ejs, obj) < 0) {
+                        return;
+                    }
+                    buckets = obj->properties->hash->buckets;
+                }
                 buckets[index] = obj->properties->slots[slotNum].hashChain;
             }
             //  TODO -- null would be better
@@ -923,6 +960,95 @@ static void removeHashEntry(Ejs *ejs, EjsPot *obj, EjsName qname)
 }
 
 
+/*
+    Share the name hash of an object that has an identical property layout. Instances of a class and clones of an
+    object have the same names in the same slots, so they can use one hash instead of building their own. The hash
+    chains live in the slots and are copied. The shared hash is treated as read-only by all users and is copied by 
+    unshareHash before any bucket is modified. Only separately allocated hashes can be shared as they must be marked 
+    independently of the owning object.
+ */
+PUBLIC bool ejsSharePotHash(Ejs *ejs, EjsPot *dest, EjsPot *src)
+{
+    EjsSlot     *sp, *dp;
+    EjsHash     *hash;
+    int         i;
+
+    assert(ejsIsPot(ejs, dest));
+    assert(ejsIsPot(ejs, src));
+
+    if (!src->separateHash || src->properties == 0 || (hash = src->properties->hash) == 0 || 
+            dest->numProp != src->numProp || hash->size < dest->numProp) {
+        return 0;
+    }
+    sp = src->properties->slots;
+    dp = dest->properties->slots;
+    for (i = 0; i < dest->numProp; i++) {
+        dp[i].hashChain = sp[i].hashChain;
+    }
+    dest->properties->hash = hash;
+    dest->separateHash = 1;
+    dest->sharedHash = 1;
+    if (!src->sharedHash) {
+        /* Sources such as function activations are shared by all calls. Only write the flag once */
+        src->sharedHash = 1;
+    }
+    return 1;
+}
+
+
+/*
+    Name the slots of a new object after another object with the same number of properties and share its name hash.
+    Used when making many objects with the same properties, such as query rows and parsed records, so each object
+    does not hash its own names. The object's slots are still private, only the names and hash are reused.
+ */
+PUBLIC int ejsSetPotLayout(Ejs *ejs, EjsPot *obj, EjsPot *layout)
+{
+    EjsSlot     *sp, *dp;
+    int         i;
+
+    assert(ejsIsPot(ejs, obj));
+    assert(ejsIsPot(ejs, layout));
+    assert(obj->numProp == layout->numProp);
+
+    if (obj->numProp == 0) {
+        return 0;
+    }
+    assert(obj->properties->hash == 0);
+    sp = layout->properties->slots;
+    dp = obj->properties->slots;
+    for (i = 0; i < obj->numProp; i++) {
+        dp[i].qname = sp[i].qname;
+        dp[i].hashChain = -1;
+    }
+    if (obj->numProp > EJS_HASH_MIN_PROP && !ejsSharePotHash(ejs, obj, layout)) {
+        return ejsIndexProperties(ejs, obj);
+    }
+    return 0;
+}
+
+
+/*
+    Take a private copy of a shared name hash before modifying its buckets
+ */
+static int unshareHash(Ejs *ejs, EjsPot *obj)
+{
+    EjsHash     *hash, *oldHash;
+
+    assert(obj->sharedHash);
+    oldHash = obj->properties->hash;
+    if ((hash = (EjsHash*) mprAlloc(sizeof(EjsHash) + (oldHash->size * sizeof(int)))) == 0) {
+        return EJS_ERR;
+    }
+    hash->buckets = (int*) (((char*) hash) + sizeof(EjsHash));
+    hash->size = oldHash->size;
+    memcpy(hash->buckets, oldHash->buckets, hash->size * sizeof(int));
+    obj->properties->hash = hash;
+    obj->separateHash = 1;
+    obj->sharedHash = 0;
+    return 0;
+}
+
+
 PUBLIC int ejsCompactPot(Ejs *ejs, EjsPot *obj)
 {
     EjsSlot     *slots, *src, *dest;
@@ -991,7 +1117,7 @@ PUBLIC void *ejsCreatePot(Ejs *ejs, EjsType *type, int numProp)
                 ejsCopySlots(ejs, obj, 0, prototype, 0, prototype->numProp);
             }
             ejsZeroSlots(ejs, &obj->properties->slots[prototype->numProp], obj->properties->size - prototype->numProp);
-            if (numProp > EJS_HASH_MIN_PROP) {
+            if (numProp > EJS_HASH_MIN_PROP && !ejsSharePotHash(ejs, obj, prototype)) {
                 ejsIndexProperties(ejs, obj);
             }
         } else {
@@ -14,10 +14,30 @@
     #define ME_MAX_REGEX_MATCHES 64
 #endif
 
+/*
+    Compiled pattern. Compiled patterns are immutable and are shared by all regular expressions with the same source
+    and flags over all interpreters.
+ */
+typedef struct RegExpPattern {
+    wchar           *pattern;           /* Pattern with delimiters and flags removed */
+    void            *compiled;          /* Compiled pattern (not alloced) */
+    void            *study;             /* Pattern study data (not alloced) */
+    int             options;            /* Pattern matching options */
+    int             uses;               /* Count of matches using the pattern */
+    bool            studied;            /* Pattern has been studied */
+    bool            global;
+    bool            ignoreCase;
+    bool            multiline;
+    bool            sticky;
+} RegExpPattern;
+
 /********************************* Forwards ***********************************/
 
+static RegExpPattern *compilePattern(Ejs *ejs, cchar *key, EjsRegExp *rp);
+static RegExpPattern *lookupPattern(cchar *key);
 static char *makeFlags(EjsRegExp *rp);
 static int parseFlags(EjsRegExp *rp, wchar *flags);
+static void setPattern(EjsRegExp *rp, RegExpPattern *pp);
 
 /******************************************************************************/
 /*
@@ -74,22 +94,24 @@ static EjsAny *castRegExp(Ejs *ejs, EjsRegExp *rp, EjsType *type)
 
 static EjsRegExp *regex_Constructor(Ejs *ejs, EjsRegExp *rp, int argc, EjsObj **argv)
 {
-    cchar       *errMsg;
-    int         column, errCode;
+    RegExpPattern   *pp;
+    cchar           *key;
 
-    rp->pattern = wclone(ejsToString(ejs, argv[0])->value);
+    rp->pattern = ejsToString(ejs, argv[0])->value;
     rp->options = PCRE_JAVASCRIPT_COMPAT;
+    rp->global = rp->ignoreCase = rp->multiline = rp->sticky = 0;
 
     if (argc == 2) {
         rp->options |= parseFlags(rp, ejsToString(ejs, argv[1])->value);
     }
-    if (rp->compiled) {
-        free(rp->compiled);
-    }
-    if ((rp->compiled = pcre_compile2(rp->pattern, rp->options, &errCode, &errMsg, &column, NULL)) == 0) {
-        ejsThrowArgError(ejs, "Cannot compile regular expression '%s'. Error %s at column %d", rp->pattern, errMsg, column);
-        return 0;
+    key = sfmt("%x:%d%d%d%d:%s", rp->options, rp->global, rp->ignoreCase, rp->multiline, rp->sticky, rp->pattern);
+    if ((pp = lookupPattern(key)) == 0) {
+        rp->pattern = wclone(rp->pattern);
+        if ((pp = compilePattern(ejs, key, rp)) == 0) {
+            return 0;
+        }
     }
+    setPattern(rp, pp);
     return rp;
 }
 
@@ -132,7 +154,8 @@ static EjsArray *regex_exec(Ejs *ejs, EjsRegExp *rp, int argc, EjsObj **argv)
     }
     rp->matched = 0;
     assert(rp->compiled);
-    count = pcre_exec(rp->compiled, NULL, str->value, (int) str->length, start, 0, matches, sizeof(matches) / sizeof(int));
+    count = pcre_exec(rp->compiled, ejsGetRegExpStudy(rp), str->value, (int) str->length, start, 0, matches, 
+        sizeof(matches) / sizeof(int));
     if (count < 0) {
         rp->endLastMatch = 0;
         return ESV(null);
@@ -207,7 +230,7 @@ static EjsBoolean *regex_test(Ejs *ejs, EjsRegExp *rp, int argc, EjsObj **argv)
 
     str = (EjsString*) argv[0];
     assert(rp->compiled);
-    count = pcre_exec(rp->compiled, NULL, str->value, (int) str->length, rp->endLastMatch, 0, 0, 0);
+    count = pcre_exec(rp->compiled, ejsGetRegExpStudy(rp), str->value, (int) str->length, rp->endLastMatch, 0, 0, 0);
     if (count < 0) {
         rp->endLastMatch = 0;
         return ESV(false);
@@ -221,26 +244,138 @@ PUBLIC EjsString *ejsRegExpToString(Ejs *ejs, EjsRegExp *rp)
     return (EjsString*) castRegExp(ejs, rp, ESV(String));
 }
 
+
+PUBLIC void *ejsGetRegExpStudy(EjsRegExp *rp)
+{
+#if ME_EJS_REGEXP_STUDY
+    RegExpPattern   *pp;
+    EjsService      *sp;
+    cchar           *errMsg;
+
+    if ((pp = rp->shared) == 0) {
+        return 0;
+    }
+    if (!pp->studied && ++pp->uses >= ME_EJS_REGEXP_STUDY) {
+        sp = MPR->ejsService;
+        lock(sp);
+        if (!pp->studied) {
+            pp->study = pcre_study(pp->compiled, 0, &errMsg);
+            pp->studied = 1;
+        }
+        unlock(sp);
+    }
+    return pp->study;
+#else
+    return 0;
+#endif
+}
+
+/****************************** Pattern Cache *********************************/
+
+static void managePattern(RegExpPattern *pp, int flags)
+{
+    if (flags & MPR_MANAGE_MARK) {
+        mprMark(pp->pattern);
+
+    } else if (flags & MPR_MANAGE_FREE) {
+        if (pp->study) {
+            free(pp->study);
+            pp->study = 0;
+        }
+        if (pp->compiled) {
+            free(pp->compiled);
+            pp->compiled = 0;
+        }
+    }
+}
+
+
+static RegExpPattern *lookupPattern(cchar *key)
+{
+    EjsService      *sp;
+    RegExpPattern   *pp;
+
+    sp = MPR->ejsService;
+    lock(sp);
+    pp = mprLookupKey(sp->regexps, key);
+    unlock(sp);
+    return pp;
+}
+
+
+/*
+    Compile the pattern and flags defined by rp and add to the pattern cache
+ */
+static RegExpPattern *compilePattern(Ejs *ejs, cchar *key, EjsRegExp *rp)
+{
+    EjsService      *sp;
+    RegExpPattern   *pp;
+    cchar           *errMsg;
+    int             column, errCode;
+
+    if ((pp = mprAllocObj(RegExpPattern, managePattern)) == 0) {
+        return 0;
+    }
+    if ((pp->compiled = pcre_compile2(rp->pattern, rp->options, &errCode, &errMsg, &column, NULL)) == 0) {
+        ejsThrowArgError(ejs, "Cannot compile regular expression '%s'. Error %s at column %d", rp->pattern, errMsg, column);
+        return 0;
+    }
+    pp->pattern = rp->pattern;
+    pp->options = rp->options;
+    pp->global = rp->global;
+    pp->ignoreCase = rp->ignoreCase;
+    pp->multiline = rp->multiline;
+    pp->sticky = rp->sticky;
+
+    sp = MPR->ejsService;
+    lock(sp);
+    if (mprGetHashLength(sp->regexps) >= ME_EJS_REGEXP_CACHE) {
+        /*
+            Start afresh. Patterns still in use are retained by their regular expressions.
+         */
+        sp->regexps = mprCreateHash(ME_EJS_REGEXP_CACHE, 0);
+    }
+    mprAddKey(sp->regexps, key, pp);
+    unlock(sp);
+    return pp;
+}
+
+
+static void setPattern(EjsRegExp *rp, RegExpPattern *pp)
+{
+    rp->shared = pp;
+    rp->compiled = pp->compiled;
+    rp->pattern = pp->pattern;
+    rp->options = pp->options;
+    rp->global = pp->global;
+    rp->ignoreCase = pp->ignoreCase;
+    rp->multiline = pp->multiline;
+    rp->sticky = pp->sticky;
+}
+
 /*********************************** Factory **********************************/
 /*
     Create an initialized regular expression object. The pattern should NOT include the slash delimiters. 
  */
 PUBLIC EjsRegExp *ejsCreateRegExp(Ejs *ejs, cchar *pattern, cchar *flags)
 {
-    EjsRegExp   *rp;
-    cchar       *errMsg;
-    int         column, errCode;
+    EjsRegExp       *rp;
+    RegExpPattern   *pp;
+    cchar           *key;
 
     if ((rp = ejsCreateObj(ejs, ESV(RegExp), 0)) == 0) {
         return 0;
     }
-    rp->pattern = sclone(pattern);
+    rp->pattern = (wchar*) pattern;
     rp->options = parseFlags(rp, (wchar*) flags);
-    rp->compiled = pcre_compile2(rp->pattern, rp->options, &errCode, &errMsg, &column, NULL);
-    if (rp->compiled == NULL) {
-        ejsThrowArgError(ejs, "Cannot compile regular expression '%s'. Error %s at column %d", rp->pattern, errMsg, column);
-        return 0;
+    key = sfmt("%x:%d%d%d%d:%s", rp->options, rp->global, rp->ignoreCase, rp->multiline, rp->sticky, rp->pattern);
+    if ((pp = lookupPattern(key)) == 0) {
+        rp->pattern = sclone(pattern);
+        if ((pp = compilePattern(ejs, key, rp)) == 0) {
+            return 0;
+        }
     }
+    setPattern(rp, pp);
     return rp;
 }
 
@@ -251,11 +386,10 @@ PUBLIC EjsRegExp *ejsCreateRegExp(Ejs *ejs, cchar *pattern, cchar *flags)
  */
 PUBLIC EjsRegExp *ejsParseRegExp(Ejs *ejs, EjsString *pattern)
 {
-    EjsRegExp   *rp;
-    cchar       *errMsg;
-    char        *cp, *dp;
-    wchar       *flags;
-    int         column, errCode;
+    EjsRegExp       *rp;
+    RegExpPattern   *pp;
+    char            *cp, *dp;
+    wchar           *flags;
 
     if (pattern->length == 0 || pattern->value[0] != '/') {
         ejsThrowArgError(ejs, "Bad regular expression pattern. Must start with '/'");
@@ -264,6 +398,14 @@ PUBLIC EjsRegExp *ejsParseRegExp(Ejs *ejs, EjsString *pattern)
     if ((rp = ejsCreateObj(ejs, ESV(RegExp), 0)) == 0) {
         return 0;
     }
+    /*
+        Regular expression literals are compiled once. Later evaluations create a new object sharing the compiled pattern.
+        Literal keys always start with "/" and so never clash with the constructor keys.
+     */
+    if ((pp = lookupPattern(pattern->value)) != 0) {
+        setPattern(rp, pp);
+        return rp;
+    }
     /*
         Strip off flags for passing to pcre_compile2
      */
@@ -291,11 +433,10 @@ PUBLIC EjsRegExp *ejsParseRegExp(Ejs *ejs, EjsString *pattern)
     } else {
         rp->pattern = sclone(&pattern->value[1]);
     }
-    rp->compiled = pcre_compile2(rp->pattern, rp->options, &errCode, &errMsg, &column, NULL);
-    if (rp->compiled == NULL) {
-        ejsThrowArgError(ejs, "Cannot compile regular expression '%s'. Error %s at column %d", rp->pattern, errMsg, column);
+    if ((pp = compilePattern(ejs, pattern->value, rp)) == 0) {
         return 0;
     }
+    setPattern(rp, pp);
     return rp;
 }
 
@@ -381,12 +522,8 @@ static void manageRegExp(EjsRegExp *rp, int flags)
 {
     if (flags & MPR_MANAGE_MARK) {
         mprMark(rp->pattern);
-
-    } else if (flags & MPR_MANAGE_FREE) {
-        if (rp->compiled) {
-            free(rp->compiled);
-            rp->compiled = 0;
-        }
+        mprMark(rp->shared);
+        mprMark(rp->matched);
     }
 }
 
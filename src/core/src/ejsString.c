@@ -16,7 +16,7 @@
 #endif
 
 static int internHashSizes[] = {
-     389, 769, 1543, 3079, 6151, 12289, 24593, 49157, 98317, 196613, 0
+     47, 97, 193, 389, 769, 1543, 3079, 6151, 12289, 24593, 49157, 98317, 196613, 0
 };
 
 /***************************** Forward Declarations ***************************/
@@ -25,7 +25,7 @@ static EjsString *buildString(Ejs *ejs, EjsString *result, wchar *str, ssize len
 static ssize indexof(wchar *str, ssize len, EjsString *pattern, ssize patternLength, int dir);
 static void linkString(EjsString *head, EjsString *sp);
 static void manageIntern(EjsIntern *intern, int flags);
-static int rebuildIntern(EjsIntern *intern);
+static int rebuildShard(EjsInternShard *shard);
 static void unlinkString(EjsString *sp);
 
 /************************************* Code ***********************************/
@@ -150,6 +150,22 @@ static EjsAny *coerceStringOperands(Ejs *ejs, EjsAny *lhs, int opcode,  EjsAny *
 }
 
 
+/*
+    Test strings for equality. Interned strings are equal only if they are the same object. Long joined strings are
+    interned lazily and may need to be compared by value.
+ */
+static bool sameString(EjsString *lhs, EjsString *rhs)
+{
+    if (lhs == rhs) {
+        return 1;
+    }
+    if (ejsIsInterned(lhs) && ejsIsInterned(rhs)) {
+        return 0;
+    }
+    return lhs->length == rhs->length && memcmp(lhs->value, rhs->value, lhs->length * sizeof(wchar)) == 0;
+}
+
+
 static EjsAny *invokeStringOperator(Ejs *ejs, EjsString *lhs, int opcode, EjsString *rhs, void *data)
 {
     EjsAny  *result, *arg;
@@ -167,21 +183,11 @@ static EjsAny *invokeStringOperator(Ejs *ejs, EjsString *lhs, int opcode, EjsStr
     switch (opcode) {
     case EJS_OP_COMPARE_STRICTLY_EQ:
     case EJS_OP_COMPARE_EQ:
-        //  OPT -- should use lhs == rhs
-        if (lhs->value == rhs->value) {
-            assert(lhs == rhs);
-            return ESV(true);
-        }
-        return ESV(false);
+        return sameString(lhs, rhs) ? ESV(true) : ESV(false);
 
     case EJS_OP_COMPARE_NE:
     case EJS_OP_COMPARE_STRICTLY_NE:
-        //  OPT -- should use lhs == rhs
-        if (lhs->value != rhs->value) {
-            assert(lhs != rhs);
-            return ESV(true);
-        }
-        return ESV(false);
+        return sameString(lhs, rhs) ? ESV(false) : ESV(true);
 
     case EJS_OP_COMPARE_LT:
         return ejsCreateBoolean(ejs, 
@@ -372,21 +378,29 @@ static EjsNumber *charCodeAt(Ejs *ejs, EjsString *sp, int argc, EjsObj **argv)
 static EjsString *concatString(Ejs *ejs, EjsString *sp, int argc, EjsObj **argv)
 {
     EjsArray    *args;
-    EjsString   *result, *str;
+    EjsString   *str;
+    MprBuf      *buf;
     int         i;
 
     assert(argc == 1 && ejsIs(ejs, argv[0], Array));
     args = (EjsArray*) argv[0];
 
-    result = (EjsString*) ejsClone(ejs, sp, 0);
+    if (args->length == 1) {
+        return ejsJoinString(ejs, sp, ejsToString(ejs, ejsGetProperty(ejs, args, 0)));
+    }
+    /*
+        Catenate into a buffer rather than joining pair-wise which would copy the result for each argument
+     */
+    if ((buf = mprCreateBuf((sp->length + 1) * sizeof(wchar), -1)) == 0) {
+        ejsThrowMemoryError(ejs);
+        return 0;
+    }
+    mprPutBlockToBuf(buf, (cchar*) sp->value, sp->length * sizeof(wchar));
     for (i = 0; i < args->length; i++) {
         str = ejsToString(ejs, ejsGetProperty(ejs, args, i));
-        if ((result = ejsJoinString(ejs, result, str)) == NULL) {
-            ejsThrowMemoryError(ejs);
-            return 0;
-        }
+        mprPutBlockToBuf(buf, (cchar*) str->value, str->length * sizeof(wchar));
     }
-    return result;
+    return ejsCreateString(ejs, (wchar*) mprGetBufStart(buf), mprGetBufLength(buf) / sizeof(wchar));
 }
 
 
@@ -410,7 +424,7 @@ static EjsBoolean *containsString(Ejs *ejs, EjsString *sp, int argc, EjsObj **ar
         EjsRegExp   *rp;
         int         count;
         rp = (EjsRegExp*) argv[0];
-        count = pcre_exec(rp->compiled, NULL, sp->value, (int) sp->length, 0, 0, 0, 0);
+        count = pcre_exec(rp->compiled, ejsGetRegExpStudy(rp), sp->value, (int) sp->length, 0, 0, 0, 0);
         return ejsCreateBoolean(ejs, count >= 0);
     }
     ejsThrowTypeError(ejs, "Wrong argument type");
@@ -982,8 +996,8 @@ static EjsArray *match(Ejs *ejs, EjsString *sp, int argc, EjsObj **argv)
     resultCount = 0;
 
     do {
-        count = pcre_exec(rp->compiled, NULL, sp->value, (int) sp->length, rp->endLastMatch, 0, matches, 
-            sizeof(matches) / sizeof(int));
+        count = pcre_exec(rp->compiled, ejsGetRegExpStudy(rp), sp->value, (int) sp->length, rp->endLastMatch, 0, 
+            matches, sizeof(matches) / sizeof(int));
         if (count <= 0) {
             break;
         }
@@ -1177,8 +1191,8 @@ static EjsString *replace(Ejs *ejs, EjsString *sp, int argc, EjsObj **argv)
             if (startNextMatch > sp->length) {
                 break;
             }
-            count = pcre_exec(rp->compiled, NULL, sp->value, (int) sp->length, (int) startNextMatch, 0, matches,
-                    sizeof(matches) / sizeof(int));
+            count = pcre_exec(rp->compiled, ejsGetRegExpStudy(rp), sp->value, (int) sp->length, (int) startNextMatch, 
+                    0, matches, sizeof(matches) / sizeof(int));
             if (count <= 0) {
                 break;
             }
@@ -1327,7 +1341,8 @@ static EjsNumber *searchString(Ejs *ejs, EjsString *sp, int argc, EjsObj **argv)
 
     } else if (ejsIs(ejs, argv[0], RegExp)) {
         rp = (EjsRegExp*) argv[0];
-        count = pcre_exec(rp->compiled, NULL, sp->value, (int) sp->length, 0, 0, matches, sizeof(matches) / sizeof(int));
+        count = pcre_exec(rp->compiled, ejsGetRegExpStudy(rp), sp->value, (int) sp->length, 0, 0, matches, 
+            sizeof(matches) / sizeof(int));
         if (count < 0) {
             return ESV(minusOne);
         }
@@ -1448,8 +1463,8 @@ static EjsArray *split(Ejs *ejs, EjsString *sp, int argc, EjsObj **argv)
         rp->endLastMatch = 0;
         resultCount = 0;
         while (1) {
-            count = (int) pcre_exec(rp->compiled, NULL, sp->value, (int) sp->length, rp->endLastMatch, 0, matches, 
-                sizeof(matches) / sizeof(int));
+            count = (int) pcre_exec(rp->compiled, ejsGetRegExpStudy(rp), sp->value, (int) sp->length, 
+                rp->endLastMatch, 0, matches, sizeof(matches) / sizeof(int));
             if (count <= 0) {
                 break;
             }
@@ -1921,6 +1936,12 @@ PUBLIC int ejsAtoi(Ejs *ejs, EjsString *sp, int radix)
 }
 
 
+/*
+    Join two strings. Results of EJS_LAZY_INTERN_LEN or more characters are not interned. Building a string by
+    repeated catenation would otherwise hash and intern every intermediate result and unlink each one from the
+    intern table when collected. The result is interned when used as a property name (ejsInternName). String
+    equality and comparison compare such strings by value.
+ */
 PUBLIC EjsString *ejsJoinString(Ejs *ejs, EjsString *s1, EjsString *s2)
 {
     EjsString   *result;
@@ -1938,6 +1959,9 @@ PUBLIC EjsString *ejsJoinString(Ejs *ejs, EjsString *s1, EjsString *s2)
     }
     memcpy(result->value, s1->value, s1->length * sizeof(wchar));
     memcpy(&result->value[s1->length], s2->value, s2->length * sizeof(wchar));
+    if (len >= EJS_LAZY_INTERN_LEN) {
+        return result;
+    }
     return ejsInternString(result);
 }
 
@@ -2030,7 +2054,7 @@ PUBLIC int ejsCompareAsc(Ejs *ejs, EjsString *sp, cchar *str)
 
 
 /*
-    Compare interned strings
+    Compare strings. Interned strings can be compared by reference. Lazily interned strings are compared by value.
  */
 PUBLIC int ejsCompareString(Ejs *ejs, EjsString *sp1, EjsString *sp2)
 {
@@ -2059,7 +2083,6 @@ PUBLIC int ejsCompareString(Ejs *ejs, EjsString *sp1, EjsString *sp2)
     } else if (*s2 == '\0' && *s1) {
         return 1;
     }
-    assert(0);
     return 0;
 }
 
@@ -2379,55 +2402,80 @@ static void revive(EjsString *sp)
 }
 
 
+/*
+    Select the shard for a string from its full hash so strings with a common prefix are spread over all shards.
+    The high bits are used as the low bits select the bucket within the shard.
+ */
+static EjsInternShard *getShard(EjsIntern *ip, uint hash)
+{
+    return &ip->shards[(hash >> 16) & (ME_EJS_INTERN_SHARDS - 1)];
+}
+
+
+static int getBucket(EjsInternShard *shard, uint hash)
+{
+    return hash % shard->size;
+}
+
+
+/*
+    Lock a shard and count the accesses that had to wait for another thread
+ */
+static void lockShard(EjsInternShard *shard)
+{
+    if (!mprTryLock(shard->mutex)) {
+        mprLock(shard->mutex);
+        shard->contention++;
+    }
+    shard->accesses++;
+}
+
+
 /*
     Intern a unicode string. Lookup a string and return an interned string (this may be an existing interned string)
  */
 PUBLIC EjsString *ejsInternString(EjsString *str)
 {
-    EjsString   *head, *sp;
-    EjsIntern   *ip;
-    ssize       i, len;
-    int         index, step;
+    EjsInternShard  *shard;
+    EjsString       *head, *sp;
+    ssize           i, len;
+    uint            hash;
+    int             step;
 
-    ip = ((EjsService*) MPR->ejsService)->intern;
+    hash = whash(str->value, str->length);
+    shard = getShard(((EjsService*) MPR->ejsService)->intern, hash);
     step = 0;
 
-    lock(ip);
-    ip->accesses++;
-    index = whash(str->value, str->length) % ip->size;
-    if ((head = &ip->buckets[index]) != NULL) {
-        for (sp = head->next; sp != head; sp = sp->next, step++) {
-            if (str == sp) {
+    lockShard(shard);
+    head = &shard->buckets[getBucket(shard, hash)];
+    for (sp = head->next; sp != head; sp = sp->next, step++) {
+        if (str == sp) {
+            revive(sp);
+            unlock(shard);
+            return sp;
+        }
+        if (sp->length == str->length) {
+            len = sp->length;
+            for (i = 0; i < len; i++) {
+                if (sp->value[i] != str->value[i]) {
+                    break;
+                }
+            }
+            if (i == len) {
+                shard->reuse++;
                 revive(sp);
-                unlock(ip);
+                unlock(shard);
                 return sp;
             }
-            if (sp->length == str->length) {
-                //  TODO but they are the same?
-                len = min(sp->length, str->length);
-                //  OPT
-                for (i = 0; i < len; i++) {
-                    if (sp->value[i] != str->value[i]) {
-                        break;
-                    }
-                }
-                if (i == sp->length && i == str->length) {
-                    ip->reuse++;
-                    revive(sp);
-                    unlock(ip);
-                    return sp;
-                }
-            }
         }
     }
-    ip->count++;
+    shard->count++;
     linkString(head, str);
-    if (step > EJS_MAX_COLLISIONS && ip->count > (ip->size/2)) {
-        /*  Remake the entire hash - should not happen often */
-        //  OPT - stop holding lock while rebuildingIntern
-        rebuildIntern(ip);
+    if (step > EJS_MAX_COLLISIONS && shard->count > (shard->size/2)) {
+        /*  Remake the shard hash - should not happen often. Only this shard is blocked. */
+        rebuildShard(shard);
     }
-    unlock(ip);
+    unlock(shard);
     return str;
 }
 
@@ -2437,37 +2485,33 @@ PUBLIC EjsString *ejsInternString(EjsString *str)
  */
 PUBLIC EjsString *ejsInternWide(Ejs *ejs, wchar *value, ssize len)
 {
-    EjsString   *head, *sp;
-    EjsIntern   *ip;
-    ssize       i, end;
-    int         index, step;
+    EjsInternShard  *shard;
+    EjsString       *head, *sp;
+    ssize           i;
+    uint            hash;
+    int             step;
 
     assert(0 <= len && len < MAXINT);
 
-    ip = ejs->service->intern;
+    hash = whash(value, len);
+    shard = getShard(ejs->service->intern, hash);
     step = 0;
 
-    lock(ip);
-    //  TODO - accesses should be debug only
-    ip->accesses++;
-    index = whash(value, len) % ip->size;
-    if ((head = &ip->buckets[index]) != NULL) {
-        for (sp = head->next; sp != head; sp = sp->next, step++) {
-            //  TODO - why not compare sp->value with value?
-            if (sp->length == len) {
-                end = min(sp->length, len);
-                for (i = 0; i < end && value[i]; i++) {
-                    if (sp->value[i] != value[i]) {
-                        break;
-                    }
-                }
-                if (i == sp->length) {
-                    ip->reuse++;
-                    revive(sp);
-                    unlock(ip);
-                    return sp;
+    lockShard(shard);
+    head = &shard->buckets[getBucket(shard, hash)];
+    for (sp = head->next; sp != head; sp = sp->next, step++) {
+        if (sp->length == len) {
+            for (i = 0; i < len && value[i]; i++) {
+                if (sp->value[i] != value[i]) {
+                    break;
                 }
             }
+            if (i == sp->length) {
+                shard->reuse++;
+                revive(sp);
+                unlock(shard);
+                return sp;
+            }
         }
     }
     if ((sp = ejsAlloc(ejs, ESV(String), (len + 1) * sizeof(wchar))) != NULL) {
@@ -2475,50 +2519,46 @@ PUBLIC EjsString *ejsInternWide(Ejs *ejs, wchar *value, ssize len)
         sp->value[len] = 0;
     }
     sp->length = len;
-    ip->count++;
+    shard->count++;
     linkString(head, sp);
-    if (step > EJS_MAX_COLLISIONS && ip->count > (ip->size/2)) {
-        /*  Remake the entire hash - should not happen often */
-        //  OPT - lock while rebuildingIntern
-        rebuildIntern(ip);
+    if (step > EJS_MAX_COLLISIONS && shard->count > (shard->size/2)) {
+        rebuildShard(shard);
     }
-    unlock(ip);
+    unlock(shard);
     return sp;
 }
 
 
 PUBLIC EjsString *ejsInternAsc(Ejs *ejs, cchar *value, ssize len)
 {
-    EjsString   *head, *sp;
-    EjsIntern   *ip;
-    ssize       i, end;
-    int         index, step;
+    EjsInternShard  *shard;
+    EjsString       *head, *sp;
+    ssize           i;
+    uint            hash;
+    int             step;
 
     assert(0 <= len && len < MAXINT);
 
+    hash = shash(value, len);
+    shard = getShard(ejs->service->intern, hash);
     step = 0;
-    ip = ejs->service->intern;
-
-    lock(ip);
-    ip->accesses++;
-    assert(ip->size > 0);
-    index = shash(value, len) % ip->size;
-    if ((head = &ip->buckets[index]) != NULL) {
-        for (sp = head->next; sp != head; sp = sp->next, step++) {
-            if (sp->length == len) {
-                end = min(len, sp->length);
-                for (i = 0; i < end && value[i]; i++) {
-                    if (sp->value[i] != (uchar) value[i]) {
-                        break;
-                    }
-                }
-                if (i == sp->length) {
-                    ip->reuse++;
-                    revive(sp);
-                    unlock(ip);
-                    return sp;
+
+    lockShard(shard);
+    assert(shard->size > 0);
+    head = &shard->buckets[getBucket(shard, hash)];
+    for (sp = head->next; sp != head; sp = sp->next, step++) {
+        if (sp->length == len) {
+            for (i = 0; i < len && value[i]; i++) {
+                if (sp->value[i] != (uchar) value[i]) {
+                    break;
                 }
             }
+            if (i == sp->length) {
+                shard->reuse++;
+                revive(sp);
+                unlock(shard);
+                return sp;
+            }
         }
     }
     if ((sp = ejsAlloc(ejs, ESV(String), (len + 1) * sizeof(wchar))) != NULL) {
@@ -2533,14 +2573,12 @@ PUBLIC EjsString *ejsInternAsc(Ejs *ejs, cchar *value, ssize len)
         sp->value[len] = 0;
     }
     sp->length = len;
-    ip->count++;
+    shard->count++;
     linkString(head, sp);
-    if (step > EJS_MAX_COLLISIONS && ip->count > (ip->size/2)) {
-        /*  Remake the entire hash - should not happen often */
-        //  OPT - BAD holding lock while rebuildingIntern
-        rebuildIntern(ip);
+    if (step > EJS_MAX_COLLISIONS && shard->count > (shard->size/2)) {
+        rebuildShard(shard);
     }
-    unlock(ip);
+    unlock(shard);
     return sp;
 }
 
@@ -2555,9 +2593,7 @@ PUBLIC EjsString *ejsInternMulti(Ejs *ejs, cchar *value, ssize len)
 
 PUBLIC EjsString *ejsInternMulti(Ejs *ejs, cchar *value, ssize len)
 {
-    EjsString   *head, *sp, src;
-    ssize       i, end;
-    int         index;
+    EjsString   *src;
 
     assert(0 < len && len < MAXINT);
 
@@ -2568,38 +2604,11 @@ PUBLIC EjsString *ejsInternMulti(Ejs *ejs, cchar *value, ssize len)
         Have to convert the multibyte string to unicode before comparision. Convert into an EjsString to it is ready
         to intern if not found.
      */
-    if ((src = ejsAlloc(ejs, ESV(String), (len + 1) * sizeof(wchar))) != NULL) {
-        src->length = mtow(src->value, len + 1, value, len);
-        value = src->value;
-    }
-    lock(ip);
-    ip->accesses++;
-    index = whash(value, len) % ip->size;
-    if ((head = &ip->buckets[index]) != NULL) {
-        for (sp = head->next; sp != head; sp = sp->next) {
-            end = min(len, sp->length);
-            for (i = 0; i < end && value[i]; i++) {
-                if (sp->value[i] != sp->value[i]) {
-                    break;
-                }
-            }
-            if (i == sp->length && value[i] == 0) {
-                ip->reuse++;
-                revive(sp);
-                unlock(ip);
-                return sp;
-            }
-        }
-    }
-    ip->count++;
-    linkString(head, src);
-    if (step > EJS_MAX_COLLISIONS && ip->count > (ip->size/2)) {
-        /*  Remake the entire hash - should not happen often */
-        //  OPT - BAD holding lock while rebuildingIntern
-        rebuildIntern(ip);
+    if ((src = ejsAlloc(ejs, ESV(String), (len + 1) * sizeof(wchar))) == NULL) {
+        return NULL;
     }
-    unlock(ip);
-    return sp;
+    src->length = mtow(src->value, len + 1, value, len);
+    return ejsInternString(src);
 }
 #endif /* ME_CHAR_LEN > 1 */
 
@@ -2617,28 +2626,34 @@ static int getInternHashSize(int size)
 }
 
 
-static int rebuildIntern(EjsIntern *ip)
+/*
+    Grow the shard hash. Strings stay in the same shard as the shard is selected by the string prefix. 
+    Must be called locked.
+ */
+static int rebuildShard(EjsInternShard *shard)
 {
     EjsString   *oldBuckets, *sp, *next, *head;
+    uint        hash;
     int         i, newSize, oldSize;
 
-    assert(ip);
+    assert(shard);
 
-    oldBuckets = ip->buckets;
-    newSize = getInternHashSize(ip->size + 1);
+    oldBuckets = shard->buckets;
+    newSize = getInternHashSize(shard->size + 1);
     oldSize = 0;
     if (oldBuckets) {
-        oldSize = ip->size;
+        oldSize = shard->size;
         if (oldSize >= newSize) {
             return 0;
         }
     }
-    if ((ip->buckets = mprAllocZeroed((newSize * sizeof(EjsString)))) == NULL) {
+    if ((shard->buckets = mprAllocZeroed((newSize * sizeof(EjsString)))) == NULL) {
+        shard->buckets = oldBuckets;
         return MPR_ERR_MEMORY;
     }
-    ip->size = newSize;
+    shard->size = newSize;
     for (i = 0; i < newSize; i++) {
-        sp = &ip->buckets[i];
+        sp = &shard->buckets[i];
         sp->next = sp->prev = sp;
     }
     if (oldBuckets) {
@@ -2647,7 +2662,8 @@ static int rebuildIntern(EjsIntern *ip)
             for (sp = head->next; sp != head; sp = next) {
                 next = sp->next;
                 sp->next = sp->prev = sp;
-                ejsInternString(sp);
+                hash = whash(sp->value, sp->length);
+                linkString(&shard->buckets[getBucket(shard, hash)], sp);
             }
         }
     }
@@ -2766,8 +2782,8 @@ PUBLIC EjsString *ejsCreateNonInternedString(Ejs *ejs, wchar *value, ssize len)
 
 PUBLIC void ejsManageString(EjsString *sp, int flags)
 {
-    EjsIntern   *ip;
-    MprMem      *mp;
+    EjsInternShard  *shard;
+    MprMem          *mp;
 
     if (flags & MPR_MANAGE_MARK) {
         mprMark(TYPE(sp));
@@ -2782,15 +2798,15 @@ PUBLIC void ejsManageString(EjsString *sp, int flags)
              */
             mp = MPR_GET_MEM(sp);
             if (mp->mark != MPR->heap->mark) {
-                ip = ((EjsService*) MPR->ejsService)->intern;
-                lock(ip);
+                shard = getShard(((EjsService*) MPR->ejsService)->intern, whash(sp->value, sp->length));
+                lock(shard);
                 /* Must retest here because revive may modify the mark to revive */
                 if (mp->mark != MPR->heap->mark) {
-                    ip->count--;
-                    assert(ip->count >= 0);
+                    shard->count--;
+                    assert(shard->count >= 0);
                     unlinkString(sp);
                 }
-                unlock(ip);
+                unlock(shard);
             }
         }
     }
@@ -2799,28 +2815,71 @@ PUBLIC void ejsManageString(EjsString *sp, int flags)
 
 PUBLIC EjsIntern *ejsCreateIntern(EjsService *sp)
 {
-    EjsIntern   *intern;
+    EjsIntern       *intern;
+    EjsInternShard  *shard;
+    int             i;
     
-    intern = mprAllocObj(EjsIntern, manageIntern);
-    intern->mutex = mprCreateLock();
-    rebuildIntern(intern);
+    if ((intern = mprAllocObj(EjsIntern, manageIntern)) == 0) {
+        return 0;
+    }
+    for (i = 0; i < ME_EJS_INTERN_SHARDS; i++) {
+        shard = &intern->shards[i];
+        shard->mutex = mprCreateLock();
+        rebuildShard(shard);
+    }
     return intern;
 }
 
 
 PUBLIC void ejsDestroyIntern(EjsIntern *ip)
 {
-    ip->size = 0;
-    ip->buckets = 0;
+    EjsInternShard  *shard;
+    int             i;
+
+    for (i = 0; i < ME_EJS_INTERN_SHARDS; i++) {
+        shard = &ip->shards[i];
+        shard->size = 0;
+        shard->buckets = 0;
+    }
+}
+
+
+PUBLIC void ejsGetInternStats(EjsInternStats *stats)
+{
+    EjsIntern       *ip;
+    EjsInternShard  *shard;
+    int             i;
+
+    memset(stats, 0, sizeof(EjsInternStats));
+    if (MPR->ejsService == 0 || (ip = ((EjsService*) MPR->ejsService)->intern) == 0) {
+        return;
+    }
+    stats->shards = ME_EJS_INTERN_SHARDS;
+    for (i = 0; i < ME_EJS_INTERN_SHARDS; i++) {
+        shard = &ip->shards[i];
+        lock(shard);
+        stats->count += shard->count;
+        stats->buckets += shard->size;
+        stats->accesses += shard->accesses;
+        stats->reuse += shard->reuse;
+        stats->contention += shard->contention;
+        unlock(shard);
+    }
 }
 
 
 static void manageIntern(EjsIntern *intern, int flags)
 {
+    EjsInternShard  *shard;
+    int             i;
+
     if (flags & MPR_MANAGE_MARK) {
         /* Do not mark strings - prevents GC */
-        mprMark(intern->buckets);
-        mprMark(intern->mutex);
+        for (i = 0; i < ME_EJS_INTERN_SHARDS; i++) {
+            shard = &intern->shards[i];
+            mprMark(shard->buckets);
+            mprMark(shard->mutex);
+        }
 
     } else if (flags & MPR_MANAGE_FREE) {
         ejsDestroyIntern(intern);
@@ -12,15 +12,46 @@
 typedef struct Message {
     EjsWorker   *worker;
     cchar       *callback;
-    char        *data;
+    MprBuf      *data;                  /* Structured clone of the message data */
+    MprList     *refs;                  /* Strings and transferred ByteArray storage referenced by data */
     EjsObj      *message;
     EjsObj      *stack;
     int         callbackSlot;
 } Message;
 
+/*
+    Structured clone encoding. Values are encoded into a binary buffer in the sending VM and decoded in the receiving VM.
+    Strings are immutable and VMs in a process share the same heap, so strings are passed by reference via the message
+    refs list rather than copied. ByteArrays in the postMessage transfer list have their storage moved to the receiver.
+    Objects seen more than once (including cycles) are encoded as back references.
+ */
+#define CLONE_UNDEFINED     0
+#define CLONE_NULL          1
+#define CLONE_TRUE          2
+#define CLONE_FALSE         3
+#define CLONE_NUMBER        4               /* double */
+#define CLONE_STRING        5               /* ref */
+#define CLONE_DATE          6               /* time */
+#define CLONE_ARRAY         7               /* length, elements */
+#define CLONE_OBJECT        8               /* count, (name ref, value) pairs */
+#define CLONE_BYTES         9               /* length, bytes */
+#define CLONE_TRANSFER      10              /* ref, size, readPosition, writePosition, endian */
+#define CLONE_BACKREF       11              /* index of a previously encoded object */
+
+typedef struct Clone {
+    MprBuf      *buf;                   /* Encoded data */
+    MprList     *refs;                  /* Referenced strings and ByteArray storage */
+    MprList     *seen;                  /* Objects encoded or decoded so far */
+    EjsArray    *transfer;              /* ByteArrays to transfer (encode only) */
+    MprList     *moved;                 /* Transferred ByteArrays to empty once encoding succeeds (encode only) */
+} Clone;
+
 /*********************************** Forwards *********************************/
 
 static void addWorker(Ejs *ejs, EjsWorker *worker);
+static EjsAny *cloneValue(Ejs *ejs, Ejs *src, EjsAny *vp);
+static EjsAny *decodeMessage(Ejs *ejs, MprBuf *data, MprList *refs);
+static int encodeMessage(Ejs *ejs, Message *msg, EjsAny *vp, EjsArray *transfer);
 static int join(Ejs *ejs, EjsObj *workers, int timeout);
 static void handleError(Ejs *ejs, EjsWorker *worker, EjsObj *exception, int throwOutside);
 static void loadFile(EjsWorker *insideWorker, cchar *filename);
@@ -203,7 +234,6 @@ static EjsObj *startWorker(Ejs *ejs, EjsWorker *outsideWorker, int timeout)
 {
     EjsWorker   *insideWorker;
     Ejs         *inside;
-    EjsString   *result;
 
     assert(ejs);
     assert(outsideWorker);
@@ -238,11 +268,7 @@ static EjsObj *startWorker(Ejs *ejs, EjsWorker *outsideWorker, int timeout)
     if (join(ejs, (EjsObj*) outsideWorker, timeout) < 0) {
         return ESV(undefined);
     }
-    result = ejsToJSON(inside, inside->result, NULL);
-    if (result == 0) {
-        return ESV(null);
-    }
-    return ejsDeserialize(ejs, result);
+    return cloneValue(ejs, inside, inside->result);
 }
 
 
@@ -493,7 +519,7 @@ static int doMessage(Message *msg, MprEvent *mprEvent)
     }
     worker->event = event;
     if (msg->data) {
-        ejsSetProperty(ejs, event, ES_Event_data, ejsCreateStringFromAsc(ejs, msg->data));
+        ejsSetProperty(ejs, event, ES_Event_data, decodeMessage(ejs, msg->data, msg->refs));
     }
     if (msg->message) {
         ejsSetProperty(ejs, event, ES_ErrorEvent_message, msg->message);
@@ -550,7 +576,6 @@ static EjsObj *workerPreeval(Ejs *ejs, EjsWorker *worker, int argc, EjsObj **arg
 {
     Ejs         *inside;
     EjsWorker   *insideWorker;
-    EjsString   *result;
 
     assert(!worker->inside);
 
@@ -567,11 +592,7 @@ static EjsObj *workerPreeval(Ejs *ejs, EjsWorker *worker, int argc, EjsObj **arg
         handleError(ejs, worker, inside->exception, 1);
         return 0;
     }
-    result = ejsToJSON(inside, inside->result, NULL);
-    if (result == 0) {
-        return ESV(null);
-    }
-    return ejsDeserialize(ejs, result);
+    return cloneValue(ejs, inside, inside->result);
 }
 
 
@@ -583,7 +604,6 @@ static EjsObj *workerPreload(Ejs *ejs, EjsWorker *worker, int argc, EjsObj **arg
 {
     Ejs         *inside;
     EjsWorker   *insideWorker;
-    EjsString   *result;
 
     assert(argc > 0 && ejsIs(ejs, argv[0], Path));
     assert(!worker->inside);
@@ -601,11 +621,7 @@ static EjsObj *workerPreload(Ejs *ejs, EjsWorker *worker, int argc, EjsObj **arg
         handleError(ejs, worker, inside->exception, 1);
         return 0;
     }
-    result = ejsToJSON(inside, inside->result, NULL);
-    if (result == 0) {
-        return ESV(null);
-    }
-    return ejsDeserialize(ejs, result);
+    return cloneValue(ejs, inside, inside->result);
 }
 
 
@@ -613,6 +629,7 @@ static void manageMessage(Message *msg, int flags)
 {
     if (flags & MPR_MANAGE_MARK) {
         mprMark(msg->data);
+        mprMark(msg->refs);
         mprMark(msg->message);
         mprMark(msg->stack);
     }
@@ -628,11 +645,11 @@ static Message *createMessage()
 /*
     Post a message to this worker. Note: the worker is the destination worker which may be the parent.
 
-    function postMessage(data: Object, ports: Array = null): Void
+    function postMessage(data: Object, transfer: Array = null): Void
  */
 static EjsObj *workerPostMessage(Ejs *ejs, EjsWorker *worker, int argc, EjsObj **argv)
 {
-    EjsString       *data;
+    EjsArray        *transfer;
     EjsWorker       *target;
     MprDispatcher   *dispatcher;
     Message         *msg;
@@ -641,20 +658,23 @@ static EjsObj *workerPostMessage(Ejs *ejs, EjsWorker *worker, int argc, EjsObj *
         ejsThrowStateError(ejs, "Worker has completed");
         return 0;
     }
+    transfer = (argc > 1 && ejsIs(ejs, argv[1], Array)) ? (EjsArray*) argv[1] : 0;
+
     /*
-        Create the event with serialized data in the originating interpreter. It owns the data.
+        Create the event with the encoded data in the originating interpreter. It owns the data.
      */
     ejsBlockGC(ejs);
-    if ((data = ejsToJSON(ejs, argv[0], NULL)) == 0) {
-        ejsThrowArgError(ejs, "Cannot serialize message data");
-        return 0;
-    }
     if ((msg = createMessage()) == 0) {
         ejsThrowMemoryError(ejs);
         return 0;
     }
+    if (encodeMessage(ejs, msg, argv[0], transfer) < 0) {
+        if (!ejs->exception) {
+            ejsThrowArgError(ejs, "Cannot serialize message data");
+        }
+        return 0;
+    }
     target = worker->pair;
-    msg->data = ejsToMulti(ejs, data);
     msg->worker = target;
     msg->callback = "onmessage";
     msg->callbackSlot = ES_Worker_onmessage;
@@ -804,7 +824,7 @@ static void handleError(Ejs *ejs, EjsWorker *worker, EjsObj *exception, int thro
     inside = worker->pair->ejs;
     
     inside->exception = 0;
-    e = ejsDeserialize(ejs, ejsSerialize(inside, exception, 0));
+    e = cloneValue(ejs, inside, exception);
     inside->exception = exception;
 
     /*
@@ -829,6 +849,367 @@ static void handleError(Ejs *ejs, EjsWorker *worker, EjsObj *exception, int thro
     mprCreateEvent(dispatcher, "doMessage-error", 0, (MprEventProc) doMessage, msg, 0);
 }
 
+/*********************************** Cloning **********************************/
+
+static void putNum(MprBuf *buf, int64 value)
+{
+    mprPutBlockToBuf(buf, (char*) &value, sizeof(value));
+}
+
+
+static void putRef(Clone *clone, void *ref)
+{
+    putNum(clone->buf, mprAddItem(clone->refs, ref));
+}
+
+
+static bool isTransfer(Clone *clone, EjsByteArray *ap)
+{
+    int     i;
+
+    if (clone->transfer) {
+        for (i = 0; i < clone->transfer->length; i++) {
+            if (clone->transfer->data[i] == (EjsObj*) ap) {
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+
+static int encodeValue(Ejs *ejs, Clone *clone, EjsAny *vp);
+
+static void encodeBytes(Ejs *ejs, Clone *clone, EjsByteArray *ap)
+{
+    ssize   len;
+
+    if (isTransfer(clone, ap)) {
+        /*
+            Move the storage to the receiver. The sender's ByteArray is emptied by encodeMessage only if the 
+            entire message can be encoded.
+         */
+        mprPutCharToBuf(clone->buf, CLONE_TRANSFER);
+        putRef(clone, ap->value);
+        putNum(clone->buf, ap->size);
+        putNum(clone->buf, ap->readPosition);
+        putNum(clone->buf, ap->writePosition);
+        putNum(clone->buf, ap->endian);
+        mprAddItem(clone->moved, ap);
+    } else {
+        len = ap->writePosition - ap->readPosition;
+        mprPutCharToBuf(clone->buf, CLONE_BYTES);
+        putNum(clone->buf, len);
+        mprPutBlockToBuf(clone->buf, (char*) &ap->value[ap->readPosition], len);
+    }
+}
+
+
+/*
+    Encode the same properties as JSON serialization. Hidden properties, initializers, functions and undefined
+    values are skipped.
+ */
+static int encodeObject(Ejs *ejs, Clone *clone, EjsObj *obj)
+{
+    EjsTrait    *trait;
+    EjsObj      *pp;
+    EjsName     qname;
+    ssize       countPos;
+    int64       items;
+    int         slotNum, count;
+
+    mprPutCharToBuf(clone->buf, CLONE_OBJECT);
+    countPos = mprGetBufLength(clone->buf);
+    putNum(clone->buf, 0);
+
+    items = 0;
+    count = ejsGetLength(ejs, obj);
+    for (slotNum = 0; slotNum < count; slotNum++) {
+        trait = ejsGetPropertyTraits(ejs, obj, slotNum);
+        if (trait && (trait->attributes & (EJS_TRAIT_HIDDEN | EJS_TRAIT_DELETED | EJS_FUN_INITIALIZER | 
+                EJS_FUN_MODULE_INITIALIZER))) {
+            continue;
+        }
+        pp = ejsGetProperty(ejs, obj, slotNum);
+        if (ejs->exception) {
+            return EJS_ERR;
+        }
+        if (pp == 0 || ejsIs(ejs, pp, Void) || ejsIsFunction(ejs, pp)) {
+            continue;
+        }
+        qname = ejsGetPropertyName(ejs, obj, slotNum);
+        if (qname.name == 0) {
+            continue;
+        }
+        putRef(clone, qname.name);
+        if (encodeValue(ejs, clone, pp) < 0) {
+            return EJS_ERR;
+        }
+        items++;
+    }
+    memcpy(&clone->buf->start[countPos], &items, sizeof(items));
+    return 0;
+}
+
+
+static int encodeValue(Ejs *ejs, Clone *clone, EjsAny *vp)
+{
+    EjsArray    *ap;
+    MprBuf      *buf;
+    double      d;
+    int         i;
+
+    buf = clone->buf;
+    if (vp == 0 || ejsIs(ejs, vp, Void)) {
+        mprPutCharToBuf(buf, CLONE_UNDEFINED);
+
+    } else if (ejsIs(ejs, vp, Null)) {
+        mprPutCharToBuf(buf, CLONE_NULL);
+
+    } else if (ejsIs(ejs, vp, Boolean)) {
+        mprPutCharToBuf(buf, ((EjsBoolean*) vp)->value ? CLONE_TRUE : CLONE_FALSE);
+
+    } else if (ejsIs(ejs, vp, Number)) {
+        mprPutCharToBuf(buf, CLONE_NUMBER);
+        d = ((EjsNumber*) vp)->value;
+        mprPutBlockToBuf(buf, (char*) &d, sizeof(d));
+
+    } else if (ejsIs(ejs, vp, String)) {
+        mprPutCharToBuf(buf, CLONE_STRING);
+        putRef(clone, vp);
+
+    } else if (ejsIs(ejs, vp, Date)) {
+        mprPutCharToBuf(buf, CLONE_DATE);
+        putNum(buf, ((EjsDate*) vp)->value);
+
+    } else if (ejsIsFunction(ejs, vp) || ejsIsType(ejs, vp)) {
+        mprPutCharToBuf(buf, CLONE_UNDEFINED);
+
+    } else if (ejsIs(ejs, vp, ByteArray) || ejsIs(ejs, vp, Array) || 
+            (ejsIsPot(ejs, vp) && (TYPE(vp) == ESV(Object) || ejsGetLength(ejs, vp) > 0))) {
+        if (VISITED(vp)) {
+            mprPutCharToBuf(buf, CLONE_BACKREF);
+            putNum(buf, mprLookupItem(clone->seen, vp));
+            return 0;
+        }
+        SET_VISITED(vp, 1);
+        mprAddItem(clone->seen, vp);
+        if (ejsIs(ejs, vp, ByteArray)) {
+            encodeBytes(ejs, clone, vp);
+
+        } else if (ejsIs(ejs, vp, Array)) {
+            ap = vp;
+            mprPutCharToBuf(buf, CLONE_ARRAY);
+            putNum(buf, ap->length);
+            for (i = 0; i < ap->length; i++) {
+                if (encodeValue(ejs, clone, ap->data[i]) < 0) {
+                    return EJS_ERR;
+                }
+            }
+        } else {
+            return encodeObject(ejs, clone, vp);
+        }
+    } else {
+        /* Other native types such as Path, Uri and RegExp are passed as strings */
+        mprPutCharToBuf(buf, CLONE_STRING);
+        putRef(clone, ejsToString(ejs, vp));
+    }
+    return ejs->exception ? EJS_ERR : 0;
+}
+
+
+/*
+    Encode a value into a message. ByteArrays in the transfer list are moved rather than copied. If the message cannot
+    be encoded, the sender's ByteArrays are unchanged.
+ */
+static int encodeMessage(Ejs *ejs, Message *msg, EjsAny *vp, EjsArray *transfer)
+{
+    Clone           clone;
+    EjsObj          *obj;
+    EjsByteArray    *ap;
+    int             rc, next;
+
+    clone.buf = mprCreateBuf(0, 0);
+    clone.refs = mprCreateList(0, MPR_LIST_STABLE);
+    clone.seen = mprCreateList(0, MPR_LIST_STATIC_VALUES | MPR_LIST_STABLE);
+    clone.moved = mprCreateList(0, MPR_LIST_STATIC_VALUES | MPR_LIST_STABLE);
+    clone.transfer = transfer;
+    if (clone.buf == 0 || clone.refs == 0 || clone.seen == 0 || clone.moved == 0) {
+        ejsThrowMemoryError(ejs);
+        return EJS_ERR;
+    }
+    rc = encodeValue(ejs, &clone, vp);
+    for (ITERATE_ITEMS(clone.seen, obj, next)) {
+        SET_VISITED(obj, 0);
+    }
+    if (rc == 0) {
+        for (ITERATE_ITEMS(clone.moved, ap, next)) {
+            ap->value = mprAlloc(0);
+            ap->size = 0;
+            ap->readPosition = ap->writePosition = 0;
+        }
+    }
+    msg->data = clone.buf;
+    msg->refs = clone.refs;
+    return rc;
+}
+
+
+static int64 getNum(MprBuf *buf)
+{
+    int64   value;
+
+    if (mprGetBlockFromBuf(buf, (char*) &value, sizeof(value)) != sizeof(value)) {
+        return -1;
+    }
+    return value;
+}
+
+
+static EjsAny *decodeValue(Ejs *ejs, Clone *clone)
+{
+    EjsByteArray    *ap;
+    EjsArray        *array;
+    EjsObj          *obj, *vp;
+    EjsName         qname;
+    MprBuf          *buf;
+    double          d;
+    int64           count, i, len;
+    int             tag;
+
+    buf = clone->buf;
+    vp = 0;
+    tag = mprGetCharFromBuf(buf);
+
+    switch (tag) {
+    case CLONE_UNDEFINED:
+        return ESV(undefined);
+
+    case CLONE_NULL:
+        return ESV(null);
+
+    case CLONE_TRUE:
+        return ESV(true);
+
+    case CLONE_FALSE:
+        return ESV(false);
+
+    case CLONE_NUMBER:
+        if (mprGetBlockFromBuf(buf, (char*) &d, sizeof(d)) == sizeof(d)) {
+            vp = (EjsObj*) ejsCreateNumber(ejs, d);
+        }
+        break;
+
+    case CLONE_STRING:
+        vp = mprGetItem(clone->refs, (int) getNum(buf));
+        break;
+
+    case CLONE_DATE:
+        vp = (EjsObj*) ejsCreateDate(ejs, getNum(buf));
+        break;
+
+    case CLONE_BACKREF:
+        vp = mprGetItem(clone->seen, (int) getNum(buf));
+        break;
+
+    case CLONE_ARRAY:
+        if ((len = getNum(buf)) < 0 || (array = ejsCreateArray(ejs, (int) len)) == 0) {
+            break;
+        }
+        mprAddItem(clone->seen, array);
+        for (i = 0; i < len; i++) {
+            if ((vp = decodeValue(ejs, clone)) == 0) {
+                return 0;
+            }
+            array->data[i] = vp;
+        }
+        return array;
+
+    case CLONE_OBJECT:
+        if ((count = getNum(buf)) < 0) {
+            break;
+        }
+        obj = ejsCreateEmptyPot(ejs);
+        mprAddItem(clone->seen, obj);
+        for (i = 0; i < count; i++) {
+            if ((qname.name = mprGetItem(clone->refs, (int) getNum(buf))) == 0) {
+                ejsThrowSyntaxError(ejs, "Corrupt worker message");
+                return 0;
+            }
+            qname.space = ESV(empty);
+            if ((vp = decodeValue(ejs, clone)) == 0) {
+                return 0;
+            }
+            ejsSetPropertyByName(ejs, obj, qname, vp);
+        }
+        return obj;
+
+    case CLONE_BYTES:
+        if ((len = getNum(buf)) < 0 || len > mprGetBufLength(buf) || (ap = ejsCreateByteArray(ejs, len)) == 0) {
+            break;
+        }
+        mprGetBlockFromBuf(buf, (char*) ap->value, len);
+        ejsSetByteArrayPositions(ejs, ap, 0, len);
+        mprAddItem(clone->seen, ap);
+        return ap;
+
+    case CLONE_TRANSFER:
+        if ((ap = ejsCreateObj(ejs, ESV(ByteArray), 0)) == 0) {
+            break;
+        }
+        ap->value = mprGetItem(clone->refs, (int) getNum(buf));
+        ap->size = getNum(buf);
+        ap->readPosition = getNum(buf);
+        ap->writePosition = getNum(buf);
+        ap->endian = (int) getNum(buf);
+        ap->swap = (ap->endian != mprGetEndian());
+        ap->async = -1;
+        ap->resizable = 1;
+        ap->growInc = ME_MAX_BUFFER;
+        mprAddItem(clone->seen, ap);
+        return ap;
+    }
+    if (vp == 0 && !ejs->exception) {
+        ejsThrowSyntaxError(ejs, "Corrupt worker message");
+    }
+    return vp;
+}
+
+
+/*
+    Decode a message in the receiving interpreter
+ */
+static EjsAny *decodeMessage(Ejs *ejs, MprBuf *data, MprList *refs)
+{
+    Clone       clone;
+
+    clone.buf = data;
+    clone.refs = refs;
+    clone.seen = mprCreateList(0, MPR_LIST_STABLE);
+    clone.transfer = 0;
+    clone.moved = 0;
+    return decodeValue(ejs, &clone);
+}
+
+
+/*
+    Clone a value from one interpreter into another
+ */
+static EjsAny *cloneValue(Ejs *ejs, Ejs *src, EjsAny *vp)
+{
+    Message     msg;
+    EjsAny      *result;
+
+    memset(&msg, 0, sizeof(msg));
+    if (vp == 0 || encodeMessage(src, &msg, vp, NULL) < 0) {
+        return ESV(null);
+    }
+    if ((result = decodeMessage(ejs, msg.data, msg.refs)) == 0) {
+        return ESV(null);
+    }
+    return result;
+}
+
 
 PUBLIC EjsWorker *ejsCreateWorker(Ejs *ejs)
 {
@@ -18,6 +18,7 @@ static EjsObj *xmlToString(Ejs *ejs, EjsObj *vp, int argc, EjsObj **argv);
 static EjsObj *xml_parent(Ejs *ejs, EjsXML *xml, int argc, EjsObj **argv);
 
 static bool allDigitsForXml(EjsString *name);
+static EjsXML *copyXml(Ejs *ejs, EjsXML *xml, EjsXML *parent);
 static bool deepCompare(EjsXML *lhs, EjsXML *rhs);
 static ssize readStringData(MprXml *xp, void *data, char *buf, ssize size);
 static ssize readFileData(MprXml *xp, void *data, char *buf, ssize size);
@@ -32,47 +33,64 @@ static EjsXML *createXml(Ejs *ejs, EjsType *type, int size)
 
 PUBLIC EjsAny *cloneXml(Ejs *ejs, EjsXML *xml, bool deep)
 {
-    EjsXML      *root, *elt;
+    return ejsCloneXML(ejs, xml);
+}
+
+
+/*
+    Copy a list of attributes or elements. Copies are parented by the new node.
+ */
+static MprList *copyXmlList(Ejs *ejs, MprList *list, EjsXML *parent)
+{
+    MprList     *result;
+    EjsXML      *elt;
     int         next;
 
-    if (xml == 0) {
+    if ((result = mprCreateList(mprGetListLength(list), 0)) == 0) {
         return 0;
     }
-    if (xml->kind == EJS_XML_LIST) {
-        root = ejsCreateXMLList(ejs, xml->targetObject, xml->targetProperty);
-    } else {
-        root = ejsCreateXML(ejs, xml->kind, xml->qname, NULL, xml->value);
+    for (ITERATE_ITEMS(list, elt, next)) {
+        assert(ejsIsXML(ejs, elt));
+        if ((elt = copyXml(ejs, elt, parent)) == 0) {
+            return 0;
+        }
+        mprAddItem(result, elt);
     }
-    if (root == 0) {
+    return result;
+}
+
+
+/*
+    Copy a node and its descendants directly without dispatching through ejsClone for each node
+ */
+static EjsXML *copyXml(Ejs *ejs, EjsXML *xml, EjsXML *parent)
+{
+    EjsXML      *copy;
+
+    if ((copy = ejsAlloc(ejs, TYPE(xml), 0)) == 0) {
         return 0;
     }
+    copy->qname = xml->qname;
+    copy->kind = xml->kind;
+    copy->value = xml->value;
+    copy->flags = xml->flags;
+    copy->targetObject = xml->targetObject;
+    copy->targetProperty = xml->targetProperty;
+    /* The parser makes the root element its own parent */
+    copy->parent = (xml->parent == xml) ? copy : parent;
     //  TODO - must copy inScopeNamespaces?
 
-    if (xml->attributes) {
-        root->attributes = mprCreateList(-1, 0);
-        for (next = 0; (elt = (EjsXML*) mprGetNextItem(xml->attributes, &next)) != 0; ) {
-            elt = ejsClone(ejs, elt, 1);
-            if (elt) {
-                elt->parent = root;
-                mprAddItem(root->attributes, elt);
-            }
-        }
+    if (xml->attributes && (copy->attributes = copyXmlList(ejs, xml->attributes, copy)) == 0) {
+        return 0;
     }
     if (xml->elements) {
-        root->elements = mprCreateList(-1, 0);
-        for (next = 0; (elt = mprGetNextItem(xml->elements, &next)) != 0; ) {
-            assert(ejsIsXML(ejs, elt));
-            elt = ejsClone(ejs, elt, 1);
-            if (elt) {
-                elt->parent = root;
-                mprAddItem(root->elements, elt);
-            }
+        if ((copy->elements = copyXmlList(ejs, xml->elements, copy)) == 0) {
+            return 0;
         }
+    } else if (xml->kind == EJS_XML_LIST) {
+        copy->elements = mprCreateList(-1, 0);
     }
-    if (mprHasMemError()) {
-        return 0;
-    }
-    return root;
+    return copy;
 }
 
 
@@ -989,6 +1007,20 @@ PUBLIC EjsXML *ejsCreateXML(Ejs *ejs, int kind, EjsName qname, EjsXML *parent, E
 }
 
 
+PUBLIC EjsXML *ejsCloneXML(Ejs *ejs, EjsXML *xml)
+{
+    EjsXML      *copy;
+
+    if (xml == 0) {
+        return 0;
+    }
+    if ((copy = copyXml(ejs, xml, NULL)) == 0 || mprHasMemError()) {
+        return 0;
+    }
+    return copy;
+}
+
+
 PUBLIC EjsXML *ejsConfigureXML(Ejs *ejs, EjsXML *xml, int kind, EjsString *name, EjsXML *parent, EjsString *value)
 {
     xml->qname.name = name;
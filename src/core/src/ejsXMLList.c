@@ -47,13 +47,10 @@ static EjsObj *cloneXmlList(Ejs *ejs, EjsXML *list, bool deep)
 {
     EjsXML  *newList;
 
-    //  TODO - implement deep copy
-    newList = ejsCreateObj(ejs, TYPE(list), 0);
-    if (newList == 0) {
+    if ((newList = ejsCloneXML(ejs, list)) == 0) {
         ejsThrowMemoryError(ejs);
         return 0;
     }
-    //  TODO incomplete
     return (EjsObj*) newList;
 }
 
@@ -0,0 +1,35 @@
+/*
+    Array set operations
+ */
+
+//  Order of first occurrence is preserved
+
+assert([1, 2, 3, 2, 1, "a", "a", "1"].unique() == "1,2,3,a,1")
+assert(([1, 2, 3, 4] & [4, 2, 9, 2]) == "2,4")
+assert(([1, 2, 2, 3] | [3, 4, "4", 1]) == "1,2,3,4,4")
+
+
+//  All matching items are removed
+
+assert(([1, 1, 2, 3, 1, "x"] - [1, "x"]) == "2,3")
+assert([1, 2, 1, 3].removeElements(1, 3) == "2")
+
+
+//  Objects match by reference, strings and paths by value
+
+let o = {}
+assert(([o, {}, o] | []).length == 2)
+assert(["ab" + "c", "abc"].unique().length == 1)
+assert([Path("a"), Path("b"), Path("a")].unique().length == 2)
+assert([0, -0].unique().length == 1)
+
+
+//  Large arrays
+
+let ids = []
+for (i = 0; i < 20000; i++) {
+    ids.push(i % 5000)
+}
+assert(ids.clone().unique().length == 5000)
+assert((ids & [4999, 0, 7]).length == 3)
+assert((ids - ids.slice(0, 2500)).length == 10000)
@@ -0,0 +1,79 @@
+/*
+    Array sort
+ */
+
+//  Default lexical order
+
+assert([10, 9, 1, 100, -5, -10, -1, 0, 25, 3].sort() == "-1,-10,-5,0,1,10,100,25,3,9")
+assert([10, 9, 1, 100, -5, -10, -1, 0, 25, 3].sort(null, -1) == "9,3,25,100,10,1,0,-5,-10,-1")
+assert([1.5, 10, 2, 0.5].sort() == "0.5,1.5,10,2")
+assert(["b", "a", "C", "ab"].sort() == "C,a,ab,b")
+assert([3, "a", 1, true].sort() == "1,3,a,true")
+assert([].sort().length == 0)
+
+
+//  Compare functions taking the array and indexes, or the items
+
+let a = [5, 3, 8, 1]
+assert(a.sort(function (array, i, j) array[i] - array[j]) == "1,3,5,8")
+assert(a.sort(function (x, y) y - x) == "8,5,3,1")
+
+
+//  Stable for equal items
+
+let records = []
+for (i = 0; i < 300; i++) {
+    records.push({key: i % 4, index: i})
+}
+records.sort(function (x, y) x.key - y.key)
+for (i = 1; i < records.length; i++) {
+    assert(records[i - 1].key < records[i].key ||
+        (records[i - 1].key == records[i].key && records[i - 1].index < records[i].index))
+}
+
+
+//  Large and reversed arrays
+
+let big = []
+for (i = 0; i < 5000; i++) {
+    big.push(5000 - i)
+}
+big.sort(function (array, i, j) array[i] - array[j])
+assert(big[0] == 1 && big[4999] == 5000)
+big.sort()
+assert(big[0] == 1 && big[1] == 10 && big[2] == 100 && big[3] == 1000)
+
+
+//  The array is unchanged if the compare function throws
+
+a = [3, 1, 2]
+let caught = false
+try {
+    a.sort(function (x, y) { throw "stop" })
+} catch (e) {
+    caught = true
+}
+assert(caught)
+assert(a == "3,1,2")
+
+
+//  Elements replaced by the compare function are retained until the sort completes
+
+a = []
+for (i = 0; i < 20; i++) {
+    a.push({value: 20 - i})
+}
+let collected = false
+a.sort(function (x, y) {
+    if (!collected) {
+        for (j = 0; j < a.length; j++) {
+            a[j] = {value: -1}
+        }
+        GC.run()
+        collected = true
+    }
+    return x.value - y.value
+})
+for (i = 0; i < 20; i++) {
+    assert(a[i].value == i + 1)
+}
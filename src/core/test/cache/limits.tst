@@ -0,0 +1,32 @@
+/*
+    Key limit, eviction and statistics tests
+ */
+
+cache = new Cache("local", {shared: false, keys: 10})
+
+//  Writing more keys than the limit evicts older keys
+for (i in 20) {
+    cache.write("key" + i, "value" + i)
+}
+let stats = cache.stats
+assert(stats.keys == 10)
+assert(stats.evictions == 10)
+assert(cache.read("key19") == "value19")
+
+//  Hit and miss counters
+cache.read("key19")
+cache.read("missing")
+stats = cache.stats
+assert(stats.hits == 2)
+assert(stats.misses == 1)
+
+cache.destroy()
+
+//  Memory is accounted for keys and data
+cache = new Cache("local", {shared: false})
+cache.write("a", "1234")
+assert(cache.stats.memory == 5)
+cache.remove("a")
+assert(cache.stats.keys == 0)
+assert(cache.stats.memory == 0)
+cache.destroy()
@@ -0,0 +1,38 @@
+/*
+    Arrays of records with the same, similar and different keys
+ */
+
+//  Records with the same keys
+
+let text = "["
+for (i = 0; i < 100; i++) {
+    text += (i ? "," : "") + '{"id": ' + i + ', "a": 1, "b": 2, "c": 3, "d": 4, "e": 5, "f": 6, "g": 7, "h": 8, "i": ' + i + '}'
+}
+text += "]"
+let records = deserialize(text)
+assert(records.length == 100)
+for (i = 0; i < 100; i++) {
+    let r = records[i]
+    assert(r.id == i && r.a == 1 && r.h == 8 && r.i == i)
+    assert(Object.getOwnPropertyCount(r) == 10)
+}
+records[5].extra = true
+records[6].id = -1
+delete records[7].a
+assert(records[5].extra && records[5].id == 5)
+assert(!records[4].extra && records[4].a == 1)
+assert(records[6].id == -1 && records[8].id == 8)
+assert(records[7].a == undefined && records[8].a == 1)
+
+
+//  Records that diverge, end early, repeat keys or nest
+
+records = deserialize('[{"x": 1, "y": 2, "z": 3}, {"x": 4, "y": 5}, {"x": 6, "q": 7, "z": 8}, {"x": 9, "x": 10}, ' +
+    '{"x": 11, "y": {"x": 12, "y": 13}, "z": 14}, {"x": 15, "y": {"x": 16, "y": 17}, "z": 18}]')
+assert(serialize(records[0]) == '{"x":1,"y":2,"z":3}')
+assert(serialize(records[1]) == '{"x":4,"y":5}')
+assert(serialize(records[2]) == '{"x":6,"q":7,"z":8}')
+assert(serialize(records[3]) == '{"x":10}')
+assert(serialize(records[4]) == '{"x":11,"y":{"x":12,"y":13},"z":14}')
+assert(serialize(records[5]) == '{"x":15,"y":{"x":16,"y":17},"z":18}')
+assert(records[2].y == undefined && records[1].z == undefined)
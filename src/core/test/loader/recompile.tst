@@ -0,0 +1,22 @@
+/*
+    Test recompiling a module while it is loaded
+ */
+
+let ejsc = App.test.bin.join('ejsc')
+let source = Path("recompile.es")
+let modfile = Path("recompile.mod")
+
+source.write('module recompile {\n    public function recompileValue() "first-" + [1, 2, 3].join("") + "-padded-to-span-the-file"\n}\n')
+Cmd.run(ejsc + " " + source)
+load(modfile)
+let first = recompileValue()
+assert(first == "first-123-padded-to-span-the-file")
+
+//  Rewriting the module file must not change the byte code of the loaded module
+source.write('module recompile {\n    public function recompileValue() "x"\n}\n')
+Cmd.run(ejsc + " " + source)
+assert(recompileValue() == first)
+assert(recompileValue() == first)
+
+source.remove()
+modfile.remove()
@@ -0,0 +1,55 @@
+/*
+    Test regular expressions sharing cached compiled patterns
+ */
+
+//  Each evaluation of a literal creates a distinct object with its own match state
+
+function literal() {
+    return /a(b)c/g
+}
+let r1 = literal()
+let r2 = literal()
+assert(r1 !== r2)
+assert(r1.exec("xabcabc") == "abc,b")
+assert(r1.lastIndex == 4)
+assert(r2.lastIndex == 0)
+assert(r2.exec("abc") == "abc,b")
+assert(r1.matched == "abc")
+
+
+//  Same source with different flags must not share settings
+
+let g = new RegExp("abc", "g")
+let p = new RegExp("abc")
+let i = new RegExp("abc", "i")
+assert(g.global && !p.global && !i.global)
+assert(i.ignoreCase && !g.ignoreCase)
+assert(i.test("ABC") && !p.test("ABC"))
+assert(/abc/i.test("ABC") && !/abc/.test("ABC"))
+
+
+//  Repeated use in a loop
+
+let count = 0
+for (let n = 0; n < 100; n++) {
+    if (/^item-(\d+)$/.test("item-" + n)) {
+        count++
+    }
+    if (new RegExp("^[0-9]+$").test("" + n)) {
+        count++
+    }
+}
+assert(count == 200)
+
+
+//  Compile errors are reported every time
+
+for (let n = 0; n < 2; n++) {
+    let caught = false
+    try {
+        new RegExp("(")
+    } catch (e) {
+        caught = true
+    }
+    assert(caught)
+}
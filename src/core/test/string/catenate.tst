@@ -0,0 +1,40 @@
+/*
+    catenate.tst - Test building long strings by catenation
+ */
+
+//  Long catenated strings must compare equal by value
+var a = "", b = ""
+for (i = 0; i < 100; i++) {
+    a += "abcdefghij"
+    b += "abcdefghij"
+}
+assert(a.length == 1000)
+assert(a == b)
+assert(a === b)
+assert(!(a != b))
+assert(a + "x" != a)
+assert(a < a + "x")
+
+//  Long catenated strings used as property names
+var o = {}
+o[a] = 7
+assert(o[b] == 7)
+assert(b in o)
+assert(o.hasOwnProperty(b))
+delete o[b]
+assert(!(a in o))
+
+//  Array searching and switch use equality
+assert([1, a, 3].indexOf(b) == 1)
+switch (b) {
+case a:
+    break
+default:
+    assert(false)
+}
+
+//  Concat and toString
+assert("a".concat("b", 1, "c") == "ab1c")
+assert(a.concat(b).length == 2000)
+assert(["x", undefined, "y"].toString() == "x,,y")
+assert([1, [2, 3]].toString() == "1,2,3")
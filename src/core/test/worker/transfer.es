@@ -0,0 +1,12 @@
+/*
+    Structured clone worker
+ */
+
+let ba = new ByteArray
+ba.write("Hello World")
+let o = {name: "Mary", list: [1, 2, {x: 3}], when: new Date(0), bytes: ba, again: ba}
+o.self = o
+postMessage(o, [ba])
+if (ba.length != 0) {
+    throw new Error("ByteArray was not transferred")
+}
@@ -0,0 +1,43 @@
+/*
+    Structured clone and transfer Worker Tests
+ */
+
+let w = new Worker("transfer.es")
+let msg = null
+w.onmessage = function (e) {
+    msg = e.data
+}
+w.onerror = function (e) {
+    assert(false)
+}
+
+//  A message that cannot be encoded is not sent and leaves transferred ByteArrays with the sender
+class Unclonable {
+    override function toString(): String {
+        throw new Error("Cannot clone")
+        return ""
+    }
+}
+let kept = new ByteArray
+kept.write("Keep")
+let sent = true
+try {
+    w.postMessage({bytes: kept, bad: new Unclonable}, [kept])
+} catch (e) {
+    sent = false
+}
+assert(!sent)
+assert(kept.toString() == "Keep")
+
+Worker.join(w)
+
+assert(msg)
+assert(msg.name == "Mary")
+assert(msg.list.length == 3)
+assert(msg.list[2].x == 3)
+assert(msg.when is Date)
+assert(msg.when.time == 0)
+assert(msg.bytes is ByteArray)
+assert(msg.bytes.toString() == "Hello World")
+assert(msg.again === msg.bytes)
+assert(msg.self === msg)
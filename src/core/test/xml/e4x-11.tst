@@ -0,0 +1,36 @@
+/*
+  	E4X literals evaluated repeatedly must yield independent objects
+ */
+
+function order(id) {
+    var o = <order id="0"><item>Widget</item><item>Gadget</item></order>
+    o.@id = id
+    return o
+}
+
+var first = order(1)
+var second = order(2)
+assert(first != second)
+assert(first.@id == "1")
+assert(second.@id == "2")
+
+//  Modifying one must not change later evaluations
+first.item[0] = "Changed"
+assert(first.item[0] == "Changed")
+assert(order(3).item[0] == "Widget")
+assert(order(3).item.length() == 2)
+
+//  Parents refer to the new copy
+var third = order(4)
+assert(third.item[1].parent().@id == "4")
+
+//  Repeated evaluation in a loop
+var count = 0
+for (i = 0; i < 50; i++) {
+    var x = <entry><name>n</name></entry>
+    x.name = "n" + i
+    if (x.name == ("n" + i)) {
+        count++
+    }
+}
+assert(count == 50)
@@ -261,10 +261,10 @@ module ejs.db.mapper {
                 if (col == undefined) {
                     continue
                 }
-                if (col.ejsType == Object.getType(this[field])) {
+                let value = this[field]
+                if (value == null || col.ejsType == Object.getType(value)) {
                     continue
                 }
-                let value: String = this[field]
                 switch (col.ejsType) {
                 case Boolean:
                     if (value is String) {
@@ -663,6 +663,7 @@ module ejs.db.mapper {
             let conditions: String
             let where: Boolean
             let results: Array?
+            let params: Array = []
 
             if (!_columns) _model.getSchema()
             if (_caching && (results = fetchCachedResponse())) {
@@ -763,8 +764,8 @@ module ejs.db.mapper {
 
                 } else if (options.conditions is Object) {
                     for (field in options.conditions) {
-                        //  Remove quote from options.conditions[field]
-                        whereConditions += field + " = '" + options.conditions[field] + "' " + " AND "
+                        whereConditions += field + " = ? " + " AND "
+                        params.append(options.conditions[field])
                     }
                 }
                 whereConditions = whereConditions.trim(" AND ")
@@ -787,7 +788,11 @@ module ejs.db.mapper {
                 } else {
                     conditions += " AND "
                 }
-                conditions += (_tableName + "." + _keyName + " = ") + ((key) ? key : options.key)
+                /*
+                    Bind the key as a parameter so the statement text is the same for all keys and can be reused
+                 */
+                conditions += _tableName + "." + _keyName + " = ?"
+                params.append((key) ? key : options.key)
             }
 
             //  Removed quote from "from"
@@ -811,21 +816,22 @@ module ejs.db.mapper {
             if (_db == null) {
                 throw new Error("Database connection has not yet been established")
             }
-            if (_caching && (results = fetchCachedResponse(cmd))) {
+            let cacheKey = (params.length > 0) ? (cmd + serialize(params)) : cmd
+            if (_caching && (results = fetchCachedResponse(cacheKey))) {
                 return results
             }
             if (results == null) {
                 try {
                     if (_trace) {
                         let start = new Date
-                        results = _db.query(cmd, "find", _trace)
+                        results = _db.query(cmd, "find", _trace, params)
                         App.log.activity("TIME", "Query Time:", start.elapsed)
                         App.log.info("Query Time:", start.elapsed)
                     } else {
-                        results = _db.query(cmd, "find", _trace)
+                        results = _db.query(cmd, "find", _trace, params)
                     }
                     if (_caching) {
-                        saveQuery(results, cmd)
+                        saveQuery(results, cacheKey)
                     }
                 } 
                 catch (e) {
@@ -153,6 +153,9 @@ module ejs.db.sqlite {
             }
         }
 
+        /** @duplicate ejs.db::Database.cursor */
+        native function cursor(cmd: String, params: Object? = null): SqliteCursor
+
         /** @duplicate ejs.db::Database.dataTypeToSqlType */
         function dataTypeToSqlType(dataType:String): String
             Object.getType(this).DataTypeToSqlType[dataType]
@@ -273,7 +276,7 @@ module ejs.db.sqlite {
         //  TODO - why have query and sql
 
         /** @duplicate ejs.db::Database.query */
-        function query(cmd: String, tag: String = "SQL", trace: Boolean~ = false): Array {
+        function query(cmd: String, tag: String = "SQL", trace: Boolean~ = false, params: Object? = null): Array {
             //  TODO - need to access Database.traceAll
             let mark, size
             //  TODO - rationalize Sqlite.query with Database.query and Record.innerFind
@@ -282,7 +285,7 @@ module ejs.db.sqlite {
                 mark = new Date
                 size = Memory.resident
             }
-            let result = sql(cmd)
+            let result = sql(cmd, params)
             if (trace) {
                 App.log.activity("Stats", "Sqlite query %.2f msec, memory %.2f MB, resident %.2f".format(mark.elapsed, 
                     (Memory.resident - size) / (1024 * 1024), Memory.resident / (1024 * 1024)))
@@ -291,7 +294,7 @@ module ejs.db.sqlite {
         }
 
         /** @duplicate ejs.db::Database.sql */
-        native function sql(cmd: String): Array
+        native function sql(cmd: String, params: Object? = null): Array
 
         /** @duplicate ejs.db::Database.sqlTypeToDataType */
         function sqlTypeToDataType(sqlType: String): String
@@ -305,6 +308,29 @@ module ejs.db.sqlite {
             @hide */
         function startTransaction(): Void {}
     }
+
+    /**
+        Cursor over the rows of a query result. Rows are read from the database on demand as the cursor is iterated
+        using "for each". Cursors are created by Sqlite.cursor() and can be iterated once.
+        @spec ejs
+        @stability prototype
+     */
+    final class SqliteCursor {
+
+        use default namespace public
+
+        /**
+            Close the cursor and release the underlying statement. Cursors are closed automatically once all rows
+            have been read. Use close when finishing an iteration early.
+         */
+        native function close(): Void
+
+        /**
+            Get an iterator over the result rows for use with "for each"
+            @return An Iterator
+         */
+        iterator native function getValues(): Iterator
+    }
 }
 
 
@@ -22,6 +22,9 @@
 #ifndef ME_MAX_SQLITE_DURATION
     #define ME_MAX_SQLITE_DURATION 30000           /**< Database busy timeout */
 #endif
+#ifndef ME_MAX_SQLITE_STMTS
+    #define ME_MAX_SQLITE_STMTS    32              /**< Prepared statements cached per connection */
+#endif
 
 /*********************************** Locals ***********************************/
 /*
@@ -33,6 +36,27 @@
 #define THREAD_STYLE SQLITE_CONFIG_MULTITHREAD
 //#define THREAD_STYLE SQLITE_CONFIG_SERIALIZED
 
+/*
+    Result column property names. Computed once per statement.
+ */
+typedef struct SqliteColumns {
+    int                 count;      /* Number of columns */
+    int                 numProp;    /* Number of row properties. Excludes duplicate columns */
+    EjsName             names[ARRAY_FLEX]; /* Column names. A null name means the column is a duplicate and is skipped */
+} SqliteColumns;
+
+/*
+    Cached prepared statement. Statements are kept on a LRU list with the most recently used first.
+ */
+typedef struct SqliteStmt {
+    sqlite3_stmt        *stmt;      /* Prepared statement */
+    char                *sql;       /* SQL text. Also the cache key */
+    SqliteColumns       *cols;      /* Result column names. Reused each time the statement is run */
+    struct SqliteStmt   *prev;      /* Previous (more recently used) statement */
+    struct SqliteStmt   *next;      /* Next (less recently used) statement */
+    int                 busy;       /* Statement is in use by a query or cursor */
+} SqliteStmt;
+
 /*
     Ejscript Sqlite class object
  */
@@ -40,11 +64,29 @@ typedef struct EjsSqlite {
     EjsPot          pot;            /* Extends Object */
     sqlite3         *sdb;           /* Sqlite handle */
     Ejs             *ejs;           /* Interp reference */
+    MprHash         *stmts;         /* Prepared statement cache indexed by SQL text */
+    SqliteStmt      *mru;           /* Most recently used cached statement */
+    SqliteStmt      *lru;           /* Least recently used cached statement */
     int             memory;         /* In-memory database */
 } EjsSqlite;
 
+/*
+    Ejscript SqliteCursor class object. Iterates over a result set one row at a time.
+ */
+typedef struct EjsSqliteCursor {
+    EjsPot          pot;            /* Extends Object */
+    EjsSqlite       *db;            /* Owning database */
+    sqlite3_stmt    *stmt;          /* Statement being stepped. Null when complete */
+    SqliteStmt      *sp;            /* Cache entry if the statement is cached */
+    SqliteColumns   *cols;          /* Result column names */
+    EjsPot          *layout;        /* First row read. Later rows share its names */
+} EjsSqliteCursor;
+
 static int sqliteInitialized;
 
+static EjsObj *cursorClose(Ejs *ejs, EjsSqliteCursor *cp, int argc, EjsObj **argv);
+static void finalizeStmts(EjsSqlite *db);
+static SqliteColumns *getColumns(Ejs *ejs, sqlite3_stmt *stmt);
 static void initSqlite();
 
 /************************************ Code ************************************/
@@ -120,6 +162,7 @@ static int sqliteClose(Ejs *ejs, EjsSqlite *db, int argc, EjsObj **argv)
     assert(db);
 
     if (db->sdb && !db->memory) {
+        finalizeStmts(db);
         sqlite3_close(db->sdb);
         db->sdb = 0;
     }
@@ -127,27 +170,405 @@ static int sqliteClose(Ejs *ejs, EjsSqlite *db, int argc, EjsObj **argv)
 }
 
 
+static void manageStmt(SqliteStmt *sp, int flags)
+{
+    if (flags & MPR_MANAGE_MARK) {
+        mprMark(sp->sql);
+        mprMark(sp->cols);
+        mprMark(sp->prev);
+        mprMark(sp->next);
+    }
+}
+
+
+static void unlinkStmt(EjsSqlite *db, SqliteStmt *sp)
+{
+    if (sp->prev) {
+        sp->prev->next = sp->next;
+    } else {
+        db->mru = sp->next;
+    }
+    if (sp->next) {
+        sp->next->prev = sp->prev;
+    } else {
+        db->lru = sp->prev;
+    }
+    sp->prev = sp->next = 0;
+}
+
+
+static void linkStmt(EjsSqlite *db, SqliteStmt *sp)
+{
+    sp->prev = 0;
+    sp->next = db->mru;
+    if (db->mru) {
+        db->mru->prev = sp;
+    }
+    db->mru = sp;
+    if (db->lru == 0) {
+        db->lru = sp;
+    }
+}
+
+
+/*
+    Finalize all statements including cached statements and those held by open cursors.
+    Must be done before closing the database.
+ */
+static void finalizeStmts(EjsSqlite *db)
+{
+    SqliteStmt      *sp;
+    sqlite3_stmt    *stmt;
+
+    for (sp = db->mru; sp; sp = sp->next) {
+        sp->stmt = 0;
+    }
+    while ((stmt = sqlite3_next_stmt(db->sdb, 0)) != 0) {
+        sqlite3_finalize(stmt);
+    }
+    db->mru = db->lru = 0;
+    db->stmts = 0;
+}
+
+
+/*
+    Get a prepared statement for the next SQL command in "cmd". A command consisting of a single statement is cached
+    and reused on subsequent calls with the same SQL text. The result column names of a cached statement are computed
+    here and kept with the statement. Set *spp to the cache entry if the statement is owned by the cache. Statements 
+    must be released via releaseStmt().
+ */
+static int prepareStmt(EjsSqlite *db, cchar *cmd, sqlite3_stmt **stmtp, cchar **tail, SqliteStmt **spp)
+{
+    SqliteStmt      *sp;
+    sqlite3_stmt    *stmt;
+    cchar           *cp;
+    int             rc;
+
+    *spp = 0;
+    if (db->stmts && (sp = mprLookupKey(db->stmts, cmd)) != 0 && !sp->busy) {
+        if (sp != db->mru) {
+            unlinkStmt(db, sp);
+            linkStmt(db, sp);
+        }
+        sp->busy = 1;
+        *stmtp = sp->stmt;
+        *tail = &cmd[slen(cmd)];
+        *spp = sp;
+        return SQLITE_OK;
+    }
+    stmt = 0;
+    if ((rc = sqlite3_prepare_v2(db->sdb, cmd, -1, &stmt, tail)) != SQLITE_OK || stmt == 0) {
+        *stmtp = 0;
+        return rc;
+    }
+    *stmtp = stmt;
+    for (cp = *tail; isspace((uchar) *cp); cp++) { }
+    if (*cp == '\0' && ME_MAX_SQLITE_STMTS > 0 && (db->stmts == 0 || !mprLookupKey(db->stmts, cmd))) {
+        if (db->stmts == 0) {
+            db->stmts = mprCreateHash(ME_MAX_SQLITE_STMTS, 0);
+        }
+        if (mprGetHashLength(db->stmts) >= ME_MAX_SQLITE_STMTS && (sp = db->lru) != 0) {
+            /* A busy statement is finalized by releaseStmt when its user is done */
+            unlinkStmt(db, sp);
+            mprRemoveKey(db->stmts, sp->sql);
+            if (!sp->busy) {
+                sqlite3_finalize(sp->stmt);
+            }
+            sp->stmt = 0;
+        }
+        if ((sp = mprAllocObj(SqliteStmt, manageStmt)) != 0) {
+            sp->stmt = stmt;
+            sp->sql = sclone(cmd);
+            sp->cols = getColumns(db->ejs, stmt);
+            sp->busy = 1;
+            linkStmt(db, sp);
+            mprAddKey(db->stmts, sp->sql, sp);
+            *spp = sp;
+        }
+    }
+    return SQLITE_OK;
+}
+
+
+/*
+    Release a statement after use. Cached statements are reset for reuse, others are finalized.
+ */
+static int releaseStmt(sqlite3_stmt *stmt, SqliteStmt *sp)
+{
+    int     rc;
+
+    if (sp) {
+        sp->busy = 0;
+        if (sp->stmt == stmt) {
+            rc = sqlite3_reset(stmt);
+            sqlite3_clear_bindings(stmt);
+            return rc;
+        }
+    }
+    return sqlite3_finalize(stmt);
+}
+
+
+static int bindValue(Ejs *ejs, sqlite3_stmt *stmt, int index, EjsObj *value)
+{
+    EjsByteArray    *ba;
+    MprNumber       n;
+    cchar           *str;
+
+    if (!ejsIsDefined(ejs, value)) {
+        return sqlite3_bind_null(stmt, index);
+
+    } else if (ejsIs(ejs, value, Number)) {
+        n = ejsGetNumber(ejs, value);
+        if (n == (int64) n) {
+            return sqlite3_bind_int64(stmt, index, (int64) n);
+        }
+        return sqlite3_bind_double(stmt, index, n);
+
+    } else if (ejsIs(ejs, value, Boolean)) {
+        return sqlite3_bind_int(stmt, index, ejsGetBoolean(ejs, value));
+
+    } else if (ejsIs(ejs, value, Date)) {
+        return sqlite3_bind_int64(stmt, index, ((EjsDate*) value)->value);
+
+    } else if (ejsIs(ejs, value, ByteArray)) {
+        ba = (EjsByteArray*) value;
+        return sqlite3_bind_blob(stmt, index, &ba->value[ba->readPosition], (int) ejsGetByteArrayAvailableData(ba),
+            SQLITE_TRANSIENT);
+    }
+    str = ejsToMulti(ejs, value);
+    return sqlite3_bind_text(stmt, index, str, (int) slen(str), SQLITE_TRANSIENT);
+}
+
+
+/*
+    Bind parameters to a statement. An Array binds positional parameters in order. An Object binds named parameters
+    (:name, @name or $name) to the properties of the same name.
+ */
+static int bindParams(Ejs *ejs, EjsSqlite *db, sqlite3_stmt *stmt, EjsObj *params)
+{
+    EjsArray    *ap;
+    EjsObj      *value;
+    cchar       *name;
+    int         count, i, rc;
+
+    count = sqlite3_bind_parameter_count(stmt);
+    if (ejsIs(ejs, params, Array)) {
+        ap = (EjsArray*) params;
+        if (ap->length != count) {
+            ejsThrowArgError(ejs, "SQL statement expects %d parameters, but %d were supplied", count, ap->length);
+            return MPR_ERR_BAD_ARGS;
+        }
+    }
+    for (i = 1; i <= count; i++) {
+        if (ejsIs(ejs, params, Array)) {
+            value = ((EjsArray*) params)->data[i - 1];
+        } else {
+            if ((name = sqlite3_bind_parameter_name(stmt, i)) == 0 || *name == '?') {
+                ejsThrowArgError(ejs, "Positional SQL parameters must be bound using an Array");
+                return MPR_ERR_BAD_ARGS;
+            }
+            value = ejsGetPropertyByName(ejs, params, EN(&name[1]));
+        }
+        if ((rc = bindValue(ejs, stmt, i, value)) != SQLITE_OK) {
+            ejsThrowIOError(ejs, "Cannot bind SQL parameter %d: %s", i, sqlite3_errmsg(db->sdb));
+            return MPR_ERR_BAD_ARGS;
+        }
+    }
+    return 0;
+}
+
+
+static void manageColumns(SqliteColumns *cols, int flags)
+{
+    int     i;
+
+    if (flags & MPR_MANAGE_MARK) {
+        for (i = 0; i < cols->count; i++) {
+            mprMark(cols->names[i].name);
+            mprMark(cols->names[i].space);
+        }
+    }
+}
+
+
+/*
+    Compute the property names for the columns of a statement. This is done once per statement rather than per row.
+    Columns from foreign tables are prefixed with the table name and converted to camel case. Duplicate column names 
+    are given a null name so only the first is used.
+ */
+static SqliteColumns *getColumns(Ejs *ejs, sqlite3_stmt *stmt)
+{
+    SqliteColumns   *cols;
+    EjsName         qname;
+    char            *tableName;
+    cchar           *colName, *defaultTableName;
+    int             i, j, ncol, len;
+
+    ncol = sqlite3_column_count(stmt);
+    if ((cols = mprAllocBlock(sizeof(SqliteColumns) + ncol * sizeof(EjsName), MPR_ALLOC_MANAGER | MPR_ALLOC_ZERO)) == 0) {
+        return 0;
+    }
+    mprSetManager(cols, (MprManager) manageColumns);
+    defaultTableName = 0;
+    for (i = 0; i < ncol; i++) {
+        tableName = (char*) sqlite3_column_table_name(stmt, i);
+        if (defaultTableName == 0) {
+            defaultTableName = tableName;
+        }
+        colName = sqlite3_column_name(stmt, i);
+        if (tableName == 0 || strcmp(tableName, defaultTableName) == 0) {
+            qname = EN(colName);
+        } else {
+            /*
+                Append the table name for columns from foreign tables. Convert to camel case (tableColumn)
+                Prefix with "_". ie. "_TableColumn"
+             */
+            len = (int) strlen(tableName) + 1;
+            tableName = sjoin("_", tableName, colName, NULL);
+            if (len > 3 && tableName[len - 1] == 's' && tableName[len - 2] == 'e' && tableName[len - 3] == 'i') {
+                tableName[len - 3] = 'y';
+                strcpy(&tableName[len - 2], colName);
+                len -= 2;
+            } else if (len > 2 && tableName[len - 1] == 's' && tableName[len - 2] == 'e') {
+                strcpy(&tableName[len - 2], colName);
+                len -= 2;
+            } else if (tableName[len - 1] == 's') {
+                strcpy(&tableName[len - 1], colName);
+                len--;
+            }
+            tableName[len] = toupper((uchar) tableName[len]);
+            qname = EN(tableName);
+        }
+        for (j = 0; j < i; j++) {
+            if (cols->names[j].name && ejsCompareString(ejs, cols->names[j].name, qname.name) == 0) {
+                qname.name = 0;
+                break;
+            }
+        }
+        cols->names[i] = qname;
+        cols->count = i + 1;
+        if (qname.name) {
+            cols->numProp++;
+        }
+    }
+    return cols;
+}
+
+
+/*
+    Get the result column names for a statement. Cached statements reuse the names computed when prepared. SQLite
+    recompiles a statement if the schema changes, so the names are recomputed if the number of columns has changed.
+ */
+static SqliteColumns *getStmtColumns(Ejs *ejs, sqlite3_stmt *stmt, SqliteStmt *sp)
+{
+    if (sp == 0 || sp->stmt != stmt) {
+        return getColumns(ejs, stmt);
+    }
+    if (sp->cols == 0 || sp->cols->count != sqlite3_column_count(stmt)) {
+        sp->cols = getColumns(ejs, stmt);
+    }
+    return sp->cols;
+}
+
+
+/*
+    Create an object for the current result row. Column values retain their SQLite storage types: integers and reals
+    become Numbers, blobs become ByteArrays, text becomes Strings and SQL NULL becomes null. Rows after the first take
+    their names and name hash from the first row (layout) of the statement.
+ */
+static EjsObj *readRow(Ejs *ejs, sqlite3_stmt *stmt, SqliteColumns *cols, EjsPot *layout)
+{
+    EjsObj          *row, *value;
+    EjsByteArray    *ba;
+    cchar           *data;
+    int             i, len, slotNum;
+
+    /*
+        Create the row with all its properties and then set the names and values by slot to avoid property lookups
+     */
+    if ((row = ejsCreatePot(ejs, ESV(Object), cols->numProp)) == 0) {
+        return 0;
+    }
+    if (layout && ejsSetPotLayout(ejs, (EjsPot*) row, layout) < 0) {
+        ejsThrowMemoryError(ejs);
+        return 0;
+    }
+    for (i = slotNum = 0; i < cols->count; i++) {
+        if (cols->names[i].name == 0) {
+            continue;
+        }
+        switch (sqlite3_column_type(stmt, i)) {
+        case SQLITE_INTEGER:
+            value = (EjsObj*) ejsCreateNumber(ejs, (MprNumber) sqlite3_column_int64(stmt, i));
+            break;
+
+        case SQLITE_FLOAT:
+            value = (EjsObj*) ejsCreateNumber(ejs, sqlite3_column_double(stmt, i));
+            break;
+
+        case SQLITE_BLOB:
+            data = sqlite3_column_blob(stmt, i);
+            len = sqlite3_column_bytes(stmt, i);
+            if ((ba = ejsCreateByteArray(ejs, len)) != 0 && len > 0) {
+                ejsCopyToByteArray(ejs, ba, 0, data, len);
+                ejsSetByteArrayPositions(ejs, ba, 0, len);
+            }
+            value = (EjsObj*) ba;
+            break;
+
+        case SQLITE_NULL:
+            value = ESV(null);
+            break;
+
+        default:
+            data = (cchar*) sqlite3_column_text(stmt, i);
+            value = (EjsObj*) ejsCreateStringFromMulti(ejs, data, sqlite3_column_bytes(stmt, i));
+            break;
+        }
+        if (value == 0 || (!layout && ejsSetPropertyName(ejs, row, slotNum, cols->names[i]) < 0) ||
+                ejsSetProperty(ejs, row, slotNum, value) < 0) {
+            ejsThrowIOError(ejs, "Cannot update query result set name");
+            return 0;
+        }
+        slotNum++;
+    }
+    return row;
+}
+
+
+static void throwSqlError(Ejs *ejs, sqlite3 *sdb, int rc)
+{
+    if (rc == sqlite3_errcode(sdb)) {
+        ejsThrowIOError(ejs, "SQL error: %s", sqlite3_errmsg(sdb));
+    } else {
+        ejsThrowIOError(ejs, "Unspecified SQL error");
+    }
+}
+
+
 /*
-    function sql(cmd: String): Array
+    function sql(cmd: String, params: Object? = null): Array
 
-    Will support multiple sql cmds but will only return one result table.
+    Will support multiple sql cmds but will only return one result table. Parameters are bound to each command.
  */
 static EjsObj *sqliteSql(Ejs *ejs, EjsSqlite *db, int argc, EjsObj **argv)
 {
     sqlite3         *sdb;
     sqlite3_stmt    *stmt;
+    SqliteStmt      *sp;
+    SqliteColumns   *cols;
     EjsArray        *result;
-    EjsObj          *row;
-    EjsObj          *svalue;
-    EjsName         qname;
-    char            *tableName;
-    cchar           *tail, *colName, *cmd, *value, *defaultTableName;
-    int             i, ncol, rc, retries, rowNum, len;
+    EjsObj          *row, *params;
+    EjsPot          *layout;
+    cchar           *tail, *cmd;
+    int             rc, retries, rowNum;
 
     assert(ejs);
     assert(db);
 
     cmd = ejsToMulti(ejs, argv[0]);
+    params = (argc >= 2 && ejsIsDefined(ejs, argv[1])) ? argv[1] : 0;
     retries = 0;
     sdb = db->sdb;
     if (sdb == 0) {
@@ -160,8 +581,7 @@ static EjsObj *sqliteSql(Ejs *ejs, EjsSqlite *db, int argc, EjsObj **argv)
     }
     rc = SQLITE_OK;
     while (cmd && *cmd && (rc == SQLITE_OK || (rc == SQLITE_SCHEMA && ++retries < 2))) {
-        stmt = 0;
-        rc = sqlite3_prepare_v2(sdb, cmd, -1, &stmt, &tail);
+        rc = prepareStmt(db, cmd, &stmt, &tail, &sp);
         if (rc != SQLITE_OK) {
             continue;
         }
@@ -170,83 +590,146 @@ static EjsObj *sqliteSql(Ejs *ejs, EjsSqlite *db, int argc, EjsObj **argv)
             cmd = tail;
             continue;
         }
-        defaultTableName = 0;
-        ncol = sqlite3_column_count(stmt);
-        for (rowNum = 0; ; rowNum++) {
-            if (sqlite3_step(stmt) == SQLITE_ROW) {
-                row = ejsCreateEmptyPot(ejs);
-                if (row == 0) {
-                    sqlite3_finalize(stmt);
-                    return 0;
-                }
-                if (ejsSetProperty(ejs, (EjsObj*) result, rowNum, (EjsObj*) row) < 0) {
-                    ejsThrowIOError(ejs, "Cannot update query result set");
-                    return 0;
-                }
-                for (i = 0; i < ncol; i++) {
-                    tableName = (char*) sqlite3_column_table_name(stmt, i);
-                    if (defaultTableName == 0) {
-                        defaultTableName = tableName;
-                    }
-                    colName = sqlite3_column_name(stmt, i);
-                    value = (cchar*) sqlite3_column_text(stmt, i);
-
-                    if (tableName == 0 || strcmp(tableName, defaultTableName) == 0) {
-                        qname = EN(colName);
-                    } else {
-                        /*
-                            Append the table name for columns from foreign tables. Convert to camel case (tableColumn)
-                            Prefix with "_". ie. "_TableColumn"
-                         */
-                        len = (int) strlen(tableName) + 1;
-                        tableName = sjoin("_", tableName, colName, NULL);
-                        if (len > 3 && tableName[len - 1] == 's' && tableName[len - 2] == 'e' && tableName[len - 3] == 'i') {
-                            tableName[len - 3] = 'y';
-                            strcpy(&tableName[len - 2], colName);
-                            len -= 2;
-                        } else if (len > 2 && tableName[len - 1] == 's' && tableName[len - 2] == 'e') {
-                            strcpy(&tableName[len - 2], colName);
-                            len -= 2;
-                        } else if (tableName[len - 1] == 's') {
-                            strcpy(&tableName[len - 1], colName);
-                            len--;
-                        }
-                        tableName[len] = toupper((uchar) tableName[len]);
-                        qname = EN(tableName);
-                    }
-                    if (ejsLookupProperty(ejs, (EjsObj*) row, qname) < 0) {
-                        svalue = (EjsObj*) ejsCreateStringFromMulti(ejs, value, slen(value));
-                        if (ejsSetPropertyByName(ejs, (EjsObj*) row, qname, svalue) < 0) {
-                            ejsThrowIOError(ejs, "Cannot update query result set name");
-                            return 0;
-                        }
-                    }
-                }
-            } else {
-                rc = sqlite3_finalize(stmt);
-                stmt = 0;
-                if (rc != SQLITE_SCHEMA) {
-                    retries = 0;
-                    for (cmd = tail; isspace((uchar) *cmd); cmd++) {
-                        ;
-                    }
-                }
-                break;
+        if ((params && bindParams(ejs, db, stmt, params) < 0) || (cols = getStmtColumns(ejs, stmt, sp)) == 0) {
+            releaseStmt(stmt, sp);
+            return 0;
+        }
+        layout = 0;
+        for (rowNum = 0; sqlite3_step(stmt) == SQLITE_ROW; rowNum++) {
+            if ((row = readRow(ejs, stmt, cols, layout)) == 0) {
+                releaseStmt(stmt, sp);
+                return 0;
+            }
+            if (ejsSetProperty(ejs, (EjsObj*) result, rowNum, row) < 0) {
+                releaseStmt(stmt, sp);
+                ejsThrowIOError(ejs, "Cannot update query result set");
+                return 0;
+            }
+            layout = (EjsPot*) row;
+        }
+        rc = releaseStmt(stmt, sp);
+        if (rc != SQLITE_SCHEMA) {
+            retries = 0;
+            for (cmd = tail; isspace((uchar) *cmd); cmd++) {
+                ;
             }
         }
     }
+    if (rc != SQLITE_OK) {
+        throwSqlError(ejs, sdb, rc);
+        return 0;
+    }
+    return (EjsObj*) result;
+}
+
+
+/*
+    function cursor(cmd: String, params: Object? = null): SqliteCursor
+
+    Only the first command is used. Rows are read when the cursor is iterated.
+ */
+static EjsObj *sqliteCursor(Ejs *ejs, EjsSqlite *db, int argc, EjsObj **argv)
+{
+    EjsSqliteCursor *cp;
+    EjsType         *type;
+    sqlite3_stmt    *stmt;
+    SqliteStmt      *sp;
+    EjsObj          *params;
+    cchar           *tail, *cmd;
+    int             rc;
+
+    if (db->sdb == 0) {
+        ejsThrowIOError(ejs, "Database is closed");
+        return 0;
+    }
+    cmd = ejsToMulti(ejs, argv[0]);
+    params = (argc >= 2 && ejsIsDefined(ejs, argv[1])) ? argv[1] : 0;
+
+    type = ejsGetTypeByName(ejs, N("ejs.db.sqlite", "SqliteCursor"));
+    if (type == 0 || (cp = ejsCreateObj(ejs, type, 0)) == 0) {
+        return 0;
+    }
+    if ((rc = prepareStmt(db, cmd, &stmt, &tail, &sp)) != SQLITE_OK) {
+        throwSqlError(ejs, db->sdb, rc);
+        return 0;
+    }
+    cp->db = db;
     if (stmt) {
-        rc = sqlite3_finalize(stmt);
+        cp->stmt = stmt;
+        cp->sp = sp;
+        if ((params && bindParams(ejs, db, stmt, params) < 0) || (cp->cols = getStmtColumns(ejs, stmt, sp)) == 0) {
+            cursorClose(ejs, cp, 0, 0);
+            return 0;
+        }
     }
-    if (rc != SQLITE_OK) {
-        if (rc == sqlite3_errcode(sdb)) {
-            ejsThrowIOError(ejs, "SQL error: %s", sqlite3_errmsg(sdb));
-        } else {
-            ejsThrowIOError(ejs, "Unspecified SQL error");
+    return (EjsObj*) cp;
+}
+
+
+/*
+    function close(): Void
+ */
+static EjsObj *cursorClose(Ejs *ejs, EjsSqliteCursor *cp, int argc, EjsObj **argv)
+{
+    if (cp->stmt) {
+        /* If the database has been closed, the statement has already been finalized */
+        if (cp->db->sdb) {
+            releaseStmt(cp->stmt, cp->sp);
         }
+        cp->stmt = 0;
+        cp->sp = 0;
+    }
+    return 0;
+}
+
+
+/*
+    Step the cursor statement and return the next row
+ */
+static EjsObj *nextCursorRow(Ejs *ejs, EjsIterator *ip, int argc, EjsObj **argv)
+{
+    EjsSqliteCursor *cp;
+    EjsObj          *row;
+    int             rc;
+
+    cp = (EjsSqliteCursor*) ip->target;
+    if (cp->stmt && cp->db->sdb == 0) {
+        cp->stmt = 0;
+        ejsThrowIOError(ejs, "Database is closed");
         return 0;
     }
-    return (EjsObj*) result;
+    if (cp->stmt == 0) {
+        ejsThrowStopIteration(ejs);
+        return 0;
+    }
+    if ((rc = sqlite3_step(cp->stmt)) == SQLITE_ROW) {
+        if ((row = readRow(ejs, cp->stmt, cp->cols, cp->layout)) == 0) {
+            cursorClose(ejs, cp, 0, 0);
+        } else if (cp->layout == 0) {
+            cp->layout = (EjsPot*) row;
+        }
+        ip->index++;
+        return row;
+    }
+    rc = releaseStmt(cp->stmt, cp->sp);
+    cp->stmt = 0;
+    cp->sp = 0;
+    if (rc != SQLITE_OK) {
+        throwSqlError(ejs, cp->db->sdb, rc);
+        return 0;
+    }
+    ejsThrowStopIteration(ejs);
+    return 0;
+}
+
+
+/*
+    Return an iterator over the result rows. Rows can only be read once.
+    iterator native function getValues(): Iterator
+ */
+static EjsObj *cursorGetValues(Ejs *ejs, EjsSqliteCursor *cp, int argc, EjsObj **argv)
+{
+    return (EjsObj*) ejsCreateIterator(ejs, cp, -1, nextCursorRow, 0, NULL);
 }
 
 
@@ -377,6 +860,9 @@ static int manageSqlite(EjsSqlite *db, int flags)
 {
     if (flags & MPR_MANAGE_MARK) {
         ejsManagePot(db, flags);
+        mprMark(db->stmts);
+        mprMark(db->mru);
+        mprMark(db->lru);
 
     } else if (flags & MPR_MANAGE_FREE) {
         if (db->sdb) {
@@ -387,6 +873,24 @@ static int manageSqlite(EjsSqlite *db, int flags)
 }
 
 
+static int manageCursor(EjsSqliteCursor *cp, int flags)
+{
+    if (flags & MPR_MANAGE_MARK) {
+        ejsManagePot(cp, flags);
+        mprMark(cp->db);
+        mprMark(cp->sp);
+        mprMark(cp->cols);
+        mprMark(cp->layout);
+
+    } else if (flags & MPR_MANAGE_FREE) {
+        if (cp->stmt) {
+            cursorClose(cp->db->ejs, cp, 0, 0);
+        }
+    }
+    return 0;
+}
+
+
 static void initSqlite()
 {
     ejsLockService();
@@ -420,7 +924,16 @@ static int configureSqliteTypes(Ejs *ejs)
     prototype = type->prototype;
     ejsBindConstructor(ejs, type, sqliteConstructor);
     ejsBindMethod(ejs, prototype, ES_ejs_db_sqlite_Sqlite_close, sqliteClose);
+    ejsBindMethod(ejs, prototype, ES_ejs_db_sqlite_Sqlite_cursor, sqliteCursor);
     ejsBindMethod(ejs, prototype, ES_ejs_db_sqlite_Sqlite_sql, sqliteSql);
+
+    if ((type = ejsFinalizeScriptType(ejs, N("ejs.db.sqlite", "SqliteCursor"), sizeof(EjsSqliteCursor), manageCursor,
+            EJS_TYPE_POT)) == 0) {
+        return 0;
+    }
+    prototype = type->prototype;
+    ejsBindMethod(ejs, prototype, ES_ejs_db_sqlite_SqliteCursor_close, cursorClose);
+    ejsBindMethod(ejs, prototype, ES_ejs_db_sqlite_SqliteCursor_iterator_getValues, cursorGetValues);
     return 0;
 }
 
@@ -137,6 +137,21 @@ module ejs.db {
         function createTable(table: String, columns: Array? = null): Void
             adapter.createTable(table, columns)
 
+        /**
+            Execute a SQL command and return a cursor over the result rows. Rows are read from the database as the
+            cursor is iterated rather than being read into an array. Use with "for each".
+            @param cmd SQL command to issue. Only the first statement of the command is used.
+            @param params Parameters to bind to the command. See @sql for details.
+            @returns A cursor object that returns each result row as an Object hash containing the column names and 
+                values when iterated
+            @example
+                for each (row in db.cursor("SELECT * FROM Trades WHERE quantity > ?", [1000])) {
+                    print(row.price)
+                }
+         */
+        function cursor(cmd: String, params: Object? = null): Object
+            adapter.cursor(cmd, params)
+
         /**
             Map the database independant data type to a database dependant SQL data type
             @param dataType Data type to map
@@ -214,11 +229,12 @@ module ejs.db {
             @param cmd SQL command string
             @param tag Debug tag to use when logging the command
             @param trace Set to true to eanble logging this command.
+            @param params Parameters to bind to the command. See @sql for details.
             @returns An array of row results where each row is represented by an Object hash containing the 
                 column names and values
             @TODO Refactor logging when Log class implemented
          */
-        function query(cmd: String, tag: String = "SQL", trace: Boolean~ = false): Array {
+        function query(cmd: String, tag: String = "SQL", trace: Boolean~ = false, params: Object? = null): Array {
             let mark, size
             trace ||= options.trace
             if (trace) {
@@ -226,7 +242,7 @@ module ejs.db {
                 mark = new Date
                 size = Memory.resident
             }
-            let result = adapter.sql(cmd)
+            let result = adapter.sql(cmd, params)
             if (trace) {
                 App.log.activity("Stats", "Elapsed %5.2f msec, memory %5.2f".format(mark.elapsed, 
                     (Memory.resident - size) / (1024 * 1024)))
@@ -278,11 +294,15 @@ module ejs.db {
             Execute a SQL command on the database. This is a low level SQL command interface that bypasses logging.
                 Use @query instead.
             @param cmd SQL command to issue. Note: "SELECT" is automatically prepended and ";" is appended for you.
+            @param params Parameters to bind to the command. Use an Array to bind positional "?" parameters in order.
+                Use an Object to bind named ":name" parameters to the properties of the same name. Bound values are
+                not parsed as SQL and do not need to be quoted.
             @returns An array of row results where each row is represented by an Object hash containing the column 
-                names and values
+                names and values. Integer and real column values are returned as Numbers, blobs as ByteArrays, text as
+                Strings and SQL NULL values as null.
          */
-        function sql(cmd: String): Array
-            adapter.sql(cmd)
+        function sql(cmd: String, params: Object? = null): Array
+            adapter.sql(cmd, params)
 
         /**
             Map the SQL type to a database independant data type
@@ -47,6 +47,9 @@ module ejs.db {
         /** @duplicate ejs.db::Database.createTable */
         function createTable(table: String, columns: Array? = null): Void
 
+        /** @duplicate ejs.db::Database.cursor */
+        function cursor(cmd: String, params: Object? = null): Object
+
         /** @duplicate ejs.db::Database.dataTypeToSqlType */
         function dataTypeToSqlType(dataType:String): String
 
@@ -80,7 +83,7 @@ module ejs.db {
         function rollback(): Void
 
         /** @duplicate ejs.db::Database.sql */
-        function sql(cmd: String): Array
+        function sql(cmd: String, params: Object? = null): Array
 
         /** @duplicate ejs.db::Database.sqlTypeToDataType */
         function sqlTypeToDataType(sqlType: String): String
@@ -33,6 +33,34 @@ if (Config.DB && Config.SQLITE) {
     assert(db.getTables() == "History,Portfolio,Stocks,Trades")
     assert(db.getColumns("Trades") == "id,date,stockId,quantity,price")
     db.close()
+
+
+    //  Bound parameters. Repeat to use the cached prepared statement.
+    let db = new Database("sqlite", "test.sdb")
+    for (i in 3) {
+        let rows = db.sql("SELECT * FROM Stocks WHERE id = ?", [2])
+        assert(rows.length == 1 && rows[0].ticker == "RHAT")
+        rows = db.sql("SELECT * FROM Stocks WHERE ticker = :ticker", {ticker: "MSFT"})
+        assert(rows.length == 1 && rows[0].id == 1)
+    }
+    let caught
+    try {
+        db.sql("SELECT * FROM Stocks WHERE id = ?", [1, 2])
+    } catch (e) {
+        caught = true
+    }
+    assert(caught)
+
+    //  Typed values and cursors
+    let row = db.sql("SELECT id, ticker FROM Stocks WHERE id = 1")[0]
+    assert(row.id === 1 && row.ticker === "MSFT")
+    let count = 0
+    for each (row in db.cursor("SELECT * FROM Stocks WHERE id >= ?", [1])) {
+        assert(row.id is Number)
+        count++
+    }
+    assert(count == 2)
+    db.close()
 } else {
     test.skip("DB or SQLite not enabled")
 }
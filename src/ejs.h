@@ -37,6 +37,27 @@ extern "C" {
     #define ME_MAX_EJS_STACK       (1024 * 32)     /**< Stack size without MMU */
 #endif
 #endif
+#ifndef ME_EJS_NUMBER_CACHE_MIN
+    #define ME_EJS_NUMBER_CACHE_MIN -128            /**< Smallest integer in the shared number cache */
+#endif
+#ifndef ME_EJS_NUMBER_CACHE_MAX
+    #define ME_EJS_NUMBER_CACHE_MAX 1023            /**< Largest integer in the shared number cache */
+#endif
+#ifndef ME_EJS_INTERN_SHARDS
+    #define ME_EJS_INTERN_SHARDS    16              /**< Intern string table shards (power of 2) */
+#endif
+#ifndef ME_EJS_OP_TRACE
+    #define ME_EJS_OP_TRACE         0               /**< Trace opcode pair and triple frequencies */
+#endif
+#ifndef ME_EJS_REGEXP_CACHE
+    #define ME_EJS_REGEXP_CACHE     256             /**< Compiled regular expressions cached for reuse */
+#endif
+#ifndef ME_EJS_REGEXP_STUDY
+    #define ME_EJS_REGEXP_STUDY     0               /**< Study patterns after this many matches (needs pcre_study) */
+#endif
+#ifndef ME_EJS_MAP_MODULES
+    #define ME_EJS_MAP_MODULES      ME_UNIX_LIKE    /**< Map module files and share byte code read-only */
+#endif
 
 /*
     Internal constants
@@ -48,7 +69,11 @@ extern "C" {
 
 #define EJS_HASH_MIN_PROP           8               /**< Min props to hash */
 #define EJS_MAX_COLLISIONS          4               /**< Max intern string collion chain before rehash */
+#define EJS_LAZY_INTERN_LEN         256             /**< Joined strings this long are interned only when required */
+#define EJS_INLINE_CACHE_SIZE       4               /**< Max receiver types per inline property cache */
 #define EJS_POOL_INACTIVITY_TIMEOUT (60  * 1000)    /**< Prune inactive pooled VMs older than this */
+#define EJS_POOL_WAIT_TIMEOUT       (30 * 1000)     /**< Max time to wait for a VM when the pool is full */
+#define EJS_POOL_TIMER_PERIOD       (5 * 1000)      /**< Pool maintenance period for pre-warming and pruning */
 #define EJS_SESSION_TIMER_PERIOD    (60 * 1000)     /**< Timer checks ever minute */
 #define EJS_FILE_PERMS              0664            /**< Default file perms */
 #define EJS_DIR_PERMS               0775            /**< Default dir perms */
@@ -103,6 +128,7 @@ struct EjsFunction;
 struct EjsGC;
 struct EjsHelpers;
 struct EjsIntern;
+struct EjsInternStats;
 struct EjsNames;
 struct EjsModule;
 struct EjsNamespace;
@@ -481,6 +507,7 @@ typedef struct Ejs {
     uint                dontExit: 1;        /**< Prevent App.exit() from exiting */
     uint                empty: 1;           /**< Interpreter will be created empty */
     uint                exiting: 1;         /**< VM should exit */
+    uint                frozen: 1;          /**< VM is a pool template and is not run after initialization */
     uint                hasError: 1;        /**< Interpreter has an initialization error */
     uint                initialized: 1;     /**< Interpreter fully initialized and not empty */
 
@@ -500,8 +527,27 @@ typedef struct Ejs {
 
     Http                *http;              /**< Http service object (copy of EjsService.http) */
     MprMutex            *mutex;             /**< Multithread locking */
+
+    struct Ejs          *master;            /**< Frozen VM this VM was cloned from */
+    uchar               *lazyGlobals;       /**< Bitmap of global slots still shared with the master */
+    int                 lazyLimit;          /**< Number of global slots covered by lazyGlobals */
+    int                 lazyCount;          /**< Number of global slots still shared with the master */
+    MprTicks            cloneTime;          /**< Time taken by ejsCloneVM to create this VM */
+    MprTicks            idleTime;           /**< When a pooled VM was returned to its pool */
+    ssize               cloneMemory;        /**< Approximate heap memory allocated by ejsCloneVM */
 } Ejs;
 
+/**
+    Test if a global slot is still shared with the master VM
+    @param ejs Ejs reference returned from #ejsCreateVM
+    @param slotNum Global slot number
+    @ingroup Ejs
+    @internal
+ */
+#define ejsIsLazyGlobal(ejs, slotNum) \
+    ((ejs)->lazyGlobals && (slotNum) < (ejs)->lazyLimit && \
+    ((ejs)->lazyGlobals[(slotNum) >> 3] & (1 << ((slotNum) & 7))))
+
 
 /**
     Add an immutable reference. 
@@ -560,19 +606,56 @@ PUBLIC int ejsBlockGC(Ejs *ejs);
 PUBLIC void ejsUnblockGC(Ejs *ejs, int blocked);
 
 /************************************ EjsPool *********************************/
+/**
+    VM pool statistics
+    @ingroup EjsPool
+    @stability Internal
+ */
+typedef struct EjsPoolStats {
+    int         count;                      /**< Count of allocated VMs (active and idle) */
+    int         active;                     /**< VMs currently allocated to callers */
+    int         idle;                       /**< VMs waiting in the pool */
+    int         waiting;                    /**< Callers currently waiting for a VM */
+    int         min;                        /**< Minimum number of VMs kept by the pool */
+    int         max;                        /**< Maximum number of VMs */
+    int         peakActive;                 /**< Peak number of active VMs */
+    uint64      allocs;                     /**< Number of VMs allocated to callers */
+    uint64      created;                    /**< Number of VMs created */
+    uint64      prewarmed;                  /**< Number of VMs created in advance by the pool timer */
+    uint64      reaped;                     /**< Number of idle VMs pruned */
+    uint64      waits;                      /**< Number of callers that had to wait for a VM */
+    uint64      timeouts;                   /**< Number of callers that timed out waiting for a VM */
+    MprTicks    totalWait;                  /**< Total time callers have waited for a VM */
+    MprTicks    maxWait;                    /**< Longest time a caller has waited for a VM */
+} EjsPoolStats;
+
 /**
     Cached pooled of virtual machines.
+    @description The pool keeps at least "min" VMs and pre-warms additional VMs in the background when callers
+        have had to create VMs on demand or wait for a VM. Idle VMs are pruned after the idle timeout. When the pool
+        has reached its maximum, callers wait for a VM to be freed back to the pool. The limits may be set via
+        #ejsSetPoolLimits or by the "pool" section of the ejsrc file read by the pool template VM. The ejsrc
+        section may define "min", "max", "idle" and "wait" properties. Timeouts are in seconds.
     @defgroup EjsPool EjsPool
-    @see ejsCreatePool ejsAllocPoolVM ejsFreePoolVM 
+    @see ejsCreatePool ejsAllocPoolVM ejsFreePoolVM ejsGetPoolStats ejsSetPoolLimits
     @stability Internal
   */
 typedef struct EjsPool {
-    MprList     *list;                      /**< Free list */
+    MprList     *list;                      /**< Free list. Least recently used first */
     MprTicks    lastActivity;               /**< When a VM was last used */
-    MprEvent    *timer;                     /**< VM prune timer */
+    MprEvent    *timer;                     /**< VM pre-warm and prune timer */
     MprMutex    *mutex;                     /**< Multithread lock */
+    MprCond     *cond;                      /**< Signalled when a VM is freed to the pool */
+    MprTicks    idleTimeout;                /**< Prune idle VMs older than this */
+    MprTicks    waitTimeout;                /**< Maximum time to wait for a VM when the pool is full */
     int         count;                      /**< Count of allocated VMs */
+    int         min;                        /**< Minimum number of VMs to keep */
     int         max;                        /**< Maximum number of VMs */
+    int         waiting;                    /**< Callers waiting for a VM */
+    int         demand;                     /**< VMs created on demand or waited for since the last timer tick */
+    int         flags;                      /**< VM creation flags */
+    int         configured;                 /**< Limits set by ejsSetPoolLimits. Overrides the ejsrc pool limits */
+    EjsPoolStats stats;                     /**< Pool statistics */
     Ejs         *template;                  /**< VM template to clone */
     char        *templateScript;            /**< Template initialization script filename */
     char        *startScript;               /**< Template initialization literal script */
@@ -585,7 +668,7 @@ typedef struct EjsPool {
 /**
     Create a pool for virutal machines
     @description 
-    @param poolMax Maximum number of VMs in the pool
+    @param poolMax Maximum number of VMs in the pool. Use #ejsSetPoolLimits to set other limits.
     @param templateScript Script to execute to initialize a template VM from which all VMs in the pool will be cloned.
         This is executed only once when the pool is created. This is typically used to pre-load modules.
     @param startScript Startup script literal. This script is executed each time the VM is allocated from the pool
@@ -616,6 +699,28 @@ PUBLIC Ejs *ejsAllocPoolVM(EjsPool *pool, int flags);
  */
 PUBLIC void ejsFreePoolVM(EjsPool *pool, Ejs *ejs);
 
+/**
+    Get the pool statistics
+    @param pool EjsPool reference
+    @param stats Statistics structure to fill
+    @ingroup EjsPool
+ */
+PUBLIC void ejsGetPoolStats(EjsPool *pool, EjsPoolStats *stats);
+
+/**
+    Set the pool limits
+    @description Set the pool size limits and timeouts. The pool is pre-warmed with "min" VMs before returning.
+    @param pool EjsPool reference
+    @param minVMs Minimum number of VMs to keep in the pool. These are created immediately.
+    @param maxVMs Maximum number of VMs. Set to zero for no limit.
+    @param idleTimeout Prune idle VMs above the minimum after this many milliseconds. Set to -1 to leave unchanged.
+    @param waitTimeout Maximum time in milliseconds to wait for a VM when the pool is full. Set to zero to fail
+        immediately. Set to -1 to leave unchanged.
+    @return Zero if successful, otherwise a negative MPR error code.
+    @ingroup EjsPool
+ */
+PUBLIC int ejsSetPoolLimits(EjsPool *pool, int minVMs, int maxVMs, MprTicks idleTimeout, MprTicks waitTimeout);
+
 /************************************ EjsObj **********************************/
 /**
     Base object from which all objects inherit.
@@ -1078,8 +1183,9 @@ typedef struct EjsProperties {
         objects will perform a separate allocation for the properties that it can grow.
         \n\n
         EjsPot stores properties in an array of slots. These slots store the property name and a reference to the 
-        property value.  Dynamic objects own their own name hash. Sealed object instances of a type, will refer to the 
-        hash of names owned by the type.
+        property value. Objects created with the same property layout (class instances, clones, query rows and parsed
+        JSON records) share one name hash. The hash is copied on the first modification that would change it. Each
+        object still has its own slots holding the names and values.
     @defgroup EjsPot EjsPot
     @see EjsPot ejsAlloc ejsBlendObject ejsCast ejsCheckSlot ejsClone ejsCloneObject ejsClonePot ejsCoerceOperands 
         ejsCompactPot ejsCopySlots ejsCreateEmptyPot ejsCreateInstance ejsCreateObject ejsCreatePot 
@@ -1087,7 +1193,8 @@ typedef struct EjsProperties {
         ejsDeserialize ejsFixTraits ejsGetHashSize ejsGetPotPropertyName ejsGetProperty ejsGrowObject ejsGrowPot 
         ejsIndexProperties ejsInsertPotProperties ejsIsPot ejsLookupPotProperty ejsLookupProperty ejsManageObject 
         ejsManagePot ejsMatchName ejsObjToJSON ejsObjToString ejsParse ejsPropertyHasTrait ejsRemovePotProperty 
-        ejsSetProperty ejsSetPropertyByName ejsSetPropertyName ejsSetPropertyTraits ejsZeroSlots 
+        ejsSetPotLayout ejsSetProperty ejsSetPropertyByName ejsSetPropertyName ejsSetPropertyTraits ejsSharePotHash
+        ejsZeroSlots
     @stability Internal.
  */
 typedef struct EjsPot {
@@ -1099,6 +1206,7 @@ typedef struct EjsPot {
     uint    isType          : 1;                /**< Instance is a type object */
     uint    separateHash    : 1;                /**< Object has separate hash memory */
     uint    separateSlots   : 1;                /**< Object has separate slots[] memory */
+    uint    sharedHash      : 1;                /**< Hash is shared with like objects. Copied before modification */
     uint    shortScope      : 1;                /**< Don't follow type or base classes */
 
     EjsProperties   *properties;                /** Object properties */
@@ -1179,6 +1287,33 @@ PUBLIC int ejsInsertPotProperties(Ejs *ejs, EjsPot *pot, int numSlots, int offse
  */
 PUBLIC int ejsIndexProperties(Ejs *ejs, EjsPot *obj);
 
+/**
+    Share a property index
+    @description Make an object use the property hash of another object with an identical property layout. The hash 
+        is shared copy-on-write and is copied by either object before it is modified.
+    @param ejs Ejs reference returned from #ejsCreateVM
+    @param dest Object to receive the shared hash. Its slots must have the same names as the source object.
+    @param src Source object owning the hash.
+    @returns True if the hash could be shared. Otherwise the caller should call #ejsIndexProperties.
+    @ingroup EjsPot
+    @internal
+ */
+PUBLIC bool ejsSharePotHash(Ejs *ejs, EjsPot *dest, EjsPot *src);
+
+/**
+    Name properties after a like object
+    @description Set the property names of a new object to those of another object with the same number of
+        properties and share its property hash. This is faster than naming and hashing each property when creating
+        many objects with identical names, such as query result rows and parsed records.
+    @param ejs Ejs reference returned from #ejsCreateVM
+    @param obj New object with unnamed slots. It must have the same number of properties as the layout object.
+    @param layout Object providing the property names.
+    @returns Zero if successful, otherwise a negative MPR error code.
+    @ingroup EjsPot
+    @internal
+ */
+PUBLIC int ejsSetPotLayout(Ejs *ejs, EjsPot *obj, EjsPot *layout);
+
 /**
     Test a property's traits
     @description Make a hash lookup of properties. This will be skipped if there are insufficient properties to make the
@@ -1396,14 +1531,19 @@ PUBLIC bool ejsMatchName(Ejs *ejs, EjsName *a, EjsName *b);
     \n\n
     Strings are currently sequences of Unicode characters. Depending on the configuration, they may be 8, 16 or 32 bit
     code point values.
+    \n\n
+    Strings are normally interned so that equal strings are the same object. Long strings created by joining strings
+    (EJS_LAZY_INTERN_LEN or longer) are not interned until they are used as a property name. Equality tests, 
+    comparisons and hashing use the string value for these strings. Use ejsCompareString or the String operators 
+    rather than comparing references.
     @defgroup EjsString EjsString
     @see EjsString ejsAtoi ejsCompareAsc ejsCompareString ejsCompareSubstring ejsCompareWide ejsContainsAsc 
         ejsContainsChar ejsContainsString ejsCreateBareString ejsCreateString ejsCreateStringFromAsc 
         ejsCreateStringFromBytes ejsCreateStringFromConst ejsCreateStringFromMulti ejsCreateStringWithLength 
-        ejsDestroyIntern ejsInternAsc ejsInternMulti ejsInternString ejsInternWide ejsJoinString 
-        ejsJoinStrings ejsSerialize ejsSerializeWithOptions ejsSprintf ejsStartsWithAsc ejsStrcat ejsStrdup 
-        ejsSubstring ejsToJSON ejsToLiteralString ejsToMulti ejsToString ejsToUpper ejsTruncateString ejsVarToString 
-        ejsToLower 
+        ejsDestroyIntern ejsGetInternStats ejsInternAsc ejsInternMulti ejsInternName ejsInternString ejsInternWide 
+        ejsIsInterned ejsJoinString ejsJoinStrings ejsSerialize ejsSerializeWithOptions ejsSprintf ejsStartsWithAsc 
+        ejsStrcat ejsStrdup ejsSubstring ejsToJSON ejsToLiteralString ejsToMulti ejsToString ejsToUpper 
+        ejsTruncateString ejsVarToString ejsToLower 
     @stability Internal.
  */
 typedef struct EjsString {
@@ -1486,6 +1626,26 @@ PUBLIC EjsString *ejsCreateBareString(Ejs *ejs, ssize len);
  */
 PUBLIC EjsString *ejsInternString(EjsString *sp);
 
+/**
+    Test if a string has been interned
+    @param sp String object to test
+    @return True if the string is in the intern pool
+    @ingroup EjsString
+    @internal
+ */
+#define ejsIsInterned(sp) ((sp)->next != 0)
+
+/**
+    Intern the name portion of a qualified name if required
+    @description Property names are compared by reference and must be interned. Strings created by joining long 
+        strings are interned lazily, so names built from script values must be interned before lookup.
+    @param qname Qualified name. Updated in place.
+    @ingroup EjsString
+    @internal
+ */
+#define ejsInternName(qname) \
+    ((qname).name = ((qname).name == 0 || ejsIsInterned((qname).name)) ? (qname).name : ejsInternString((qname).name))
+
 /** 
     Intern a string object from a UTF-8 string. 
     @description A string is created using the UTF-8 string as input. 
@@ -1526,6 +1686,16 @@ PUBLIC EjsString *ejsInternWide(struct Ejs *ejs, wchar *value, ssize len);
  */
 PUBLIC void ejsDestroyIntern(struct EjsIntern *intern);
 
+/** 
+    Get the intern string cache statistics
+    @description The counters are summed over all shards. Each shard is read under its own lock so the totals
+        are approximate while other threads are creating strings.
+    @param stats Reference to a stats structure to receive the counters
+    @ingroup EjsString
+    @internal
+ */
+PUBLIC void ejsGetInternStats(struct EjsInternStats *stats);
+
 /** 
     Parse a string and convert to an integer
     @param ejs Ejs reference returned from #ejsCreateVM
@@ -1541,7 +1711,8 @@ PUBLIC int ejsAtoi(Ejs *ejs, EjsString *sp, int radix);
     @param ejs Ejs reference returned from #ejsCreateVM
     @param s1 First string to join
     @param s2 Second string to join
-    @return A new string representing the joined strings
+    @return A new string representing the joined strings. Results of EJS_LAZY_INTERN_LEN or more characters are not
+        interned. Use #ejsInternString if a reference comparable string is required.
     @ingroup EjsString
  */
 PUBLIC EjsString *ejsJoinString(Ejs *ejs, EjsString *s1, EjsString *s2);
@@ -2151,6 +2322,7 @@ typedef struct EjsEx {
  */
 typedef struct EjsConstants {
     char          *pool;                    /**< Constant pool string data */
+    struct EjsModuleMap *map;               /**< Module file mapping holding the pool (pool is then not GC memory) */
     ssize         poolSize;                 /**< Size of constant pool storage in bytes */
     ssize         poolLength;               /**< Length of used bytes in constant pool */
     int           indexSize;                /**< Size of index in elements */
@@ -2194,6 +2366,59 @@ PUBLIC int ejsAddDebugLine(Ejs *ejs, EjsDebug **debug, int offset, wchar *source
 PUBLIC EjsLine *ejsGetDebugLine(Ejs *ejs, struct EjsFunction *fun, uchar *pc);
 PUBLIC int ejsGetDebugInfo(Ejs *ejs, struct EjsFunction *fun, uchar *pc, char **path, int *lineNumber, wchar **source);
 
+/**
+    Inline property cache entry
+    @description Records where a property name was found for a given receiver type. If holder is null, the property
+        is an own property of the receiver at slotNum. Otherwise the property was found on a prototype or type and
+        the entry is only valid while the service prototype version is unchanged.
+    @ingroup EjsFunction
+    @stability Internal
+ */
+typedef struct EjsInlineEntry {
+    struct EjsType  *type;                  /**< Receiver type */
+    EjsAny          *holder;                /**< Prototype or type holding the property. Null for own properties */
+    EjsName         qname;                  /**< Resolved property name */
+    int             slotNum;                /**< Property slot in the receiver or holder */
+    int             version;                /**< Service prototype version when the entry was created */
+} EjsInlineEntry;
+
+/**
+    Inline property cache for a by-name instruction
+    @description Each GET_OBJ_NAME, PUT_OBJ_NAME and CALL_OBJ_NAME site has a polymorphic cache of up to
+        EJS_INLINE_CACHE_SIZE entries. Caches are copied on write, published with a compare and swap and never
+        modified once published. Sites that see more receiver types are megamorphic and stop caching.
+    @ingroup EjsFunction
+    @stability Internal
+ */
+typedef struct EjsInlineCache {
+    int             count;                  /**< Number of entries */
+    EjsInlineEntry  entries[EJS_INLINE_CACHE_SIZE];
+} EjsInlineCache;
+
+/**
+    Switch lookup table entry
+    @ingroup EjsFunction
+    @stability Internal
+ */
+typedef struct EjsSwitchEntry {
+    EjsString       *value;                 /**< Case string value */
+    int             offset;                 /**< Jump offset from the end of the instruction */
+} EjsSwitchEntry;
+
+/**
+    Switch lookup table for a SWITCH_LOOKUP instruction
+    @description The hash table is built from the instruction operands on first execution and cached in the
+        instruction site. Entries are open addressed and mask + 1 is a power of two.
+    @ingroup EjsFunction
+    @stability Internal
+ */
+typedef struct EjsSwitch {
+    int             end;                    /**< Offset of the end of the instruction in the byte code */
+    int             defaultOffset;          /**< Jump offset for unmatched values */
+    int             mask;                   /**< Hash table mask */
+    EjsSwitchEntry  entries[ARRAY_FLEX];    /**< Hash table */
+} EjsSwitch;
+
 /** 
     Byte code
     @description This structure describes a sequence of byte code for a function. It also defines a set of
@@ -2207,11 +2432,14 @@ typedef struct EjsCode {
     struct EjsModule *module;                /**< Module owning this function */
     EjsDebug         *debug;                 /**< Source code debug information */
     EjsEx            **handlers;             /**< Exception handlers */
+    void * volatile  *sites;                 /**< Inline caches, switch tables and XML templates indexed by site */
+    int              numSites;               /**< Number of instruction sites. Site numbers are set by the compiler */
     int              codeLen;                /**< Byte code length */
     int              debugOffset;            /**< Offset in mod file for debug info */
     int              numHandlers;            /**< Number of exception handlers */
     int              sizeHandlers;           /**< Size of handlers array */
-    uchar            byteCode[ARRAY_FLEX];   /**< Byte code */
+    uchar            *byteCode;              /**< Byte code. Points to storage or into a read-only module mapping */
+    uchar            storage[ARRAY_FLEX];    /**< Private byte code storage */
 } EjsCode;
 
 /**
@@ -3669,6 +3897,7 @@ typedef struct EjsRegExp {
     EjsObj          obj;                /**< Base object */
     wchar           *pattern;           /**< Pattern to match */
     void            *compiled;          /**< Compiled pattern (not alloced) */
+    void            *shared;            /**< Shared compiled pattern entry owning compiled */
     bool            global;             /**< Search for pattern globally (multiple times) */
     bool            ignoreCase;         /**< Do case insensitive matching */
     bool            multiline;          /**< Match patterns over multiple lines */
@@ -3709,6 +3938,16 @@ PUBLIC EjsRegExp *ejsParseRegExp(Ejs *ejs, EjsString *pattern);
  */
 PUBLIC EjsString *ejsRegExpToString(Ejs *ejs, EjsRegExp *rp);
 
+/** 
+    Get the pattern study data for a regular expression
+    @description Patterns are studied once they have been used ME_EJS_REGEXP_STUDY times. The result should be
+        passed as the "extra" argument to pcre_exec.
+    @param rp Regular expression 
+    @return Study data or NULL if the pattern has not been studied.
+    @ingroup EjsRegExp
+ */
+PUBLIC void *ejsGetRegExpStudy(EjsRegExp *rp);
+
 /******************************************** Socket **********************************************/
 /**
     Socket Class
@@ -4001,6 +4240,15 @@ PUBLIC int ejsAppendAttributeToXML(Ejs *ejs, EjsXML *parent, EjsXML *attribute);
  */
 PUBLIC EjsXML *ejsAppendToXML(Ejs *ejs, EjsXML *dest, EjsXML *node);
 
+/** 
+    Deep copy an XML or XMLList object
+    @param ejs Ejs reference returned from #ejsCreateVM
+    @param xml Node to copy. All attributes and elements are copied recursively.
+    @return The new copy
+    @ingroup EjsXML
+ */
+PUBLIC EjsXML *ejsCloneXML(Ejs *ejs, EjsXML *xml);
+
 /** 
     Create an XML node object
     @param ejs Ejs reference returned from #ejsCreateVM
@@ -4655,19 +4903,44 @@ typedef struct EjsLookup {
 
 
 /**
-    Interned string hash shared over all interpreters
+    Shard of the interned string hash. Each shard has its own lock so that threads interning different strings
+    do not contend.
     @ingroup Ejs
     @stability Internal
  */
-typedef struct EjsIntern {
+typedef struct EjsInternShard {
     struct EjsString    *buckets;               /**< Hash buckets and references to link chains of strings (unicode) */
     int                 size;                   /**< Size of hash */
     int                 count;                  /**< Count of entries */
-    uint64              reuse;                  /**< Reuse counter */
+    uint64              reuse;                  /**< Reuse counter (lookup hits) */
     uint64              accesses;               /**< NUmber of accesses to string */
+    uint64              contention;             /**< Number of accesses that had to wait for the lock */
     MprMutex            *mutex;
+} EjsInternShard;
+
+/**
+    Interned string hash shared over all interpreters. Strings are distributed over shards by hash value.
+    @ingroup Ejs
+    @stability Internal
+ */
+typedef struct EjsIntern {
+    EjsInternShard      shards[ME_EJS_INTERN_SHARDS];
 } EjsIntern;
 
+/**
+    Interned string statistics
+    @ingroup Ejs
+    @stability Internal
+ */
+typedef struct EjsInternStats {
+    int                 count;                  /**< Count of interned strings */
+    int                 buckets;                /**< Total hash buckets over all shards */
+    int                 shards;                 /**< Number of shards */
+    uint64              accesses;               /**< Number of intern lookups */
+    uint64              reuse;                  /**< Number of lookups that found an existing string */
+    uint64              contention;             /**< Number of lookups that had to wait for a shard lock */
+} EjsInternStats;
+
 /**
     Ejscript Service structure
     @description The Ejscript service manages the overall language runtime. It 
@@ -4680,6 +4953,8 @@ typedef struct EjsService {
     EjsObj          *(*loadScriptFile)(Ejs *ejs, cchar *path, cchar *cache);
     MprList         *vmlist;                /**< List of all VM interpreters */
     MprHash         *nativeModules;         /**< Set of loaded native modules */
+    MprHash         *moduleMaps;            /**< Module file mappings shared by all interps. Indexed by path */
+    MprHash         *regexps;               /**< Compiled regular expressions shared by all interps. Indexed by source */
     Http            *http;                  /**< Http service */
     uint            dontExit: 1;            /**< Prevent App.exit() from exiting */
     uint            logging: 1;             /**< Using --log */
@@ -4687,6 +4962,8 @@ typedef struct EjsService {
     uint            seqno;                  /**< Interp sequence numbers */
     EjsIntern       *intern;                /**< Interned Unicode string hash - shared over all interps */
     EjsPot          *immutable;             /**< Immutable types and special values*/
+    struct EjsNumber **numbers;             /**< Shared small integer numbers (ME_EJS_NUMBER_CACHE_MIN..MAX) */
+    volatile int    prototypeVersion;       /**< Incremented when prototype or type properties are added or removed */
     EjsHelpers      objHelpers;             /**< Default EjsObj helpers */
     EjsHelpers      potHelpers;             /**< Default EjsPot helpers */
     EjsHelpers      blockHelpers;           /**< Default EjsBlock helpers */
@@ -4722,13 +4999,37 @@ PUBLIC Ejs *ejsCreateVM(int argc, cchar **argv, int flags);
 /**
     Clone an ejs virtual machine 
     @description Create a virtual machine interpreter boy cloning an existing interpreter. Cloning is a fast way
-        to create a new interpreter. This saves memory and speeds initialization.
+        to create a new interpreter. This saves memory and speeds initialization. If the base VM is frozen (a pool
+        template), mutable global objects are shared with the base VM and cloned on first access. The time and
+        approximate memory used by the clone are recorded in Ejs.cloneTime and Ejs.cloneMemory.
     @param ejs Base VM upon which to base the new VM.
     @return A new interpreter
     @ingroup Ejs
  */
 PUBLIC Ejs *ejsCloneVM(Ejs *ejs);
 
+/**
+    Clone a global still shared with the master VM
+    @description Deep clone the master's value for a global slot that was deferred by #ejsCloneVM and store
+        the clone in the VM global object.
+    @param ejs Ejs reference returned from #ejsCloneVM
+    @param slotNum Global slot number
+    @return The cloned value
+    @ingroup Ejs
+    @internal
+ */
+PUBLIC EjsAny *ejsCloneLazyGlobal(Ejs *ejs, int slotNum);
+
+/**
+    Stop sharing a global with the master VM
+    @description Called when a global slot that is still shared with the master VM is overwritten.
+    @param ejs Ejs reference returned from #ejsCloneVM
+    @param slotNum Global slot number
+    @ingroup Ejs
+    @internal
+ */
+PUBLIC void ejsClearLazyGlobal(Ejs *ejs, int slotNum);
+
 /**
     Set the MPR dispatcher to use for an interpreter.
     @description Interpreters serialize event activity within a dispatcher.
@@ -5046,6 +5347,7 @@ PUBLIC void ejsUnlockVm(Ejs *ejs);
         number      localCount
         number      exceptionCount
         number      codeLength
+        number      siteCount
         block       code        
 
     Exception
@@ -5135,7 +5437,7 @@ typedef void (*EjsLoaderCallback)(struct Ejs *ejs, int kind, ...);
 /*
     Module file format version
  */
-#define EJS_MODULE_VERSION      3
+#define EJS_MODULE_VERSION      5
 #define EJS_VERSION_FACTOR      1000
 #define EJS_MODULE_MAGIC        0xC7DA
 
@@ -5203,6 +5505,19 @@ typedef struct EjsModuleHdr {
 } EjsModuleHdr;
 
 
+/**
+    Read-only mapping of a module file. Function byte code and constant pools of modules loaded from the file point
+    directly into the mapping which is shared by all interpreters in the process (and by forked children).
+    @stability Internal
+ */
+typedef struct EjsModuleMap {
+    char            *path;                  /**< Module file path name */
+    char            *data;                  /**< Mapped file contents */
+    ssize           size;                   /**< Size of the mapping */
+    MprTime         modified;               /**< File modification time when mapped */
+} EjsModuleMap;
+
+
 /**
     Module control structure
     @defgroup EjsModule EjsModule
@@ -5221,6 +5536,7 @@ typedef struct EjsModule {
 
     EjsConstants    *constants;             /**< Constant pool */
     EjsFunction     *initializer;           /**< Initializer method */
+    struct EjsModuleMap *map;               /**< Read-only mapping of the module file */
 
     //  TODO - should have isDefault bit
     uint            compiling       : 1;    /**< Module currently being compiled from source */
@@ -5263,6 +5579,8 @@ typedef struct EjsModule {
 PUBLIC int ejsCreateConstants(Ejs *ejs, EjsModule *mp, int count, ssize size, char *pool);
 PUBLIC int ejsGrowConstants(Ejs *ejs, EjsModule *mp, ssize size);
 PUBLIC int ejsAddConstant(Ejs *ejs, EjsModule *mp, cchar *str);
+PUBLIC EjsModuleMap *ejsMapModule(Ejs *ejs, cchar *path);
+PUBLIC bool ejsIsMapped(EjsModuleMap *map, cvoid *ptr, ssize len);
 
 /**
     Native module initialization callback
@@ -0,0 +1,14 @@
+
+require ejs.web
+    
+let server: HttpServer = new HttpServer
+var router = new Router(Router.Restful)
+
+server.on("readable", function (event, request) {
+    App.log.info(request.method, request.uri, request.scheme)
+    server.serve(request, router)
+})
+
+App.log.info("Listen on", App.config.web.listen)
+server.listen(App.config.web.listen)
+App.run()
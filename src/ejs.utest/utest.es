@@ -402,7 +402,7 @@ enumerable class Test {
         let test = this
         test.failed = false
         w.onmessage = function (e) {
-            obj = deserialize(e.data)
+            obj = e.data
             if (obj.passed) {
                 test.passedCount++
                 test.testCount++
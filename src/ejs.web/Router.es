@@ -19,6 +19,11 @@ module ejs.web {
         The request's leading URI pathInfo segment is used to select a route set and then the request is matched 
         against each route in that set. Routes are matched in the order in which they are defined.
 
+        String templates composed of literal text, "{token}" segments, optional "()" groups and a trailing "/.*" are
+        compiled into a native prefix tree per route set so that a request is matched in a single pass over its 
+        pathInfo. Regular expression, function and other complex templates are tested individually, but only when 
+        they precede the best prefix tree match so the defined order is still honored.
+
         @example:
         var r = new Router
         
@@ -157,6 +162,14 @@ module ejs.web {
             Routes indexed by first component of the URI path/template
          */
         public var routes: Object = {}
+
+        /*
+            Native prefix tree of the string template routes and the per route set lists of routes that must be 
+            tested individually. Rebuilt on the first route() after the route table is modified.
+         */
+        private var index: RouteIndex?
+        private var indexed: Object?
+        private var fallbacks: Object
         
         /**
             Function to test if the Request.filename is a directory.
@@ -344,6 +357,7 @@ module ejs.web {
         private function insertRoute(r: Route): Void {
             let routeSet = routes[r.routeSetName] ||= {}
             routeSet[r.name] = r
+            index = null
             if (r.workers == null) {
                 r.workers = routerOptions.workers
             }
@@ -444,6 +458,7 @@ module ejs.web {
             for (let routeName in routeSet) {
                 if (routeName == action) {
                     delete routeSet[action]
+                    index = null
                     return
                 }
             }
@@ -455,6 +470,52 @@ module ejs.web {
          */
         public function reset(request): Void {
             routes = {}
+            index = null
+        }
+
+        /*
+            Index the route table. Routes are numbered in route set order. Routes whose template cannot be represented
+            in the prefix tree are kept in order for individual matching.
+         */
+        private function buildIndex(): Void {
+            index = new RouteIndex
+            indexed = routes
+            fallbacks = {}
+            for (name in routes) {
+                let order = 0
+                for each (r in routes[name]) {
+                    r.order = order++
+                    if (!(r.originalTemplate is String) || 
+                            !index.add(name, r, r.originalTemplate, r.constraints, r.method, r.order)) {
+                        (fallbacks[name] ||= []).push(r)
+                    }
+                }
+            }
+        }
+
+        /*
+            Match a request against a route set. The best prefix tree match is only used if no route that must be
+            tested individually precedes it.
+         */
+        private function matchSet(request: Request, name: String): Route? {
+            let found = index.lookup(name, request.pathInfo, request.method)
+            let best = found ? found[0] : null
+            for each (r in fallbacks[name]) {
+                if (best && r.order > best.order) {
+                    break
+                }
+                request.log.debug(5, "Test route \"" + r.name + "\"")
+                if (r.match(request)) {
+                    return r
+                }
+            }
+            if (best) {
+                let params = request.params
+                for (let i = 1; i < found.length; i += 2) {
+                    params[found[i]] ||= found[i + 1]
+                }
+            }
+            return best
         }
 
         private function reroute(request): Route {
@@ -541,19 +602,13 @@ module ejs.web {
                     request.method = method
                 }
             }
-            let routeSet = routes[request.pathInfo.split("/")[1]]
-            for each (r in routeSet) {
-                log.debug(5, "Test route \"" + r.name + "\"")
-                if (r.match(request)) {
-                    return secondStageRoute(request, r)
-                }
+            if (!index || indexed !== routes) {
+                buildIndex()
             }
-            routeSet = routes[""]
-            for each (r in routeSet) {
-                log.debug(5, "Test route \"" + r.name + "\"")
-                if (r.match(request)) {
-                    return secondStageRoute(request, r)
-                }
+            let name = request.pathInfo.split("/")[1]
+            let r = (name && matchSet(request, name)) || matchSet(request, "")
+            if (r) {
+                return secondStageRoute(request, r)
             }
             throw "No route for " + request.pathInfo
         }
@@ -681,7 +736,7 @@ module ejs.web {
         /**
             Original template as supplied by caller
          */
-        private var originalTemplate: Object
+        internal var originalTemplate: Object
 
         /**
             Outer route for a nested route. A nested route prepends the outer route template to its template. 
@@ -761,11 +816,21 @@ module ejs.web {
          */
         var trace: Object
 
+        /*
+            Token constraints. Regular expressions that token values must match.
+         */
+        internal var constraints: Object?
+
         /*
             Match function
          */
         internal var match: Function
 
+        /*
+            Position of the route in its route set. Assigned when the router indexes its routes.
+         */
+        internal var order: Number
+
         /*
             Regular expression pattern. This matches the pathInfo for the route.
          */
@@ -861,7 +926,7 @@ module ejs.web {
                 for (i in tokens) {
                     tokens[i] = tokens[i].trimStart('{').trimEnd('}')
                 }
-                let constraints = options.constraints
+                constraints = options.constraints
                 for each (token in tokens) {
                     if (constraints && constraints[token]) {
                         t = t.replace("{" + token + "}", "(" + constraints[token] + ")")
@@ -1047,6 +1112,40 @@ module ejs.web {
         }
 
     }
+
+    /**
+        Native prefix tree index of route templates used by the Router to match requests.
+        @hide
+     */
+    final class RouteIndex {
+        use default namespace public
+
+        native function RouteIndex()
+
+        /**
+            Add a route to the index
+            @param name Route set name
+            @param route Route to add
+            @param template String route template
+            @param constraints Token constraints
+            @param method HTTP methods matched by the route. Set to "" for all methods.
+            @param order Position of the route in the route set
+            @return True if the route was added. False if the template cannot be represented by the index and the
+                route must be matched individually.
+         */
+        native function add(name: String, route: Route, template: String, constraints: Object?, method: String, 
+            order: Number): Boolean
+
+        /**
+            Find the first route in a route set that matches a request
+            @param name Route set name
+            @param pathInfo Request pathInfo
+            @param method Request HTTP method. Only routes matching all methods are considered if null.
+            @return An array with the matching route followed by token name and value pairs. Returns null if no 
+                route matches.
+         */
+        native function lookup(name: String, pathInfo: String, method: String?): Array?
+    }
 }
 
 /*
@@ -0,0 +1,78 @@
+/**
+    VMPool.es -- Pool of virtual machines for hosting requests
+ */
+
+# Config.WEB
+module ejs.web {
+    /**
+        Pool of virtual machines. Web server hosts use a VM pool to run requests in VMs cloned from a template VM.
+        The pool keeps at least "min" VMs, pre-warms VMs when demand requires and prunes VMs that have been idle for
+        longer than the idle timeout. When the pool has "max" VMs, alloc() waits for a VM to be freed. Default limits
+        are taken from the ejsrc "pool" section as read by the template VM.
+        @stability prototype
+        @hide
+     */
+    final class VMPool {
+        use default namespace public
+
+        /**
+            Create a VM pool
+            @param max Maximum number of VMs. Set to zero for no limit.
+            @param templateScript Script literal to run once in the template VM from which pool VMs are cloned
+            @param startScript Script literal to run in each VM when it is created
+         */
+        native function VMPool(max: Number = 0, templateScript: String? = null, startScript: String? = null)
+
+        /**
+            Allocate a VM from the pool. If the pool is full, this waits up to the pool wait timeout for a VM
+                to be freed.
+            @return A VM handle to pass to free(). Returns null if a VM cannot be allocated.
+         */
+        native function alloc(): Number?
+
+        /**
+            Free a VM back to the pool
+            @param handle VM handle returned by alloc()
+         */
+        native function free(handle: Number): Void
+
+        /**
+            Set the pool limits. The minimum number of VMs are created before returning.
+            @param min Minimum number of VMs to keep in the pool
+            @param max Maximum number of VMs. Set to zero for no limit.
+            @param idle Time in milliseconds before idle VMs are pruned. Set to -1 to keep the current value.
+            @param wait Time in milliseconds to wait for a VM when the pool is full. Set to -1 to keep the current 
+                value. Set to zero to fail immediately.
+         */
+        native function setLimits(min: Number, max: Number, idle: Number = -1, wait: Number = -1): Void
+
+        /**
+            Pool statistics. The statistics include the "count" of allocated VMs, the "active" and "idle" counts, 
+            the number of callers "waiting", the "min" and "max" limits, the "peakActive" VMs, and the number 
+            of "allocs", VMs "created", "prewarmed" and "reaped", caller "waits" and wait "timeouts", and the 
+            "totalWait" and "maxWait" times in milliseconds.
+         */
+        native function get stats(): Object
+    }
+}
+
+
+/*
+    @copy   default
+
+    Copyright (c) Embedthis Software. All Rights Reserved.
+
+    This software is distributed under commercial and open source licenses.
+    You may use the Embedthis Open Source license or you may acquire a 
+    commercial license from Embedthis Software. You agree to be fully bound
+    by the terms of either license. Consult the LICENSE.md distributed with
+    this software for full details and other copyrights.
+
+    Local variables:
+    tab-width: 4
+    c-basic-offset: 4
+    End:
+    vim: sw=4 ts=4 expandtab
+
+    @end
+ */
@@ -1008,6 +1008,7 @@ static EjsObj *req_autoFinalize(Ejs *ejs, EjsRequest *req, int argc, EjsObj **ar
 {
     /* If writeBuffer is set, HttpServer is capturning output for caching */
     if (req->conn && !req->dontAutoFinalize) {
+        ejsSaveSession(ejs, req->session);
         if (!req->writeBuffer) {
             httpFinalize(req->conn);
         }
@@ -1022,6 +1023,7 @@ static EjsObj *req_autoFinalize(Ejs *ejs, EjsRequest *req, int argc, EjsObj **ar
  */
 static EjsObj *req_close(Ejs *ejs, EjsRequest *req, int argc, EjsObj **argv)
 {
+    ejsSaveSession(ejs, req->session);
     if (req->conn) {
         if (!req->writeBuffer) {
             httpFinalize(req->conn);
@@ -1067,6 +1069,7 @@ static EjsObj *req_dontAutoFinalize(Ejs *ejs, EjsRequest *req, int argc, EjsObj
  */
 static EjsObj *req_finalize(Ejs *ejs, EjsRequest *req, int argc, EjsObj **argv)
 {
+    ejsSaveSession(ejs, req->session);
     if (req->conn) {
         if (!req->writeBuffer || req->writeBuffer == ESV(null)) {
             httpFinalize(req->conn);
@@ -1395,6 +1398,7 @@ static EjsObj *req_writeFile(Ejs *ejs, EjsRequest *req, int argc, EjsObj **argv)
     tx->length = tx->entityLength = info->size;
     httpSetSendConnector(req->conn, path->value);
     httpPutForService(conn->writeq, packet, 0);
+    ejsSaveSession(ejs, req->session);
     httpFinalize(req->conn);
     req->finalized = 1;
     return ESV(true);
@@ -1487,6 +1491,8 @@ void ejsSendRequestCloseEvent(Ejs *ejs, EjsRequest *req)
         req->closed = 1;
         ejsSendEvent(ejs, req->emitter, "close", NULL, req);
     }
+    /* Catch session updates made after finalization or by close event listeners */
+    ejsSaveSession(ejs, req->session);
 }
 
 
@@ -0,0 +1,631 @@
+/**
+    ejsRouter.c - Native prefix tree index for the Router class.
+
+    String route templates are compiled into a radix tree per route set. Literal text is stored on the tree edges
+    and "{token}" segments become capture nodes that consume a whole path segment, optionally constrained to digits.
+    Optional "()" groups are expanded into alternatives and a trailing ".*" matches the remainder of the pathInfo.
+    A lookup descends the tree once and selects the matching route that was defined first. This yields the same
+    route and token values as testing each compiled template regular expression in order.
+
+    Copyright (c) All Rights Reserved. See details at the end of the file.
+ */
+
+/********************************** Includes **********************************/
+
+#include    "me.h"
+
+#if ME_EJSCRIPT_WEB
+#include    "ejs.h"
+#include    "ejsWeb.h"
+#include    "ejs.web.slots.h"
+
+/*********************************** Locals ***********************************/
+
+#define ROUTE_MAX_TOKENS    16          /* Max tokens in an indexed template */
+#define ROUTE_MAX_ELTS      48          /* Max elements in an indexed template */
+#define ROUTE_MAX_ALTS      32          /* Max expansions of optional groups */
+#define ROUTE_MAX_DEPTH     8           /* Max nesting of optional groups */
+
+/*
+    Template element and tree node types
+ */
+#define ROUTE_LITERAL       1           /* Literal text */
+#define ROUTE_TOKEN         2           /* {token} matching [^/]* */
+#define ROUTE_DIGITS        3           /* {token} constrained to [0-9]+ */
+#define ROUTE_REST          4           /* Trailing .* */
+#define ROUTE_OPEN          5           /* Start of an optional group */
+#define ROUTE_CLOSE         6           /* End of an optional group */
+
+typedef struct RouteElt {
+    int         type;                   /* Element type */
+    int         token;                  /* Token index for ROUTE_TOKEN and ROUTE_DIGITS */
+    cchar       *text;                  /* Literal text */
+    ssize       len;                    /* Length of literal text */
+} RouteElt;
+
+typedef struct RouteAlt {
+    int         count;                  /* Number of elements */
+    uchar       elts[ROUTE_MAX_ELTS];   /* Element indexes */
+} RouteAlt;
+
+typedef struct RouteAlts {
+    int         count;                  /* Number of alternatives */
+    RouteAlt    alt[ROUTE_MAX_ALTS];    /* Alternatives in regular expression preference order */
+} RouteAlts;
+
+/*
+    Parsed template
+ */
+typedef struct RouteTemplate {
+    RouteElt    elts[ROUTE_MAX_ELTS];
+    int         count;
+    MprList     *tokens;                /* Token names in template order */
+} RouteTemplate;
+
+/*
+    Route shared by all the leaves of its template alternatives
+ */
+typedef struct RouteEntry {
+    EjsAny      *route;                 /* Route object */
+    MprList     *tokens;                /* Token names (EjsString) in template order */
+    char        *method;                /* Methods matched by the route. Empty for all methods. */
+    int         order;                  /* Position of the route in its route set */
+} RouteEntry;
+
+typedef struct RouteLeaf {
+    RouteEntry  *entry;                 /* Owning route */
+    int         alt;                    /* Template alternative. Lower alternatives are preferred. */
+    int         captures;               /* Number of token captures on the tree path to the leaf */
+    char        slots[ROUTE_MAX_TOKENS];/* Token index for each capture */
+} RouteLeaf;
+
+typedef struct RouteNode {
+    int         type;                   /* ROUTE_LITERAL, ROUTE_TOKEN or ROUTE_DIGITS */
+    int         minOrder;               /* Lowest route order in this subtree */
+    char        *literal;               /* Edge text for literal nodes */
+    ssize       len;                    /* Length of the edge text */
+    MprList     *children;              /* Child nodes */
+    MprList     *ends;                  /* Leaves matching when the pathInfo ends at this node */
+    MprList     *rests;                 /* Leaves matching any remaining pathInfo */
+} RouteNode;
+
+typedef struct RouteSearch {
+    cchar       *path;                  /* PathInfo to match */
+    ssize       length;                 /* Length of the pathInfo */
+    cchar       *method;                /* Request method */
+    RouteLeaf   *best;                  /* Best leaf matched so far */
+    ssize       offsets[ROUTE_MAX_TOKENS];
+    ssize       lengths[ROUTE_MAX_TOKENS];
+    ssize       bestOffsets[ROUTE_MAX_TOKENS];
+    ssize       bestLengths[ROUTE_MAX_TOKENS];
+} RouteSearch;
+
+/********************************** Forwards **********************************/
+
+static RouteNode *createNode(int type, cchar *literal, ssize len, int order);
+
+/************************************ Code ************************************/
+
+static void manageEntry(RouteEntry *entry, int flags)
+{
+    if (flags & MPR_MANAGE_MARK) {
+        mprMark(entry->route);
+        mprMark(entry->tokens);
+        mprMark(entry->method);
+    }
+}
+
+
+static void manageLeaf(RouteLeaf *leaf, int flags)
+{
+    if (flags & MPR_MANAGE_MARK) {
+        mprMark(leaf->entry);
+    }
+}
+
+
+static void manageNode(RouteNode *node, int flags)
+{
+    if (flags & MPR_MANAGE_MARK) {
+        mprMark(node->literal);
+        mprMark(node->children);
+        mprMark(node->ends);
+        mprMark(node->rests);
+    }
+}
+
+
+static RouteNode *createNode(int type, cchar *literal, ssize len, int order)
+{
+    RouteNode   *node;
+
+    if ((node = mprAllocObj(RouteNode, manageNode)) == 0) {
+        return 0;
+    }
+    node->type = type;
+    node->minOrder = order;
+    if (literal) {
+        node->literal = snclone(literal, len);
+        node->len = len;
+    }
+    node->children = mprCreateList(0, MPR_LIST_STABLE);
+    node->ends = mprCreateList(0, MPR_LIST_STABLE);
+    node->rests = mprCreateList(0, MPR_LIST_STABLE);
+    return node;
+}
+
+
+static bool isDigits(EjsString *constraint)
+{
+    return scmp(constraint->value, "[0-9]+") == 0 || scmp(constraint->value, "\\d+") == 0;
+}
+
+
+/*
+    Split a template into elements. Returns false if the template uses regular expression syntax that the tree
+    cannot represent. Route.compileTemplate converts "(" and ")" into an optional non-capturing group, "{token}" into
+    a capture and uses all other characters as regular expression source.
+ */
+static bool parseTemplate(Ejs *ejs, RouteTemplate *tp, cchar *template, EjsAny *constraints)
+{
+    RouteElt    *ep;
+    EjsString   *name, *constraint;
+    cchar       *cp, *start;
+    int         depth;
+
+    tp->count = 0;
+    tp->tokens = mprCreateList(0, MPR_LIST_STABLE);
+    depth = 0;
+
+    for (cp = template; *cp; ) {
+        if (tp->count >= ROUTE_MAX_ELTS) {
+            return 0;
+        }
+        ep = &tp->elts[tp->count++];
+        ep->text = 0;
+        ep->len = 0;
+        ep->token = 0;
+        switch (*cp) {
+        case '(':
+            if (++depth > ROUTE_MAX_DEPTH) {
+                return 0;
+            }
+            ep->type = ROUTE_OPEN;
+            cp++;
+            break;
+
+        case ')':
+            if (--depth < 0) {
+                return 0;
+            }
+            ep->type = ROUTE_CLOSE;
+            cp++;
+            break;
+
+        case '{':
+            for (start = ++cp; *cp && !strchr("{}()", *cp); cp++) ;
+            if (*cp != '}' || cp == start || mprGetListLength(tp->tokens) >= ROUTE_MAX_TOKENS) {
+                return 0;
+            }
+            name = ejsCreateStringFromMulti(ejs, start, cp - start);
+            if (mprLookupItem(tp->tokens, name) >= 0) {
+                /* compileTemplate only substitutes the first occurrence of a token */
+                return 0;
+            }
+            ep->type = ROUTE_TOKEN;
+            ep->token = mprAddItem(tp->tokens, name);
+            if (ejsIsDefined(ejs, constraints)) {
+                constraint = ejsGetPropertyByName(ejs, constraints, EN(name->value));
+                if (constraint && ejsToBoolean(ejs, constraint) == ESV(true)) {
+                    if (!ejsIs(ejs, constraint, String) || !isDigits(constraint)) {
+                        return 0;
+                    }
+                    ep->type = ROUTE_DIGITS;
+                }
+            }
+            cp++;
+            break;
+
+        case '.':
+            if (cp[1] != '*') {
+                return 0;
+            }
+            ep->type = ROUTE_REST;
+            cp += 2;
+            break;
+
+        default:
+            for (start = cp; *cp && !strchr("\\^$.|?*+()[]{}", *cp); cp++) ;
+            if (cp == start) {
+                return 0;
+            }
+            ep->type = ROUTE_LITERAL;
+            ep->text = start;
+            ep->len = cp - start;
+            break;
+        }
+    }
+    return depth == 0;
+}
+
+
+/*
+    Expand the optional groups in the elements from start to end. Alternatives are generated in the order a
+    backtracking regular expression engine would try them: groups are included before they are omitted.
+ */
+static bool expandAlts(RouteTemplate *tp, int start, int end, RouteAlts *alts)
+{
+    RouteAlts   inner, result;
+    RouteAlt    *ap, *op;
+    int         i, j, k, close, level;
+
+    alts->count = 1;
+    alts->alt[0].count = 0;
+
+    for (i = start; i < end; i++) {
+        if (tp->elts[i].type == ROUTE_OPEN) {
+            for (level = 0, close = i; close < end; close++) {
+                if (tp->elts[close].type == ROUTE_OPEN) {
+                    level++;
+                } else if (tp->elts[close].type == ROUTE_CLOSE && --level == 0) {
+                    break;
+                }
+            }
+            if (!expandAlts(tp, i + 1, close, &inner)) {
+                return 0;
+            }
+            /* The omitted group is the least preferred alternative */
+            if (inner.count >= ROUTE_MAX_ALTS || alts->count * (inner.count + 1) > ROUTE_MAX_ALTS) {
+                return 0;
+            }
+            inner.alt[inner.count++].count = 0;
+            result.count = 0;
+            for (j = 0; j < alts->count; j++) {
+                for (k = 0; k < inner.count; k++) {
+                    ap = &result.alt[result.count++];
+                    op = &inner.alt[k];
+                    if (alts->alt[j].count + op->count > ROUTE_MAX_ELTS) {
+                        return 0;
+                    }
+                    *ap = alts->alt[j];
+                    memcpy(&ap->elts[ap->count], op->elts, op->count);
+                    ap->count += op->count;
+                }
+            }
+            *alts = result;
+            i = close;
+
+        } else {
+            for (j = 0; j < alts->count; j++) {
+                ap = &alts->alt[j];
+                ap->elts[ap->count++] = (uchar) i;
+            }
+        }
+    }
+    return 1;
+}
+
+
+/*
+    Check an alternative can be matched in the tree. Tokens must extend to the end of their path segment so that each
+    alternative matches a pathInfo in exactly one way. A rest element must be last.
+ */
+static bool checkAlt(RouteTemplate *tp, RouteAlt *ap)
+{
+    RouteElt    *ep, *next;
+    int         i;
+
+    for (i = 0; i < ap->count; i++) {
+        ep = &tp->elts[ap->elts[i]];
+        next = (i + 1) < ap->count ? &tp->elts[ap->elts[i + 1]] : 0;
+        if (ep->type == ROUTE_REST && next) {
+            return 0;
+        }
+        if ((ep->type == ROUTE_TOKEN || ep->type == ROUTE_DIGITS) && next &&
+                (next->type != ROUTE_LITERAL || next->text[0] != '/')) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+
+static RouteNode *insertLiteral(RouteNode *node, cchar *text, ssize len, int order)
+{
+    RouteNode   *child, *tail;
+    ssize       common;
+    int         next;
+
+    while (len > 0) {
+        for (ITERATE_ITEMS(node->children, child, next)) {
+            if (child->type == ROUTE_LITERAL && child->literal[0] == text[0]) {
+                break;
+            }
+        }
+        if (child == 0) {
+            child = createNode(ROUTE_LITERAL, text, len, order);
+            mprAddItem(node->children, child);
+            return child;
+        }
+        for (common = 1; common < child->len && common < len && child->literal[common] == text[common]; common++) ;
+        if (common < child->len) {
+            /*
+                Split the edge. The tail inherits the child's subtree.
+             */
+            tail = createNode(ROUTE_LITERAL, &child->literal[common], child->len - common, child->minOrder);
+            tail->children = child->children;
+            tail->ends = child->ends;
+            tail->rests = child->rests;
+            child->literal = snclone(child->literal, common);
+            child->len = common;
+            child->children = mprCreateList(0, MPR_LIST_STABLE);
+            child->ends = mprCreateList(0, MPR_LIST_STABLE);
+            child->rests = mprCreateList(0, MPR_LIST_STABLE);
+            mprAddItem(child->children, tail);
+        }
+        child->minOrder = min(child->minOrder, order);
+        node = child;
+        text += common;
+        len -= common;
+    }
+    return node;
+}
+
+
+static RouteNode *insertToken(RouteNode *node, int type, int order)
+{
+    RouteNode   *child;
+    int         next;
+
+    for (ITERATE_ITEMS(node->children, child, next)) {
+        if (child->type == type) {
+            child->minOrder = min(child->minOrder, order);
+            return child;
+        }
+    }
+    child = createNode(type, 0, 0, order);
+    mprAddItem(node->children, child);
+    return child;
+}
+
+
+static void insertAlt(RouteNode *root, RouteTemplate *tp, RouteAlt *ap, RouteEntry *entry, int alt)
+{
+    RouteNode   *node;
+    RouteElt    *ep;
+    RouteLeaf   *leaf;
+    int         i;
+
+    leaf = mprAllocObj(RouteLeaf, manageLeaf);
+    leaf->entry = entry;
+    leaf->alt = alt;
+
+    node = root;
+    node->minOrder = min(node->minOrder, entry->order);
+    for (i = 0; i < ap->count; i++) {
+        ep = &tp->elts[ap->elts[i]];
+        switch (ep->type) {
+        case ROUTE_LITERAL:
+            node = insertLiteral(node, ep->text, ep->len, entry->order);
+            break;
+        case ROUTE_TOKEN:
+        case ROUTE_DIGITS:
+            node = insertToken(node, ep->type, entry->order);
+            leaf->slots[leaf->captures++] = (char) ep->token;
+            break;
+        case ROUTE_REST:
+            mprAddItem(node->rests, leaf);
+            return;
+        }
+    }
+    mprAddItem(node->ends, leaf);
+}
+
+
+/*
+    Test if a leaf is a better match than the best so far. Routes defined first are preferred, then the alternative
+    the regular expression would match first.
+ */
+static void matchLeaves(RouteSearch *sp, MprList *leaves, int depth)
+{
+    RouteLeaf   *leaf, *best;
+    int         next;
+
+    for (ITERATE_ITEMS(leaves, leaf, next)) {
+        best = sp->best;
+        if (best && (leaf->entry->order > best->entry->order ||
+                (leaf->entry->order == best->entry->order && leaf->alt >= best->alt))) {
+            continue;
+        }
+        if (leaf->entry->method[0] && !strstr(sp->method, leaf->entry->method)) {
+            continue;
+        }
+        sp->best = leaf;
+        memcpy(sp->bestOffsets, sp->offsets, depth * sizeof(ssize));
+        memcpy(sp->bestLengths, sp->lengths, depth * sizeof(ssize));
+    }
+}
+
+
+static void searchNode(RouteSearch *sp, RouteNode *node, ssize pos, int depth)
+{
+    RouteNode   *child;
+    cchar       *path;
+    ssize       end, i;
+    int         next;
+
+    if (sp->best && node->minOrder > sp->best->entry->order) {
+        return;
+    }
+    path = sp->path;
+    if (pos == sp->length) {
+        matchLeaves(sp, node->ends, depth);
+    }
+    if (node->rests->length > 0 && !memchr(&path[pos], '\n', sp->length - pos)) {
+        matchLeaves(sp, node->rests, depth);
+    }
+    for (ITERATE_ITEMS(node->children, child, next)) {
+        if (child->type == ROUTE_LITERAL) {
+            if (child->len <= (sp->length - pos) && memcmp(&path[pos], child->literal, child->len) == 0) {
+                searchNode(sp, child, pos + child->len, depth);
+            }
+        } else if (depth < ROUTE_MAX_TOKENS) {
+            for (end = pos; end < sp->length && path[end] != '/'; end++) ;
+            if (child->type == ROUTE_DIGITS) {
+                for (i = pos; i < end && isdigit((uchar) path[i]); i++) ;
+                if (end == pos || i < end) {
+                    continue;
+                }
+            }
+            sp->offsets[depth] = pos;
+            sp->lengths[depth] = end - pos;
+            searchNode(sp, child, end, depth + 1);
+        }
+    }
+}
+
+
+/*
+    function RouteIndex()
+ */
+static EjsRouteIndex *rt_constructor(Ejs *ejs, EjsRouteIndex *ip, int argc, EjsObj **argv)
+{
+    ip->sets = mprCreateHash(0, 0);
+    return ip;
+}
+
+
+/*
+    function add(name: String, route: Route, template: String, constraints: Object?, method: String,
+        order: Number): Boolean
+ */
+static EjsBoolean *rt_add(Ejs *ejs, EjsRouteIndex *ip, int argc, EjsObj **argv)
+{
+    RouteTemplate   tmpl;
+    RouteAlts       alts;
+    RouteEntry      *entry;
+    RouteNode       *root;
+    EjsString       *name;
+    int             i;
+
+    name = (EjsString*) argv[0];
+    if (!parseTemplate(ejs, &tmpl, ((EjsString*) argv[2])->value, argv[3])) {
+        return ESV(false);
+    }
+    if (!expandAlts(&tmpl, 0, tmpl.count, &alts)) {
+        return ESV(false);
+    }
+    for (i = 0; i < alts.count; i++) {
+        if (!checkAlt(&tmpl, &alts.alt[i])) {
+            return ESV(false);
+        }
+    }
+    if ((entry = mprAllocObj(RouteEntry, manageEntry)) == 0) {
+        return ESV(false);
+    }
+    entry->route = argv[1];
+    entry->tokens = tmpl.tokens;
+    entry->method = ejsToMulti(ejs, argv[4]);
+    entry->order = ejsGetInt(ejs, argv[5]);
+
+    if ((root = mprLookupKey(ip->sets, name->value)) == 0) {
+        root = createNode(ROUTE_LITERAL, 0, 0, entry->order);
+        mprAddKey(ip->sets, name->value, root);
+    }
+    for (i = 0; i < alts.count; i++) {
+        insertAlt(root, &tmpl, &alts.alt[i], entry, i);
+    }
+    return ESV(true);
+}
+
+
+/*
+    function lookup(name: String, pathInfo: String, method: String?): Array?
+ */
+static EjsArray *rt_lookup(Ejs *ejs, EjsRouteIndex *ip, int argc, EjsObj **argv)
+{
+    RouteSearch     search;
+    RouteEntry      *entry;
+    RouteNode       *root;
+    RouteLeaf       *leaf;
+    EjsArray        *result;
+    EjsString       *pathInfo, *values[ROUTE_MAX_TOKENS];
+    int             i, ntokens;
+
+    if ((root = mprLookupKey(ip->sets, ((EjsString*) argv[0])->value)) == 0) {
+        return ESV(null);
+    }
+    pathInfo = (EjsString*) argv[1];
+    search.path = pathInfo->value;
+    search.length = pathInfo->length;
+    search.method = ejsIs(ejs, argv[2], String) ? ((EjsString*) argv[2])->value : "";
+    search.best = 0;
+    searchNode(&search, root, 0, 0);
+
+    if ((leaf = search.best) == 0) {
+        return ESV(null);
+    }
+    entry = leaf->entry;
+    ntokens = mprGetListLength(entry->tokens);
+    for (i = 0; i < ntokens; i++) {
+        values[i] = ESV(empty);
+    }
+    for (i = 0; i < leaf->captures; i++) {
+        values[(int) leaf->slots[i]] = ejsCreateStringFromMulti(ejs, &search.path[search.bestOffsets[i]],
+            search.bestLengths[i]);
+    }
+    result = ejsCreateArray(ejs, 0);
+    ejsAddItem(ejs, result, entry->route);
+    for (i = 0; i < ntokens; i++) {
+        ejsAddItem(ejs, result, mprGetItem(entry->tokens, i));
+        ejsAddItem(ejs, result, values[i]);
+    }
+    return result;
+}
+
+
+static void manageRouteIndex(EjsRouteIndex *ip, int flags)
+{
+    if (flags & MPR_MANAGE_MARK) {
+        ejsManagePot(ip, flags);
+        mprMark(ip->sets);
+    }
+}
+
+
+void ejsConfigureRouteIndexType(Ejs *ejs)
+{
+    EjsType     *type;
+    EjsPot      *prototype;
+
+    if ((type = ejsFinalizeScriptType(ejs, N("ejs.web", "RouteIndex"), sizeof(EjsRouteIndex), manageRouteIndex,
+            EJS_TYPE_POT | EJS_TYPE_MUTABLE_INSTANCES)) == 0) {
+        return;
+    }
+    ejsBindConstructor(ejs, type, rt_constructor);
+    prototype = type->prototype;
+    ejsBindMethod(ejs, prototype, ES_ejs_web_RouteIndex_add, rt_add);
+    ejsBindMethod(ejs, prototype, ES_ejs_web_RouteIndex_lookup, rt_lookup);
+}
+#endif
+
+
+/*
+    @copy   default
+
+    Copyright (c) Embedthis Software. All Rights Reserved.
+
+    This software is distributed under commercial and open source licenses.
+    You may use the Embedthis Open Source license or you may acquire a
+    commercial license from Embedthis Software. You agree to be fully bound
+    by the terms of either license. Consult the LICENSE.md distributed with
+    this software for full details and other copyrights.
+
+    Local variables:
+    tab-width: 4
+    c-basic-offset: 4
+    End:
+    vim: sw=4 ts=4 expandtab
+
+    @end
+ */
@@ -73,12 +73,35 @@ EjsSession *ejsGetSession(Ejs *ejs, EjsString *key, MprTicks timeout, int create
 int ejsDestroySession(Ejs *ejs, EjsSession *sp)
 {
     if (sp) {
+        sp->dirty = 0;
         ejsCacheRemove(ejs, sp->cache, sp->key);
     }
     return 0;
 }
 
 
+/*
+    Write the session back to the cache store if it has been modified. The whole session is serialized once 
+    regardless of how many properties were set during the request.
+ */
+int ejsSaveSession(Ejs *ejs, EjsSession *sp)
+{
+    if (sp == 0 || !sp->dirty || sp->cache == 0 || sp->key == 0) {
+        return 0;
+    }
+    sp->dirty = 0;
+    if (sp->options == 0) {
+        sp->options = ejsCreateEmptyPot(ejs);
+        ejsSetPropertyByName(ejs, sp->options, EN("lifespan"), 
+            ejsCreateNumber(ejs, (MprNumber) (sp->timeout / TPS)));
+    }
+    if (ejsCacheWriteObj(ejs, sp->cache, sp->key, sp, sp->options) == 0) {
+        return MPR_ERR_CANT_WRITE;
+    }
+    return 0;
+}
+
+
 static void manageSession(EjsSession *sp, int flags)
 {
     if (flags & MPR_MANAGE_MARK) {
@@ -91,7 +114,7 @@ static void manageSession(EjsSession *sp, int flags)
 
 
 /*
-    Session state is read once and cached. Writes to session properties are cached with write-through
+    Session state is read once and cached. Writes to session properties are buffered and written back by ejsSaveSession
  */
 static int getSessionState(Ejs *ejs, EjsSession *sp) 
 {
@@ -152,22 +175,20 @@ static int lookupSessionProperty(Ejs *ejs, EjsSession *sp, EjsName qname)
 
 
 /*
-    Set a session property with write-through to the key/value cache
+    Set a session property and mark the session dirty. The session is written to the key/value cache when the 
+    request is finalized, or immediately for write-through sessions.
  */
 static int setSessionProperty(Ejs *ejs, EjsSession *sp, int slotNum, EjsAny *value)
 {
-    if (ejs->service->potHelpers.setProperty(ejs, sp, slotNum, value) != slotNum) {
+    getSessionState(ejs, sp);
+    if ((slotNum = ejs->service->potHelpers.setProperty(ejs, sp, slotNum, value)) < 0) {
         return EJS_ERR;
     }
-    if (sp->options == 0) {
-        sp->options = ejsCreateEmptyPot(ejs);
-        ejsSetPropertyByName(ejs, sp->options, EN("lifespan"), 
-            ejsCreateNumber(ejs, (MprNumber) (sp->timeout / TPS)));
-    }
-    if (ejsCacheWriteObj(ejs, sp->cache, sp->key, sp, sp->options) == 0) {
+    sp->dirty++;
+    if (sp->writeThrough && ejsSaveSession(ejs, sp) < 0) {
         return EJS_ERR;
     }
-    return 0;
+    return slotNum;
 }
 
 
@@ -176,7 +197,11 @@ static int setSessionProperty(Ejs *ejs, EjsSession *sp, int slotNum, EjsAny *val
  */
 void ejsSetSessionTimeout(Ejs *ejs, EjsSession *sp, MprTicks timeout)
 {
-    ejsCacheExpire(ejs, sp->cache, sp->key, ejsCreateDate(ejs, mprGetTime() + timeout));
+    sp->timeout = timeout;
+    sp->options = 0;
+    if (!sp->dirty) {
+        ejsCacheExpire(ejs, sp->cache, sp->key, ejsCreateDate(ejs, mprGetTime() + timeout));
+    }
 }
 
 
@@ -197,6 +222,8 @@ static EjsSession *sess_constructor(Ejs *ejs, EjsSession *sp, int argc, EjsAny *
         vp = ejsGetPropertyByName(ejs, options, EN("lifespan"));
         timeout = ejsGetInt(ejs, vp) * TPS;
     }
+    /* Not owned by a request, so nothing will finalize and save this session */
+    sp->writeThrough = 1;
     return initSession(ejs, sp, sp->key, timeout);
 }
 
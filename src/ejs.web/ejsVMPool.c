@@ -0,0 +1,178 @@
+/**
+    ejsVMPool.c - Script interface to the virtual machine pool.
+
+    Web server hosts allocate a VM per request from an EjsPool. This class exposes the pool limits and statistics
+    so hosts written in script can size and monitor the pool.
+
+    Copyright (c) All Rights Reserved. See details at the end of the file.
+ */
+
+/********************************** Includes **********************************/
+
+#include    "me.h"
+
+#if ME_EJSCRIPT_WEB
+#include    "ejs.h"
+#include    "ejsWeb.h"
+#include    "ejs.web.slots.h"
+
+/************************************ Code ************************************/
+/*
+    function VMPool(max: Number = 0, templateScript: String? = null, startScript: String? = null)
+ */
+static EjsVMPool *vp_constructor(Ejs *ejs, EjsVMPool *vp, int argc, EjsObj **argv)
+{
+    cchar   *templateScript, *startScript;
+    int     max;
+
+    max = (argc >= 1) ? ejsGetInt(ejs, argv[0]) : 0;
+    templateScript = (argc >= 2 && ejsIs(ejs, argv[1], String)) ? ejsToMulti(ejs, argv[1]) : 0;
+    startScript = (argc >= 3 && ejsIs(ejs, argv[2], String)) ? ejsToMulti(ejs, argv[2]) : 0;
+    if ((vp->pool = ejsCreatePool(max, templateScript, startScript, NULL, NULL, NULL)) == 0) {
+        ejsThrowMemoryError(ejs);
+        return 0;
+    }
+    vp->active = mprCreateList(0, 0);
+    return vp;
+}
+
+
+/*
+    function alloc(): Number?
+ */
+static EjsNumber *vp_alloc(Ejs *ejs, EjsVMPool *vp, int argc, EjsObj **argv)
+{
+    Ejs     *vm;
+    int     handle;
+
+    if ((vm = ejsAllocPoolVM(vp->pool, 0)) == 0) {
+        return ESV(null);
+    }
+    for (handle = 0; handle < mprGetListLength(vp->active); handle++) {
+        if (mprGetItem(vp->active, handle) == 0) {
+            mprSetItem(vp->active, handle, vm);
+            return ejsCreateNumber(ejs, handle);
+        }
+    }
+    return ejsCreateNumber(ejs, mprAddItem(vp->active, vm));
+}
+
+
+/*
+    function free(handle: Number): Void
+ */
+static EjsObj *vp_free(Ejs *ejs, EjsVMPool *vp, int argc, EjsObj **argv)
+{
+    Ejs     *vm;
+    int     handle;
+
+    handle = ejsGetInt(ejs, argv[0]);
+    if ((vm = mprGetItem(vp->active, handle)) == 0) {
+        ejsThrowArgError(ejs, "Unknown VM handle %d", handle);
+        return 0;
+    }
+    mprSetItem(vp->active, handle, 0);
+    ejsFreePoolVM(vp->pool, vm);
+    return 0;
+}
+
+
+/*
+    function setLimits(min: Number, max: Number, idle: Number = -1, wait: Number = -1): Void
+ */
+static EjsObj *vp_setLimits(Ejs *ejs, EjsVMPool *vp, int argc, EjsObj **argv)
+{
+    MprTicks    idle, wait;
+
+    idle = (argc >= 3) ? ejsGetInt64(ejs, argv[2]) : -1;
+    wait = (argc >= 4) ? ejsGetInt64(ejs, argv[3]) : -1;
+    if (ejsSetPoolLimits(vp->pool, ejsGetInt(ejs, argv[0]), ejsGetInt(ejs, argv[1]), idle, wait) < 0) {
+        ejsThrowStateError(ejs, "Cannot create pool VMs");
+    }
+    return 0;
+}
+
+
+static void setStat(Ejs *ejs, EjsObj *result, cchar *name, int64 value)
+{
+    ejsSetPropertyByName(ejs, result, EN(name), ejsCreateNumber(ejs, (MprNumber) value));
+}
+
+
+/*
+    function get stats(): Object
+ */
+static EjsObj *vp_stats(Ejs *ejs, EjsVMPool *vp, int argc, EjsObj **argv)
+{
+    EjsPoolStats    stats;
+    EjsObj          *result;
+
+    ejsGetPoolStats(vp->pool, &stats);
+    result = ejsCreateEmptyPot(ejs);
+    setStat(ejs, result, "count", stats.count);
+    setStat(ejs, result, "active", stats.active);
+    setStat(ejs, result, "idle", stats.idle);
+    setStat(ejs, result, "waiting", stats.waiting);
+    setStat(ejs, result, "min", stats.min);
+    setStat(ejs, result, "max", stats.max == MAXINT ? 0 : stats.max);
+    setStat(ejs, result, "peakActive", stats.peakActive);
+    setStat(ejs, result, "allocs", stats.allocs);
+    setStat(ejs, result, "created", stats.created);
+    setStat(ejs, result, "prewarmed", stats.prewarmed);
+    setStat(ejs, result, "reaped", stats.reaped);
+    setStat(ejs, result, "waits", stats.waits);
+    setStat(ejs, result, "timeouts", stats.timeouts);
+    setStat(ejs, result, "totalWait", stats.totalWait);
+    setStat(ejs, result, "maxWait", stats.maxWait);
+    return result;
+}
+
+
+static void manageVMPool(EjsVMPool *vp, int flags)
+{
+    if (flags & MPR_MANAGE_MARK) {
+        ejsManagePot(vp, flags);
+        mprMark(vp->pool);
+        mprMark(vp->active);
+    }
+}
+
+
+void ejsConfigureVMPoolType(Ejs *ejs)
+{
+    EjsType     *type;
+    EjsPot      *prototype;
+
+    if ((type = ejsFinalizeScriptType(ejs, N("ejs.web", "VMPool"), sizeof(EjsVMPool), manageVMPool,
+            EJS_TYPE_POT | EJS_TYPE_MUTABLE_INSTANCES)) == 0) {
+        return;
+    }
+    ejsBindConstructor(ejs, type, vp_constructor);
+    prototype = type->prototype;
+    ejsBindMethod(ejs, prototype, ES_ejs_web_VMPool_alloc, vp_alloc);
+    ejsBindMethod(ejs, prototype, ES_ejs_web_VMPool_free, vp_free);
+    ejsBindMethod(ejs, prototype, ES_ejs_web_VMPool_setLimits, vp_setLimits);
+    ejsBindMethod(ejs, prototype, ES_ejs_web_VMPool_stats, vp_stats);
+}
+#endif
+
+
+/*
+    @copy   default
+
+    Copyright (c) Embedthis Software. All Rights Reserved.
+
+    This software is distributed under commercial and open source licenses.
+    You may use the Embedthis Open Source license or you may acquire a
+    commercial license from Embedthis Software. You agree to be fully bound
+    by the terms of either license. Consult the LICENSE.md distributed with
+    this software for full details and other copyrights.
+
+    Local variables:
+    tab-width: 4
+    c-basic-offset: 4
+    End:
+    vim: sw=4 ts=4 expandtab
+
+    @end
+ */
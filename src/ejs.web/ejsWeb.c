@@ -40,7 +40,9 @@ static int configureWebTypes(Ejs *ejs)
     }
     ejsConfigureHttpServerType(ejs);
     ejsConfigureRequestType(ejs);
+    ejsConfigureRouteIndexType(ejs);
     ejsConfigureSessionType(ejs);
+    ejsConfigureVMPoolType(ejs);
     return 0;
 }
 
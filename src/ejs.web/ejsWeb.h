@@ -150,7 +150,7 @@ extern EjsRequest *ejsCreateRequest(Ejs *ejs, EjsHttpServer *server, HttpConn *c
         that persists beyond a single request.
     @stability Prototype
     @defgroup EjsSession EjsSession
-    @see EjsSession ejsGetSession ejsDestroySession
+    @see EjsSession ejsGetSession ejsDestroySession ejsSaveSession
  */
 typedef struct EjsSession {
     EjsPot      pot;                /* Session properties */
@@ -159,6 +159,8 @@ typedef struct EjsSession {
     EjsObj      *options;           /* Default write options */
     MprTicks    timeout;            /* Session inactivity timeout (msecs) */
     int         ready;              /* Data cached from store into pot */
+    int         dirty;              /* Count of property writes not yet saved to the store */
+    int         writeThrough;       /* Save on every property write (sessions not owned by a request) */
 } EjsSession;
 
 /** 
@@ -180,6 +182,16 @@ extern EjsSession *ejsGetSession(Ejs *ejs, EjsString *key, MprTicks timeout, int
  */
 extern int ejsDestroySession(Ejs *ejs, EjsSession *session);
 
+/** 
+    Save a session. Session property writes are buffered and the session is written back to the cache store once 
+    when the request is finalized. This writes the session if it has unsaved modifications.
+    @param ejs Ejs interpreter handle returned from $ejsCreate
+    @param session Session object created via ejsGetSession()
+    @return Zero if successful or if there was nothing to save. Otherwise a negative MPR error code.
+    @ingroup EjsSession
+ */
+extern int ejsSaveSession(Ejs *ejs, EjsSession *session);
+
 /** 
     Set a session timeout
     @param ejs Ejs interpreter handle returned from $ejsCreate
@@ -189,11 +201,40 @@ extern int ejsDestroySession(Ejs *ejs, EjsSession *session);
 */
 extern void ejsSetSessionTimeout(Ejs *ejs, EjsSession *sp, MprTicks lifespan);
 
+/** 
+    RouteIndex Class. Native prefix tree index of Router string route templates.
+    @description
+        Route templates composed of literal text, "{token}" segments, optional "()" groups and a trailing "/.*" are 
+        compiled into a prefix tree per route set. Requests are matched in one pass over the pathInfo with token values 
+        captured as the tree is descended. Other templates are matched individually by the Router.
+    @stability Internal
+    @defgroup EjsRouteIndex EjsRouteIndex
+    @see EjsRouteIndex
+ */
+typedef struct EjsRouteIndex {
+    EjsPot      pot;                /* Index properties */
+    MprHash     *sets;              /* Prefix tree roots indexed by route set name */
+} EjsRouteIndex;
+
+/** 
+    VMPool Class. Script interface to a pool of virtual machines.
+    @stability Prototype
+    @defgroup EjsVMPool EjsVMPool
+    @see EjsVMPool EjsPool
+ */
+typedef struct EjsVMPool {
+    EjsPot      pot;                /* Pool properties */
+    EjsPool     *pool;              /* Native VM pool */
+    MprList     *active;            /* VMs allocated via alloc() indexed by handle */
+} EjsVMPool;
+
 /******************************* Internal APIs ********************************/
 
 extern void ejsConfigureHttpServerType(Ejs *ejs);
 extern void ejsConfigureRequestType(Ejs *ejs);
+extern void ejsConfigureRouteIndexType(Ejs *ejs);
 extern void ejsConfigureSessionType(Ejs *ejs);
+extern void ejsConfigureVMPoolType(Ejs *ejs);
 extern void ejsConfigureWebTypes(Ejs *ejs);
 extern void ejsSendRequestCloseEvent(Ejs *ejs, EjsRequest *req);
 extern void ejsSendRequestErrorEvent(Ejs *ejs, EjsRequest *req);
@@ -0,0 +1,57 @@
+/*
+    VM pool limits and statistics
+ */
+require ejs.web
+
+//  Limits are read from the ejsrc pool section when the template VM is created
+
+let pool = new VMPool
+let h1 = pool.alloc()
+assert(h1 != null)
+let stats = pool.stats
+assert(stats.min == 1)
+assert(stats.max == 3)
+assert(stats.count == 1 && stats.active == 1)
+
+
+//  The pool does not grow beyond max. With a zero wait timeout, alloc fails immediately.
+
+let h2 = pool.alloc()
+let h3 = pool.alloc()
+assert(h2 != null && h3 != null)
+assert(pool.alloc() == null)
+stats = pool.stats
+assert(stats.count == 3 && stats.active == 3)
+assert(stats.timeouts == 1)
+
+
+//  Idle VMs are pruned down to min. A completed burst does not pre-warm more VMs.
+
+pool.free(h1)
+pool.free(h2)
+pool.free(h3)
+assert(pool.stats.idle == 3)
+App.sleep(6500)
+stats = pool.stats
+assert(stats.count == 1 && stats.idle == 1)
+assert(stats.reaped == 2)
+assert(stats.prewarmed == 0)
+
+
+//  Setting limits creates min VMs immediately. When full, alloc waits for the wait timeout.
+
+pool.setLimits(2, 2, 60000, 300)
+stats = pool.stats
+assert(stats.count == 2 && stats.idle == 2)
+h1 = pool.alloc()
+h2 = pool.alloc()
+let mark = new Date
+assert(pool.alloc() == null)
+assert(mark.elapsed >= 250)
+stats = pool.stats
+assert(stats.waits == 1)
+assert(stats.timeouts == 2)
+assert(stats.maxWait >= 250)
+pool.free(h1)
+pool.free(h2)
+assert(pool.alloc() != null)
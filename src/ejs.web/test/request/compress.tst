@@ -0,0 +1,108 @@
+/*
+    Response compression via the compressFilter
+ */
+require ejs.web
+require ejs.zlib
+
+const HTTP = App.config.uris.http
+
+server = new HttpServer
+server.setPipeline(["chunkFilter", "rangeFilter", "uploadFilter"], ["compressFilter", "rangeFilter", "chunkFilter"], "netConnector")
+server.listen(HTTP)
+load("../utils.es")
+
+let text = ""
+for (i in 200) {
+    text += "The quick brown fox jumps over the lazy dog: " + i + "\n"
+}
+
+server.on("readable", function (event, request: Request) {
+    switch (pathInfo) {
+    case "/text":
+        setHeader("Content-Type", "text/plain")
+        write(text)
+        finalize()
+        break
+
+    case "/small":
+        setHeader("Content-Type", "text/plain")
+        write("Hello World")
+        finalize()
+        break
+
+    case "/binary":
+        setHeader("Content-Type", "image/png")
+        write(text)
+        finalize()
+        break
+
+    case "/stream":
+        setHeader("Content-Type", "text/plain")
+        write(text)
+        flush()
+        write(text)
+        finalize()
+        break
+
+    default:
+        writeError(Http.ServerError, "Bad test URI")
+    }
+})
+
+function get(uri: String, encoding: String? = "gzip"): Http {
+    let http = new Http
+    http.retries = 0
+    if (encoding) {
+        http.setHeader("Accept-Encoding", encoding)
+    }
+    http.get(HTTP + uri)
+    http.wait(30000)
+    assert(http.status == Http.Ok)
+    return http
+}
+
+function body(http: Http): ByteArray {
+    let data = new ByteArray
+    while (http.read(data, -1) > 0) {}
+    return data
+}
+
+function inflate(data: ByteArray): String {
+    let inflate = new Inflate
+    inflate.write(data)
+    inflate.close()
+    let result = new ByteArray
+    inflate.read(result)
+    return result.toString()
+}
+
+//  Complete response is compressed and sent with a Content-Length
+let http = get("/text")
+assert(http.header("Content-Encoding") == "gzip")
+let data = body(http)
+assert(data.length < text.length)
+assert(http.contentLength == data.length)
+assert(inflate(data) == text)
+http.close()
+
+//  Deflate when gzip is not acceptable
+http = get("/text", "deflate, gzip;q=0")
+assert(http.header("Content-Encoding") == "deflate")
+assert(inflate(body(http)) == text)
+http.close()
+
+//  No Accept-Encoding, small responses and binary types are sent as-is
+for each (args in [["/text", null], ["/small", "gzip"], ["/binary", "gzip"]]) {
+    http = get(args[0], args[1])
+    assert(http.header("Content-Encoding") == null)
+    http.close()
+}
+
+//  Streamed response is compressed and chunked
+http = get("/stream")
+assert(http.header("Content-Encoding") == "gzip")
+assert(http.header("Transfer-Encoding") == "chunked")
+assert(inflate(body(http)) == text + text)
+http.close()
+
+server.close()
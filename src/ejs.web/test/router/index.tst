@@ -0,0 +1,116 @@
+/*
+    Router route index. Routes must match in definition order whether they are indexed or matched individually.
+ */
+require ejs.web
+
+const HTTP = App.config.uris.http
+
+load("helper.es")
+server = new HttpServer
+server.listen(HTTP)
+
+server.on("readable", function (event, request: Request) {
+    try {
+        router.route(request)
+    } catch (e) {
+        print(e)
+        finalize()
+        assert(!e)
+    }
+    write(serialize({name: request.route.name, params: request.params}) + "\n")
+    finalize()
+})
+
+function fetch(url: String, method: String): Object {
+    let http = new Http
+    http.connect(method, HTTP + url)
+    http.wait(30000)
+    assert(http.status == Http.Ok)
+    let response = deserialize(http.response)
+    http.close()
+    return response
+}
+
+let router = new Router(null)
+
+
+//  Constrained tokens
+
+router.reset()
+router.add("/item/{id}/edit", {name: "edit", constraints: {id: "[0-9]+"}})
+router.add("/item/{id}", {name: "show", constraints: {id: "[0-9]+"}})
+router.add("/item/{id}", {name: "update", constraints: {id: "[0-9]+"}, method: "PUT"})
+router.add("/item/{action}", {name: "default", method: "*"})
+let response = test("/item/42")
+assert(response.name == "show")
+assert(response.params.id == "42")
+response = test("/item/42/edit")
+assert(response.name == "edit")
+response = test("/item/list")
+assert(response.name == "default")
+assert(response.params.action == "list")
+response = fetch("/item/42", "PUT")
+assert(response.name == "update")
+response = fetch("/item/42", "POST")
+assert(response.name == "default")
+assert(response.params.action == "42")
+
+
+//  Optional groups and trailing wildcard
+
+router.reset()
+router.add("/{controller}(/{action}(/.*))", {name: "default", method: "*"})
+response = test("/blog")
+assert(response.params.controller == "blog")
+assert(response.params.action == "")
+response = test("/blog/list/a/b")
+assert(response.params.controller == "blog")
+assert(response.params.action == "list")
+
+
+//  Earlier regular expression and function routes take precedence over later indexed routes
+
+router.reset()
+router.add(/^\/first\/[0-9]+$/, {name: "regexp", set: "first"})
+router.add("/first/{id}", {name: "token"})
+router.add(function check(request) request.pathInfo == "/first/skip", {name: "function", set: "first"})
+response = test("/first/7")
+assert(response.name == "regexp")
+response = test("/first/seven")
+assert(response.name == "token")
+assert(response.params.id == "seven")
+response = test("/first/skip")
+assert(response.name == "token")
+
+
+//  Later regular expression routes are used when no earlier route matches
+
+router.reset()
+router.add("/{controller}/init", {name: "init"})
+router.add(/\.es$/, {name: "script"})
+response = test("/thing/init")
+assert(response.name == "init")
+response = test("/thing/run.es")
+assert(response.name == "script")
+
+
+//  Templates with other regular expression syntax are still matched by regular expression
+
+router.reset()
+router.add("/[Dd]ash/refresh", {name: "dash", set: "dash"})
+response = test("/dash/refresh")
+assert(response.name == "dash")
+
+
+//  Routes added or removed after routing are used
+
+router.reset()
+router.add("/late", {name: "one"})
+response = test("/late")
+assert(response.name == "one")
+router.remove("late/one")
+router.add("/late", {name: "two"})
+response = test("/late")
+assert(response.name == "two")
+
+server.close()
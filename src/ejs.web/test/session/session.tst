@@ -34,6 +34,28 @@ server.on("readable", function (event, request: Request) {
         finalize()
         break
 
+    case "/many":
+        //  Writes are buffered and the session is saved once when finalized
+        for (i in 10) {
+            session["field" + i] = i
+        }
+        finalize()
+        break
+
+    case "/many-check":
+        for (i in 10) {
+            assert(session["field" + i] == i)
+        }
+        session["field0"] = "updated"
+        finalize()
+        break
+
+    case "/many-updated":
+        assert(session["field0"] == "updated")
+        assert(session["field9"] == 9)
+        finalize()
+        break
+
     case "/destroy":
         assert(sessionID == null)
         createSession()
@@ -64,6 +86,21 @@ do { App.run(10, true) } while(!http.wait())
 assert(http.status == 200)
 http.close()
 
+//  Set many session fields in one request and read them back
+http = fetch(HTTP + "/many")
+assert(http.status == Http.Ok)
+cookie = http.sessionCookie
+http.close()
+
+for each (uri in ["/many-check", "/many-updated"]) {
+    http.setCookie(cookie)
+    http.get(HTTP + uri)
+    http.finalize()
+    do { App.run(10, true) } while(!http.wait())
+    assert(http.status == 200)
+    http.close()
+}
+
 //  destroySession
 http = fetch(HTTP + "/destroy")
 http.close()
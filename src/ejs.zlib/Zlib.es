@@ -25,6 +25,144 @@ module ejs.zlib {
         static native function compressString(data: String): String
         static native function uncompressString(data: String): String
     }
+
+    /**
+        Streaming compressor. Data written to the stream is compressed incrementally and the compressed output may be
+        read as it becomes available. Only the pending output is buffered so large data can be compressed with 
+        bounded memory. A "readable" event is issued when compressed data is available to read. Calling $close 
+        completes the compressed stream after which the remaining output can be read until $read returns null.
+        @spec ejs
+        @stability prototype
+     */
+    final class Deflate implements Stream {
+        use default namespace public
+
+        /** Flush mode to compress without forcing output */
+        static const NONE: Number = 0
+
+        /** Flush mode to emit all pending output aligned to a byte boundary */
+        static const SYNC: Number = 2
+
+        /** Flush mode to emit all pending output and reset the compression state so decompression can restart */
+        static const FULL: Number = 3
+
+        /** Flush mode to complete the compressed stream */
+        static const FINISH: Number = 4
+
+        /**
+            Create a compression stream
+            @param options Compression options
+            @options level Compression level from 0 (none) to 9 (best). Defaults to 6.
+            @options format Output framing. Set to "zlib", "gzip" or "raw". Defaults to "zlib".
+         */
+        native function Deflate(options: Object? = null)
+
+        /** @duplicate Stream.async */
+        native function get async(): Boolean
+
+        /** @duplicate Stream.async */
+        native function set async(enable: Boolean): Void
+
+        /**
+            Number of compressed bytes available to read
+         */
+        native function get available(): Number
+
+        /** 
+            Complete the compressed stream. Further writes are not permitted. Buffered output remains readable.
+         */
+        native function close(): Void
+
+        /**
+            True when the compressed stream has been completed
+         */
+        native function get finished(): Boolean
+
+        /** 
+            @duplicate Stream.flush
+            @param mode Flush mode to use when flushing the write direction. Set to $SYNC, $FULL or $FINISH.
+         */
+        native function flush(dir: Number = Stream.WRITE, mode: Number = SYNC): Void
+
+        /** @duplicate Stream.off */
+        native function off(name, observer: Function): Void
+
+        /** @duplicate Stream.on */
+        native function on(name, observer: Function): Deflate
+
+        /** 
+            @duplicate Stream.read
+            @return The number of bytes read, zero if no compressed data is currently available or null on EOF.
+         */
+        native function read(buffer: ByteArray, offset: Number = 0, count: Number = -1): Number?
+
+        /** 
+            @duplicate Stream.write
+            Data is compressed without forcing output. Use $flush to emit pending output.
+         */
+        native function write(...data): Number
+    }
+
+    /**
+        Streaming decompressor. Compressed data written to the stream is decompressed incrementally and the
+        output may be read as it becomes available. A "readable" event is issued when decompressed data is available.
+        Concatenated gzip members are decompressed in sequence.
+        @spec ejs
+        @stability prototype
+     */
+    final class Inflate implements Stream {
+        use default namespace public
+
+        /**
+            Create a decompression stream
+            @param options Decompression options
+            @options format Input framing. Set to "zlib", "gzip", "raw" or "auto". The "auto" format detects 
+                zlib and gzip framing. Defaults to "auto".
+         */
+        native function Inflate(options: Object? = null)
+
+        /** @duplicate Stream.async */
+        native function get async(): Boolean
+
+        /** @duplicate Stream.async */
+        native function set async(enable: Boolean): Void
+
+        /**
+            Number of decompressed bytes available to read
+         */
+        native function get available(): Number
+
+        /** 
+            Close the stream. Further writes are not permitted. Buffered output remains readable.
+         */
+        native function close(): Void
+
+        /**
+            True when the end of the compressed stream has been reached
+         */
+        native function get finished(): Boolean
+
+        /** @duplicate Stream.flush */
+        native function flush(dir: Number = Stream.WRITE): Void
+
+        /** @duplicate Stream.off */
+        native function off(name, observer: Function): Void
+
+        /** @duplicate Stream.on */
+        native function on(name, observer: Function): Inflate
+
+        /** 
+            @duplicate Stream.read
+            @return The number of bytes read, zero if no decompressed data is currently available or null on EOF.
+         */
+        native function read(buffer: ByteArray, offset: Number = 0, count: Number = -1): Number?
+
+        /** 
+            @duplicate Stream.write
+            @throws IOError if the compressed data is corrupt
+         */
+        native function write(...data): Number
+    }
 }
 
 
@@ -14,6 +14,31 @@
 
 #define     ZBUFSIZE (16 * 1024)
 
+/*
+    Zlib window bits for the supported stream framings
+ */
+#define ZLIB_WBITS_ZLIB     MAX_WBITS
+#define ZLIB_WBITS_GZIP     (MAX_WBITS + 16)
+#define ZLIB_WBITS_RAW      (-MAX_WBITS)
+#define ZLIB_WBITS_AUTO     (MAX_WBITS + 32)
+
+/*
+    Streaming compressor and decompressor. Used for both the Deflate and Inflate classes.
+ */
+typedef struct EjsZlibStream {
+    EjsPot          pot;                /* Extends Object */
+    z_stream        zs;                 /* Zlib stream state */
+    MprBuf          *out;               /* Pending output not yet read */
+    EjsObj          *emitter;           /* Event emitter for listeners */
+    int             async;              /* Async mode */
+    int             closed;             /* Stream closed for writing */
+    int             deflating;          /* Compressing (Deflate) vs decompressing (Inflate) */
+    int             finished;           /* End of the compressed stream reached */
+    int             initialized;        /* Zlib stream state initialized */
+    int             wbits;              /* Zlib window bits defining the framing */
+} EjsZlibStream;
+
+
 /************************************ Code ************************************/
 /*
     compress(src: Path, dest: Path = null)
@@ -194,7 +219,7 @@ static EjsObj *zlib_uncompressBytes(Ejs *ejs, EjsObj *unused, int argc, EjsObj *
         assert(zs.avail_in == 0);
     } while (rc != Z_STREAM_END);
 
-    deflateEnd(&zs);
+    inflateEnd(&zs);
     return (EjsObj*) out;
 }
 
@@ -298,31 +323,399 @@ static EjsString *zlib_uncompressString(Ejs *ejs, EjsObj *unused, int argc, EjsO
         assert(zs.avail_in == 0);
     } while (rc != Z_STREAM_END);
 
-    deflateEnd(&zs);
+    inflateEnd(&zs);
     return ejsCreateStringFromBytes(ejs, mprGetBufStart(out), mprGetBufLength(out));
 }
 
+/********************************** Streams ***********************************/
+
+static int getFormat(Ejs *ejs, EjsObj *options, int deflating)
+{
+    EjsObj      *vp;
+    cchar       *format;
+
+    if (ejsIsDefined(ejs, options) && (vp = ejsGetPropertyByName(ejs, options, EN("format"))) != 0 && 
+            ejsIsDefined(ejs, vp)) {
+        format = ejsToMulti(ejs, vp);
+        if (smatch(format, "zlib")) {
+            return ZLIB_WBITS_ZLIB;
+        } else if (smatch(format, "gzip")) {
+            return ZLIB_WBITS_GZIP;
+        } else if (smatch(format, "raw")) {
+            return ZLIB_WBITS_RAW;
+        } else if (smatch(format, "auto") && !deflating) {
+            return ZLIB_WBITS_AUTO;
+        }
+        ejsThrowArgError(ejs, "Unknown compression format \"%s\"", format);
+        return 0;
+    }
+    return deflating ? ZLIB_WBITS_ZLIB : ZLIB_WBITS_AUTO;
+}
+
+
+/*
+    Run the zlib stream over the given input and append the output to the pending output buffer.
+    The input is always fully consumed unless the end of the compressed stream is reached.
+ */
+static int runStream(Ejs *ejs, EjsZlibStream *zp, cchar *data, ssize len, int flush)
+{
+    z_stream    *zs;
+    ssize       space;
+    int         rc;
+
+    zs = &zp->zs;
+    if (zp->finished && !zp->deflating) {
+        if (len == 0 || (zp->wbits != ZLIB_WBITS_GZIP && zp->wbits != ZLIB_WBITS_AUTO)) {
+            /* Ignore trailing data */
+            return 0;
+        }
+        /* Concatenated gzip member */
+        inflateReset(zs);
+        zp->finished = 0;
+    }
+    zs->next_in = (uchar*) data;
+    zs->avail_in = (uInt) len;
+    do {
+        if (mprGetBufSpace(zp->out) < ZBUFSIZE && mprGrowBuf(zp->out, ZBUFSIZE) < 0) {
+            ejsThrowMemoryError(ejs);
+            return MPR_ERR_MEMORY;
+        }
+        space = mprGetBufSpace(zp->out);
+        zs->next_out = (uchar*) mprGetBufEnd(zp->out);
+        zs->avail_out = (uInt) space;
+        if (zp->deflating) {
+            rc = deflate(zs, flush);
+        } else {
+            rc = inflate(zs, Z_NO_FLUSH);
+        }
+        mprAdjustBufEnd(zp->out, space - zs->avail_out);
+
+        if (rc == Z_STREAM_END) {
+            if (!zp->deflating && zs->avail_in > 0 && (zp->wbits == ZLIB_WBITS_GZIP || zp->wbits == ZLIB_WBITS_AUTO)) {
+                inflateReset(zs);
+                continue;
+            }
+            zp->finished = 1;
+            break;
+        } else if (rc == Z_NEED_DICT || rc == Z_DATA_ERROR || rc == Z_STREAM_ERROR) {
+            ejsThrowIOError(ejs, "Corrupt compressed data: %s", zs->msg ? zs->msg : "bad state");
+            return MPR_ERR_BAD_STATE;
+        } else if (rc == Z_MEM_ERROR) {
+            ejsThrowMemoryError(ejs);
+            return MPR_ERR_MEMORY;
+        } else if (rc == Z_BUF_ERROR && zs->avail_out > 0) {
+            /* No progress possible without more input */
+            break;
+        }
+    } while (zs->avail_out == 0 || zs->avail_in > 0);
+
+    zs->next_in = 0;
+    zs->avail_in = 0;
+    if (zp->emitter && mprGetBufLength(zp->out) > 0 && !ejs->exception) {
+        ejsSendEvent(ejs, zp->emitter, "readable", NULL, zp);
+    }
+    return 0;
+}
+
+
+static EjsZlibStream *initStream(Ejs *ejs, EjsZlibStream *zp, EjsObj *options, int deflating)
+{
+    EjsObj      *vp;
+    int         level, rc;
+
+    zp->deflating = deflating;
+    if ((zp->wbits = getFormat(ejs, options, zp->deflating)) == 0) {
+        return 0;
+    }
+    if ((zp->out = mprCreateBuf(ZBUFSIZE, -1)) == 0) {
+        ejsThrowMemoryError(ejs);
+        return 0;
+    }
+    zp->async = -1;
+    zp->zs.zalloc = Z_NULL;
+    zp->zs.zfree = Z_NULL;
+    zp->zs.opaque = Z_NULL;
+    if (zp->deflating) {
+        level = Z_DEFAULT_COMPRESSION;
+        if (ejsIsDefined(ejs, options) && (vp = ejsGetPropertyByName(ejs, options, EN("level"))) != 0 && 
+                ejsIsDefined(ejs, vp)) {
+            level = ejsGetInt(ejs, vp);
+            if (level < Z_NO_COMPRESSION || level > Z_BEST_COMPRESSION) {
+                ejsThrowArgError(ejs, "Bad compression level %d", level);
+                return 0;
+            }
+        }
+        rc = deflateInit2(&zp->zs, level, Z_DEFLATED, zp->wbits, MAX_MEM_LEVEL - 1, Z_DEFAULT_STRATEGY);
+    } else {
+        rc = inflateInit2(&zp->zs, zp->wbits);
+    }
+    if (rc != Z_OK) {
+        ejsThrowMemoryError(ejs);
+        return 0;
+    }
+    zp->initialized = 1;
+    return zp;
+}
+
+
+/*
+    function Deflate(options: Object? = null)
+ */
+static EjsZlibStream *deflateConstructor(Ejs *ejs, EjsZlibStream *zp, int argc, EjsObj **argv)
+{
+    return initStream(ejs, zp, (argc >= 1) ? argv[0] : 0, 1);
+}
+
+
+/*
+    function Inflate(options: Object? = null)
+ */
+static EjsZlibStream *inflateConstructor(Ejs *ejs, EjsZlibStream *zp, int argc, EjsObj **argv)
+{
+    return initStream(ejs, zp, (argc >= 1) ? argv[0] : 0, 0);
+}
+
+
+/*
+    function get async(): Boolean
+ */
+static EjsBoolean *zstreamAsync(Ejs *ejs, EjsZlibStream *zp, int argc, EjsObj **argv)
+{
+    return zp->async ? ESV(true) : ESV(false);
+}
+
+
+/*
+    function set async(enable: Boolean): Void
+ */
+static EjsObj *zstreamSetAsync(Ejs *ejs, EjsZlibStream *zp, int argc, EjsObj **argv)
+{
+    zp->async = (argv[0] == ESV(true));
+    return 0;
+}
+
+
+/*
+    function get available(): Number
+ */
+static EjsNumber *zstreamAvailable(Ejs *ejs, EjsZlibStream *zp, int argc, EjsObj **argv)
+{
+    return ejsCreateNumber(ejs, (MprNumber) (zp->out ? mprGetBufLength(zp->out) : 0));
+}
+
+
+/*
+    function close(): Void
+ */
+static EjsObj *zstreamClose(Ejs *ejs, EjsZlibStream *zp, int argc, EjsObj **argv)
+{
+    if (zp->closed || !zp->initialized) {
+        return 0;
+    }
+    if (zp->deflating && !zp->finished) {
+        if (runStream(ejs, zp, NULL, 0, Z_FINISH) < 0) {
+            return 0;
+        }
+    }
+    zp->closed = 1;
+    if (zp->emitter) {
+        ejsSendEvent(ejs, zp->emitter, "close", NULL, zp);
+    }
+    return 0;
+}
+
+
+/*
+    function get finished(): Boolean
+ */
+static EjsBoolean *zstreamFinished(Ejs *ejs, EjsZlibStream *zp, int argc, EjsObj **argv)
+{
+    return zp->finished ? ESV(true) : ESV(false);
+}
+
+
+/*
+    Deflate: function flush(dir: Number = Stream.WRITE, mode: Number = SYNC): Void
+    Inflate: function flush(dir: Number = Stream.WRITE): Void
+ */
+static EjsObj *zstreamFlush(Ejs *ejs, EjsZlibStream *zp, int argc, EjsObj **argv)
+{
+    int     dir, mode;
+
+    dir = (argc >= 1) ? ejsGetInt(ejs, argv[0]) : EJS_STREAM_WRITE;
+    mode = (argc >= 2) ? ejsGetInt(ejs, argv[1]) : Z_SYNC_FLUSH;
+
+    if (!zp->initialized) {
+        return 0;
+    }
+    if ((dir & EJS_STREAM_WRITE) && zp->deflating && !zp->finished && !zp->closed) {
+        if (mode != Z_NO_FLUSH && mode != Z_SYNC_FLUSH && mode != Z_FULL_FLUSH && mode != Z_FINISH) {
+            ejsThrowArgError(ejs, "Bad flush mode %d", mode);
+            return 0;
+        }
+        if (runStream(ejs, zp, NULL, 0, mode) < 0) {
+            return 0;
+        }
+    }
+    if (dir & EJS_STREAM_READ) {
+        mprFlushBuf(zp->out);
+    }
+    return 0;
+}
+
+
+/*
+    function off(name, observer: Function): Void
+ */
+static EjsObj *zstreamOff(Ejs *ejs, EjsZlibStream *zp, int argc, EjsAny **argv)
+{
+    ejsRemoveObserver(ejs, zp->emitter, argv[0], argv[1]);
+    return 0;
+}
+
+
+/*
+    function on(name, observer: Function): Deflate
+ */
+static EjsZlibStream *zstreamOn(Ejs *ejs, EjsZlibStream *zp, int argc, EjsAny **argv)
+{
+    ejsAddObserver(ejs, &zp->emitter, argv[0], argv[1]);
+    return zp;
+}
+
+
+/*
+    function read(buffer: ByteArray, offset: Number = 0, count: Number = -1): Number?
+ */
+static EjsNumber *zstreamRead(Ejs *ejs, EjsZlibStream *zp, int argc, EjsObj **argv)
+{
+    EjsByteArray    *buffer;
+    ssize           offset, count, len;
+
+    assert(1 <= argc && argc <= 3);
+
+    buffer = (EjsByteArray*) argv[0];
+    offset = (argc >= 2) ? ejsGetInt(ejs, argv[1]): 0;
+    count = (argc >= 3) ? ejsGetInt(ejs, argv[2]): -1;
+
+    if (!zp->initialized) {
+        ejsThrowStateError(ejs, "Stream not initialized");
+        return 0;
+    }
+    if (offset >= buffer->size && !buffer->resizable) {
+        ejsThrowOutOfBoundsError(ejs, "Bad read offset value");
+        return 0;
+    }
+    if (offset < 0) {
+        offset = buffer->writePosition;
+    } else if (offset == 0) {
+        ejsSetByteArrayPositions(ejs, buffer, 0, 0);
+    }
+    if ((len = mprGetBufLength(zp->out)) == 0) {
+        return (zp->finished || zp->closed) ? ESV(null) : ESV(zero);
+    }
+    if (count < 0 || count > len) {
+        count = len;
+    }
+    if (!buffer->resizable && count > (buffer->size - offset)) {
+        count = buffer->size - offset;
+    }
+    if (ejsCopyToByteArray(ejs, buffer, offset, mprGetBufStart(zp->out), count) != count) {
+        ejsThrowMemoryError(ejs);
+        return 0;
+    }
+    mprAdjustBufStart(zp->out, count);
+    if (mprGetBufLength(zp->out) == 0) {
+        mprFlushBuf(zp->out);
+    }
+    ejsSetByteArrayPositions(ejs, buffer, -1, offset + count);
+    return ejsCreateNumber(ejs, (MprNumber) count);
+}
+
+
+/*
+    function write(...data): Number
+ */
+static EjsNumber *zstreamWrite(Ejs *ejs, EjsZlibStream *zp, int argc, EjsObj **argv)
+{
+    EjsArray        *args;
+    EjsByteArray    *ap;
+    EjsString       *str;
+    EjsObj          *vp;
+    cchar           *buf;
+    ssize           len, written;
+    int             i;
+
+    assert(argc == 1 && ejsIs(ejs, argv[0], Array));
+
+    if (!zp->initialized || zp->closed) {
+        ejsThrowStateError(ejs, "Stream is closed");
+        return 0;
+    }
+    if (zp->deflating && zp->finished) {
+        ejsThrowStateError(ejs, "Compressed stream is finished");
+        return 0;
+    }
+    args = (EjsArray*) argv[0];
+    written = 0;
+
+    for (i = 0; i < args->length; i++) {
+        if ((vp = ejsGetProperty(ejs, (EjsObj*) args, i)) == 0 || ejsIs(ejs, vp, Null)) {
+            continue;
+        }
+        switch (TYPE(vp)->sid) {
+        case S_ByteArray:
+            ap = (EjsByteArray*) vp;
+            buf = (cchar*) &ap->value[ap->readPosition];
+            len = ap->writePosition - ap->readPosition;
+            break;
+
+        case S_String:
+            buf = ejsToMulti(ejs, vp);
+            len = slen(buf);
+            break;
+
+        default:
+            str = ejsToString(ejs, vp);
+            buf = ejsToMulti(ejs, str);
+            len = slen(buf);
+            break;
+        }
+        if (len > 0 && runStream(ejs, zp, buf, len, Z_NO_FLUSH) < 0) {
+            return 0;
+        }
+        written += len;
+    }
+    return ejsCreateNumber(ejs, (MprNumber) written);
+}
+
 /*********************************** Factory *******************************/
 
-#if UNUSED
-static int manageZlib(EjsZlib *db, int flags)
+static int manageZlibStream(EjsZlibStream *zp, int flags)
 {
     if (flags & MPR_MANAGE_MARK) {
-        ejsManagePot(db, flags);
+        ejsManagePot(zp, flags);
+        mprMark(zp->out);
+        mprMark(zp->emitter);
 
     } else if (flags & MPR_MANAGE_FREE) {
-        if (db->sdb) {
-            zlibClose(db->ejs, db, 0, 0);
+        if (zp->initialized) {
+            if (zp->deflating) {
+                deflateEnd(&zp->zs);
+            } else {
+                inflateEnd(&zp->zs);
+            }
+            zp->initialized = 0;
         }
     }
     return 0;
 }
-#endif
 
 
 static int configureZlibTypes(Ejs *ejs)
 {
     EjsType     *type;
+    EjsPot      *prototype;
     
     if ((type = ejsFinalizeScriptType(ejs, N("ejs.zlib", "Zlib"), 0, NULL, 0)) == 0) {
         return 0;
@@ -333,6 +726,38 @@ static int configureZlibTypes(Ejs *ejs)
     ejsBindMethod(ejs, type, ES_ejs_zlib_Zlib_uncompressBytes, zlib_uncompressBytes);
     ejsBindMethod(ejs, type, ES_ejs_zlib_Zlib_compressString, zlib_compressString);
     ejsBindMethod(ejs, type, ES_ejs_zlib_Zlib_uncompressString, zlib_uncompressString);
+
+    if ((type = ejsFinalizeScriptType(ejs, N("ejs.zlib", "Deflate"), sizeof(EjsZlibStream), manageZlibStream,
+            EJS_TYPE_POT)) == 0) {
+        return 0;
+    }
+    prototype = type->prototype;
+    ejsBindConstructor(ejs, type, deflateConstructor);
+    ejsBindAccess(ejs, prototype, ES_ejs_zlib_Deflate_async, zstreamAsync, zstreamSetAsync);
+    ejsBindMethod(ejs, prototype, ES_ejs_zlib_Deflate_available, zstreamAvailable);
+    ejsBindMethod(ejs, prototype, ES_ejs_zlib_Deflate_close, zstreamClose);
+    ejsBindMethod(ejs, prototype, ES_ejs_zlib_Deflate_finished, zstreamFinished);
+    ejsBindMethod(ejs, prototype, ES_ejs_zlib_Deflate_flush, zstreamFlush);
+    ejsBindMethod(ejs, prototype, ES_ejs_zlib_Deflate_off, zstreamOff);
+    ejsBindMethod(ejs, prototype, ES_ejs_zlib_Deflate_on, zstreamOn);
+    ejsBindMethod(ejs, prototype, ES_ejs_zlib_Deflate_read, zstreamRead);
+    ejsBindMethod(ejs, prototype, ES_ejs_zlib_Deflate_write, zstreamWrite);
+
+    if ((type = ejsFinalizeScriptType(ejs, N("ejs.zlib", "Inflate"), sizeof(EjsZlibStream), manageZlibStream,
+            EJS_TYPE_POT)) == 0) {
+        return 0;
+    }
+    prototype = type->prototype;
+    ejsBindConstructor(ejs, type, inflateConstructor);
+    ejsBindAccess(ejs, prototype, ES_ejs_zlib_Inflate_async, zstreamAsync, zstreamSetAsync);
+    ejsBindMethod(ejs, prototype, ES_ejs_zlib_Inflate_available, zstreamAvailable);
+    ejsBindMethod(ejs, prototype, ES_ejs_zlib_Inflate_close, zstreamClose);
+    ejsBindMethod(ejs, prototype, ES_ejs_zlib_Inflate_finished, zstreamFinished);
+    ejsBindMethod(ejs, prototype, ES_ejs_zlib_Inflate_flush, zstreamFlush);
+    ejsBindMethod(ejs, prototype, ES_ejs_zlib_Inflate_off, zstreamOff);
+    ejsBindMethod(ejs, prototype, ES_ejs_zlib_Inflate_on, zstreamOn);
+    ejsBindMethod(ejs, prototype, ES_ejs_zlib_Inflate_read, zstreamRead);
+    ejsBindMethod(ejs, prototype, ES_ejs_zlib_Inflate_write, zstreamWrite);
     return 0;
 }
 
@@ -0,0 +1,126 @@
+/*
+    Test streaming Deflate/Inflate
+ */
+
+require ejs.zlib
+
+function drain(stream: Stream, result: ByteArray): Void {
+    let buf = new ByteArray
+    while (stream.read(buf)) {
+        result.write(buf)
+    }
+}
+
+//  Incremental round trip with bounded chunks
+let orig = Path('orig.dat').readBytes()
+let deflate = new Deflate
+let compressed = new ByteArray
+let chunk = new ByteArray(1000, false)
+while (orig.length > 0) {
+    orig.read(chunk, 0, 1000)
+    deflate.write(chunk)
+    drain(deflate, compressed)
+}
+assert(!deflate.finished)
+deflate.close()
+assert(deflate.finished)
+drain(deflate, compressed)
+assert(deflate.read(new ByteArray) == null)
+assert(Zlib.uncompressBytes(compressed.clone()).toString() == Path('orig.dat').readString())
+
+let inflate = new Inflate
+let result = new ByteArray
+while (compressed.length > 0) {
+    compressed.read(chunk, 0, 1000)
+    inflate.write(chunk)
+    drain(inflate, result)
+}
+assert(inflate.finished)
+assert(result.toString() == Path('orig.dat').readString())
+
+//  Sync flush emits all data written so far
+deflate = new Deflate({level: 9})
+inflate = new Inflate
+deflate.write("Hello ")
+deflate.flush()
+let part = new ByteArray
+drain(deflate, part)
+inflate.write(part)
+assert(inflate.available == 6)
+deflate.write("World")
+deflate.flush(Stream.WRITE, Deflate.FULL)
+part = new ByteArray
+drain(deflate, part)
+inflate.write(part)
+result = new ByteArray
+drain(inflate, result)
+assert(result.toString() == "Hello World")
+
+//  Gzip framing readable by gunzip and auto-detected by Inflate
+deflate = new Deflate({format: "gzip"})
+deflate.write("abc", "def")
+deflate.close()
+let gz = new ByteArray
+drain(deflate, gz)
+assert(gz[0] == 0x1f && gz[1] == 0x8b)
+let path = Path('').temp().joinExt('gz')
+let file = new File(path, "w")
+file.write(gz)
+file.close()
+let plain = Path('').temp()
+Zlib.uncompress(path, plain)
+assert(plain.readString() == "abcdef")
+path.remove()
+plain.remove()
+
+inflate = new Inflate
+inflate.write(gz)
+result = new ByteArray
+drain(inflate, result)
+assert(result.toString() == "abcdef")
+
+//  Concatenated gzip members
+inflate = new Inflate({format: "gzip"})
+inflate.write(gz.clone(), gz.clone())
+result = new ByteArray
+drain(inflate, result)
+assert(result.toString() == "abcdefabcdef")
+
+//  Raw deflate
+deflate = new Deflate({format: "raw"})
+deflate.write("raw data")
+deflate.close()
+part = new ByteArray
+drain(deflate, part)
+inflate = new Inflate({format: "raw"})
+inflate.write(part)
+result = new ByteArray
+drain(inflate, result)
+assert(result.toString() == "raw data")
+
+//  Readable events
+let events = 0
+deflate = new Deflate
+deflate.on("readable", function (event, stream) {
+    events++
+})
+deflate.write("data")
+deflate.close()
+assert(events > 0)
+
+//  Errors
+let caught
+try {
+    new Inflate().write("not compressed data")
+} catch (e) {
+    caught = e
+}
+assert(caught is IOError)
+
+caught = null
+try {
+    deflate.write("more")
+} catch (e) {
+    caught = e
+}
+assert(caught is StateError)
@@ -35,6 +35,9 @@ extern "C" {
 #define EBC_ARGC3           0x80000         /* Argument count * 3 */
 #define EBC_NEW_ARRAY       0x100000        /* New Array: Argument count * 2, byte code */
 #define EBC_NEW_OBJECT      0x200000        /* New Object: Argument count * 3, byte code: attributes * 3 */
+#define EBC_SWITCH_TABLE    0x400000        /* Switch jump table: min, count, 32 bit jumps, 32 bit default */
+#define EBC_SWITCH_LOOKUP   0x800000        /* Switch lookup: count, (string, 32 bit jump) pairs, 32 bit default */
+#define EBC_SITE            0x1000000       /* 32 bit instruction site number for inline caches */
 
 typedef struct EjsOptable {
     char    *name;
@@ -77,7 +80,7 @@ EjsOptable ejsOptable[] = {
     {   "CALL_OBJ_INSTANCE_SLOT",   -1,         { EBC_SLOT, EBC_ARGC,                     },},
     {   "CALL_OBJ_STATIC_SLOT",     -1,         { EBC_SLOT, EBC_NUM, EBC_ARGC,            },},
     {   "CALL_THIS_STATIC_SLOT",     0,         { EBC_SLOT, EBC_NUM, EBC_ARGC,            },},
-    {   "CALL_OBJ_NAME",            -1,         { EBC_STRING, EBC_STRING, EBC_ARGC,       },},
+    {   "CALL_OBJ_NAME",            -1,         { EBC_SITE, EBC_STRING, EBC_STRING, EBC_ARGC, },},
     {   "CALL_SCOPED_NAME",          0,         { EBC_STRING, EBC_STRING, EBC_ARGC,       },},
     {   "CALL_CONSTRUCTOR",          0,         { EBC_ARGC,                               },},
     {   "CALL_NEXT_CONSTRUCTOR",     0,         { EBC_STRING, EBC_STRING, EBC_ARGC,       },},
@@ -139,7 +142,7 @@ EjsOptable ejsOptable[] = {
     {   "LOAD_THIS_BASE",            1,         { EBC_NUM,                                },},
     {   "LOAD_TRUE",                 1,         { EBC_NONE,                               },},
     {   "LOAD_UNDEFINED",            1,         { EBC_NONE,                               },},
-    {   "LOAD_XML",                  1,         { EBC_STRING,                             },},
+    {   "LOAD_XML",                  1,         { EBC_SITE, EBC_STRING,                   },},
     {   "GET_LOCAL_SLOT_0",          1,         { EBC_NONE,                               },},
     {   "GET_LOCAL_SLOT_1",          1,         { EBC_NONE,                               },},
     {   "GET_LOCAL_SLOT_2",          1,         { EBC_NONE,                               },},
@@ -172,7 +175,7 @@ EjsOptable ejsOptable[] = {
     {   "GET_THIS_SLOT_9",           1,         { EBC_NONE,                               },},
     {   "GET_SCOPED_NAME",           1,         { EBC_STRING, EBC_STRING,                 },},
     {   "GET_SCOPED_NAME_EXPR",      -1,        { EBC_NONE,                               },},
-    {   "GET_OBJ_NAME",              0,         { EBC_STRING, EBC_STRING,                 },},
+    {   "GET_OBJ_NAME",              0,         { EBC_SITE, EBC_STRING, EBC_STRING,       },},
     {   "GET_OBJ_NAME_EXPR",        -2,         { EBC_NONE,                               },},
     {   "GET_BLOCK_SLOT",            1,         { EBC_SLOT, EBC_NUM,                      },},
     {   "GET_GLOBAL_SLOT",           1,         { EBC_SLOT,                               },},
@@ -229,7 +232,7 @@ EjsOptable ejsOptable[] = {
     {   "PUT_THIS_SLOT_8",          -1,         { EBC_NONE,                               },},
     {   "PUT_THIS_SLOT_9",          -1,         { EBC_NONE,                               },},
     {   "PUT_OBJ_NAME_EXPR",        -4,         { EBC_NONE,                               },},
-    {   "PUT_OBJ_NAME",             -2,         { EBC_STRING, EBC_STRING,                 },},
+    {   "PUT_OBJ_NAME",             -2,         { EBC_SITE, EBC_STRING, EBC_STRING,       },},
     {   "PUT_SCOPED_NAME",          -1,         { EBC_STRING, EBC_STRING,                 },},
     {   "PUT_SCOPED_NAME_EXPR",     -3,         { EBC_NONE,                               },},
     {   "PUT_BLOCK_SLOT",           -1,         { EBC_SLOT, EBC_NUM,                      },},
@@ -255,12 +258,22 @@ EjsOptable ejsOptable[] = {
     {   "XOR",                      -1,         { EBC_NONE,                               },},
     {   "CALL_FINALLY",              0,         { EBC_NONE,                               },},
     {   "GOTO_FINALLY",              0,         { EBC_NONE,                               },},
+    {   "SWITCH_TABLE",              0,         { EBC_SWITCH_TABLE,                       },},
+    {   "SWITCH_LOOKUP",             0,         { EBC_SITE, EBC_SWITCH_LOOKUP,            },},
+    {   "INC_LOCAL_SLOT",            0,         { EBC_SLOT, EBC_BYTE,                     },},
+    {   "ADD_LOCAL_SLOTS",           1,         { EBC_SLOT, EBC_SLOT,                     },},
     {   0,                           0,         { EBC_NONE,                               },},
 };
 #endif /* EJS_DEFINE_OPTABLE */
 
 PUBLIC EjsOptable *ejsGetOptable();
 
+#if ME_EJS_OP_TRACE
+struct Ejs;
+PUBLIC int ejsTraceOpcode(struct Ejs *ejs, int opcode);
+PUBLIC void ejsShowOpSequences(struct Ejs *ejs);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -123,6 +123,7 @@ typedef struct EcCodeGen {
     MprBuf      *buf;                           /* Code generation buffer */
     MprList     *jumps;                         /* Break/continues to patch for this code block */
     MprList     *exceptions;                    /* Exception handlers for this code block */
+    MprList     *sites;                         /* Offsets of inline cache site operands to number */
     EjsDebug    *debug;                         /* Source debug info */ 
     int         jumpKinds;                      /* Kinds of jumps allowed */
     int         breakMark;                      /* Stack item counter for the target for break/continue stmts */
@@ -130,6 +131,7 @@ typedef struct EcCodeGen {
     int         stackCount;                     /* Current stack item counter */
     int         blockCount;                     /* Current block counter */
     int         lastLineNumber;                 /* Last line for debug */
+    int         incrementEnd;                   /* End offset of a local slot increment that may be fused */
 } EcCodeGen;
 
 
@@ -767,6 +769,8 @@ typedef struct EcCompiler {
     char        *outputDir;                 /* Output directory for modules */
     char        *outputFile;                /* Output module file name override */
     MprFile     *file;                      /* Current output file handle */
+    char        *filePath;                  /* Module file path for the current output file */
+    char        *tempPath;                  /* Temporary path the current output file is written to */
 
     int         modver;                     /* Default module version */
     int         parseOnly;                  /* Only parse the code */
@@ -839,6 +843,7 @@ PUBLIC void         ecSetOutputDir(EcCompiler *cp, cchar *outputDir);
 PUBLIC void         ecSetOutputFile(EcCompiler *cp, cchar *outputFile);
 PUBLIC void         ecSetCertFile(EcCompiler *cp, cchar *certFile);
 PUBLIC EcToken      *ecTakeToken(EcCompiler *cp);
+PUBLIC int          ecAstOptimize(struct EcCompiler *cp);
 PUBLIC int          ecAstProcess(struct EcCompiler *cp);
 PUBLIC void         *ecCreateStream(EcCompiler *cp, ssize size, cchar *filename, void *manager);
 PUBLIC void         ecSetStreamBuf(EcStream *sp, cchar *contents, ssize len);
@@ -878,6 +883,7 @@ PUBLIC void      ecEncodeName(EcCompiler *cp, EjsName qname);
 PUBLIC void      ecEncodeMulti(EcCompiler *cp, cchar *str);
 PUBLIC void      ecEncodeWideAsMulti(EcCompiler *cp, wchar *str);
 PUBLIC void      ecEncodeOpcode(EcCompiler *cp, int value);
+PUBLIC void      ecEncodeSite(EcCompiler *cp);
 
 PUBLIC void     ecCopyCode(EcCompiler *cp, uchar *pos, int size, int dist);
 PUBLIC uint     ecGetCodeOffset(EcCompiler *cp);
@@ -75,6 +75,15 @@ struct HttpWebSocket;
 #ifndef ME_HTTP_WEB_SOCKETS
     #define ME_HTTP_WEB_SOCKETS     1
 #endif
+#ifndef ME_HTTP_COMPRESS
+    #define ME_HTTP_COMPRESS        ME_COM_ZLIB         /**< Enable the response compression filter */
+#endif
+#ifndef ME_HTTP_COMPRESS_LEVEL
+    #define ME_HTTP_COMPRESS_LEVEL  6                   /**< Default response compression level (1-9) */
+#endif
+#ifndef ME_HTTP_COMPRESS_MIN
+    #define ME_HTTP_COMPRESS_MIN    1024                /**< Minimum response size to compress */
+#endif
 #ifndef ME_HTTP_DEFAULT_METHODS
     #define ME_HTTP_DEFAULT_METHODS "GET,POST"          /**< Default methods for routes */
 #endif
@@ -910,6 +919,7 @@ typedef struct Http {
     struct HttpStage *cacheFilter;          /**< Cache filter */
     struct HttpStage *cacheHandler;         /**< Cache filter */
     struct HttpStage *chunkFilter;          /**< Chunked transfer encoding filter */
+    struct HttpStage *compressFilter;       /**< Response compression filter */
     struct HttpStage *cgiHandler;           /**< CGI handler */
     struct HttpStage *cgiConnector;         /**< CGI connector */
     struct HttpStage *clientHandler;        /**< Client-side handler (dummy) */
@@ -2800,6 +2810,7 @@ PUBLIC ssize httpFilterChunkData(HttpQueue *q, HttpPacket *packet);
 PUBLIC int httpOpenActionHandler();
 PUBLIC int httpOpenChunkFilter();
 PUBLIC int httpOpenCacheHandler();
+PUBLIC int httpOpenCompressFilter();
 PUBLIC int httpOpenDirHandler();
 PUBLIC int httpOpenFileHandler();
 PUBLIC int httpOpenPassHandler();
@@ -4488,7 +4499,7 @@ PUBLIC void httpSetStreaming(struct HttpHost *host, cchar *mime, cchar *uri, boo
         httpCreateDefaultRoute httpCreateInheritedRoute httpCreateRoute httpDefineRoute
         httpDefineRouteCondition httpDefineRouteTarget httpDefineRouteUpdate httpFinalizeRoute httpGetRouteData
         httpGetRouteDocuments httpLookupRouteErrorDocument httpMakePath httpResetRoutePipeline
-        httpSetRouteAuth httpSetRouteAutoDelete httpSetRouteConnector httpSetRouteData
+        httpSetRouteAuth httpSetRouteAutoDelete httpSetRouteCompression httpSetRouteConnector httpSetRouteData
         httpSetRouteDefaultLanguage httpSetRouteDocuments httpSetRouteFlags httpSetRouteHandler httpSetRouteHost
         httpSetRouteIndex httpSetRouteMethods httpSetRouteVar httpSetRoutePattern
         httpSetRoutePrefix httpSetRouteScript httpSetRouteSource httpSetRouteTarget httpSetRouteWorkers httpTemplate
@@ -4569,6 +4580,10 @@ typedef struct HttpRoute {
     bool            corsCredentials;        /**< Whether to emit an Access-Control-Allow-Credentials */
     int             corsAge;                /**< Age in seconds of the pre-flight authorization */
 
+    int             compressLevel;          /**< Response compression level */
+    ssize           compressMin;            /**< Minimum response size to compress */
+    MprHash         *compressTypes;         /**< Mime types to compress. Null for the default set */
+
     /*
         Used by Ejscript
      */
@@ -5386,6 +5401,24 @@ PUBLIC void httpSetRouteAutoDelete(HttpRoute *route, bool on);
  */
 PUBLIC void httpSetRouteCompile(HttpRoute *route, bool on);
 
+/**
+    Configure response compression for a route
+    @description This adds the compression filter to the route output pipeline. The filter compresses response
+        content on-the-fly using the gzip or deflate content encoding as negotiated by the client Accept-Encoding
+        header. Responses with a known length less than the minimum size, responses that are already encoded and
+        ranged responses are not compressed. Responses of unknown length are compressed as they are generated and
+        are sent using transfer chunk encoding.
+    @param route Route to modify
+    @param level Compression level from 1 (fastest) to 9 (best). Set to zero for the default level.
+    @param minSize Minimum response size to compress. Set to -1 for the default minimum size.
+    @param types Space or comma separated list of mime types to compress. A type ending with a slash such as
+        "text/" matches all subtypes. Set to null for the default set of textual types.
+    @return "Zero" if successful, otherwise a negative MPR error code.
+    @ingroup HttpRoute
+    @stability Prototype
+ */
+PUBLIC int httpSetRouteCompression(HttpRoute *route, int level, ssize minSize, cchar *types);
+
 /**
     Set the connector to use for a route
     @param route Route to modify
@@ -136,6 +136,9 @@ PUBLIC Http *httpCreate(int flags)
     httpOpenSendConnector();
     httpOpenRangeFilter();
     httpOpenChunkFilter();
+#if ME_HTTP_COMPRESS
+    httpOpenCompressFilter();
+#endif
 #if ME_HTTP_WEB_SOCKETS
     httpOpenWebSockFilter();
 #endif
@@ -2990,6 +2993,421 @@ static void setChunkPrefix(HttpQueue *q, HttpPacket *packet)
 }
 
 
+/*
+    Copyright (c) Embedthis Software. All Rights Reserved.
+    This software is distributed under commercial and open source licenses.
+    You may use the Embedthis Open Source license or you may acquire a
+    commercial license from Embedthis Software. You agree to be fully bound
+    by the terms of either license. Consult the LICENSE.md distributed with
+    this software for full details and other copyrights.
+ */
+
+
+/********* Start of file src/compressFilter.c ************/
+
+/*
+    compressFilter.c - Response compression filter.
+    The compression filter compresses response content on-the-fly using the gzip or deflate content encodings.
+    The encoding is negotiated via the client Accept-Encoding header.
+
+    Copyright (c) All Rights Reserved. See details at the end of the file.
+ */
+
+/********************************* Includes ***********************************/
+
+
+
+#if ME_HTTP_COMPRESS
+#include    "zlib.h"
+
+/********************************** Defines ***********************************/
+
+#define HTTP_COMPRESS_GZIP      1           /* Gzip content encoding */
+#define HTTP_COMPRESS_DEFLATE   2           /* Deflate (zlib) content encoding */
+
+/*
+    Per request compression state
+ */
+typedef struct HttpCompress {
+    z_stream    zs;                         /* Zlib stream state */
+    HttpPacket  *out;                       /* Partially filled output packet */
+    int         encoding;                   /* Negotiated content encoding */
+    int         active;                     /* Compressing the response. Otherwise pass through */
+    int         initialized;                /* Zlib stream state initialized */
+} HttpCompress;
+
+/*
+    Textual types compressed by default
+ */
+static cchar *defaultCompressTypes[] = {
+    "text/", "application/json", "application/javascript", "application/x-javascript", "application/xml",
+    "application/xhtml+xml", "application/rss+xml", "application/atom+xml", "image/svg+xml", 0
+};
+
+/********************************** Forwards **********************************/
+
+static void closeCompress(HttpQueue *q);
+static int compressData(HttpQueue *q, cchar *data, ssize len, int flush, MprList *out);
+static void manageCompress(HttpCompress *cp, int flags);
+static int matchCompress(HttpConn *conn, HttpRoute *route, int dir);
+static bool matchCompressType(HttpRoute *route, cchar *mimeType);
+static int openCompress(HttpQueue *q);
+static void outgoingCompressService(HttpQueue *q);
+static int selectEncoding(cchar *accept);
+static void startCompress(HttpQueue *q);
+
+/*********************************** Code *************************************/
+
+PUBLIC int httpOpenCompressFilter()
+{
+    HttpStage     *filter;
+
+    if ((filter = httpCreateFilter("compressFilter", NULL)) == 0) {
+        return MPR_ERR_CANT_CREATE;
+    }
+    HTTP->compressFilter = filter;
+    filter->match = matchCompress;
+    filter->open = openCompress;
+    filter->close = closeCompress;
+    filter->outgoingService = outgoingCompressService;
+    return 0;
+}
+
+
+static int matchCompress(HttpConn *conn, HttpRoute *route, int dir)
+{
+    HttpRx  *rx;
+
+    rx = conn->rx;
+    if (!(dir & HTTP_STAGE_TX) || !httpServerConn(conn) || conn->upgraded || rx->upgrade) {
+        return HTTP_ROUTE_OMIT_FILTER;
+    }
+    if ((rx->flags & HTTP_HEAD) || conn->tx->outputRanges || selectEncoding(rx->acceptEncoding) == 0) {
+        return HTTP_ROUTE_OMIT_FILTER;
+    }
+    return HTTP_ROUTE_OK;
+}
+
+
+static int openCompress(HttpQueue *q)
+{
+    HttpCompress    *cp;
+
+    if ((cp = mprAllocObj(HttpCompress, manageCompress)) == 0) {
+        return MPR_ERR_MEMORY;
+    }
+    cp->encoding = selectEncoding(q->conn->rx->acceptEncoding);
+    q->queueData = cp;
+    return 0;
+}
+
+
+static void closeCompress(HttpQueue *q)
+{
+    HttpCompress    *cp;
+
+    if ((cp = q->queueData) != 0 && cp->initialized) {
+        deflateEnd(&cp->zs);
+        cp->initialized = 0;
+    }
+}
+
+
+static void manageCompress(HttpCompress *cp, int flags)
+{
+    if (flags & MPR_MANAGE_MARK) {
+        mprMark(cp->out);
+
+    } else if (flags & MPR_MANAGE_FREE) {
+        if (cp->initialized) {
+            deflateEnd(&cp->zs);
+        }
+    }
+}
+
+
+/*
+    Select the preferred content encoding from the Accept-Encoding header. Gzip is preferred over deflate
+    unless the client gives deflate a higher quality value.
+ */
+static int selectEncoding(cchar *accept)
+{
+    char    *item, *params, *cp, *tok;
+    double  quality, gzipQuality, deflateQuality, anyQuality;
+
+    if (accept == 0 || *accept == '\0') {
+        return 0;
+    }
+    gzipQuality = deflateQuality = anyQuality = -1;
+    for (item = stok(sclone(accept), ",", &tok); item; item = stok(0, ",", &tok)) {
+        quality = 1;
+        if ((params = schr(item, ';')) != 0) {
+            *params++ = '\0';
+            if ((cp = scontains(params, "q=")) != 0) {
+                quality = stof(&cp[2]);
+            }
+        }
+        item = strim(item, " \t", MPR_TRIM_BOTH);
+        if (scaselessmatch(item, "gzip") || scaselessmatch(item, "x-gzip")) {
+            gzipQuality = quality;
+        } else if (scaselessmatch(item, "deflate")) {
+            deflateQuality = quality;
+        } else if (smatch(item, "*")) {
+            anyQuality = quality;
+        }
+    }
+    if (gzipQuality < 0) {
+        gzipQuality = anyQuality;
+    }
+    if (deflateQuality < 0) {
+        deflateQuality = anyQuality;
+    }
+    if (gzipQuality > 0 && gzipQuality >= deflateQuality) {
+        return HTTP_COMPRESS_GZIP;
+    } else if (deflateQuality > 0) {
+        return HTTP_COMPRESS_DEFLATE;
+    }
+    return 0;
+}
+
+
+static bool matchCompressType(HttpRoute *route, cchar *mimeType)
+{
+    MprKey      *kp;
+    cchar       **tp;
+    char        *type, *cp;
+
+    if (mimeType == 0 || *mimeType == '\0') {
+        return 0;
+    }
+    type = slower(mimeType);
+    if ((cp = schr(type, ';')) != 0) {
+        *cp = '\0';
+    }
+    type = strim(type, " \t", MPR_TRIM_BOTH);
+    if (route->compressTypes) {
+        for (ITERATE_KEYS(route->compressTypes, kp)) {
+            if (sends(kp->key, "/") ? sstarts(type, kp->key) : smatch(type, kp->key)) {
+                return 1;
+            }
+        }
+    } else {
+        for (tp = defaultCompressTypes; *tp; tp++) {
+            if (sends(*tp, "/") ? sstarts(type, *tp) : smatch(type, *tp)) {
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+
+/*
+    Decide whether to compress the response. This is called on the first service of the queue once the handler
+    has defined the response headers. If the complete response is already queued, the compressed length is known
+    and a Content-Length is emitted. Otherwise the response is compressed as it is generated and transfer chunk
+    encoding is required.
+ */
+static void startCompress(HttpQueue *q)
+{
+    HttpConn        *conn;
+    HttpTx          *tx;
+    HttpRoute       *route;
+    HttpCompress    *cp;
+    HttpPacket      *packet;
+    HttpStage       *stage;
+    MprList         *out;
+    MprOff          length;
+    cchar           *mimeType;
+    bool            complete, chunking;
+    int             next, level, wbits;
+
+    conn = q->conn;
+    tx = conn->tx;
+    route = conn->rx->route;
+    cp = q->queueData;
+
+    if (tx->status < 200 || tx->status >= 300 || tx->status == HTTP_CODE_NO_CONTENT || tx->outputRanges ||
+            (tx->flags & (HTTP_TX_NO_BODY | HTTP_TX_USE_OWN_HEADERS)) || conn->error) {
+        return;
+    }
+    if (conn->headersCallback) {
+        /*
+            Handlers that define headers via a callback (ejs) have not yet added them to tx->headers. The callback
+            is invoked again when the headers are created. An explicit Content-Length would then be restored.
+         */
+        (conn->headersCallback)(conn->headersCallbackArg);
+        if (mprLookupKey(tx->headers, "Content-Length")) {
+            return;
+        }
+    }
+    if (mprLookupKey(tx->headers, "Content-Encoding")) {
+        /* Already encoded. For example: a pre-compressed file */
+        return;
+    }
+    complete = (q->last && (q->last->flags & HTTP_PACKET_END));
+    if (complete) {
+        length = q->count;
+    } else {
+        length = tx->length;
+        chunking = 0;
+        for (ITERATE_ITEMS(tx->outputPipeline, stage, next)) {
+            if (smatch(stage->name, "chunkFilter")) {
+                chunking = 1;
+            }
+        }
+        if (!chunking || tx->chunkSize == 0 || conn->http10) {
+            /* Unknown compressed length cannot be delimited without chunking */
+            return;
+        }
+    }
+    if (length >= 0 && length < route->compressMin) {
+        return;
+    }
+    if ((mimeType = mprLookupKey(tx->headers, "Content-Type")) == 0 && (mimeType = tx->mimeType) == 0 && tx->ext) {
+        mimeType = mprLookupMime(route->mimeTypes, tx->ext);
+    }
+    if (!matchCompressType(route, mimeType)) {
+        return;
+    }
+    level = route->compressLevel > 0 ? route->compressLevel : ME_HTTP_COMPRESS_LEVEL;
+    wbits = (cp->encoding == HTTP_COMPRESS_GZIP) ? MAX_WBITS + 16 : MAX_WBITS;
+    if (deflateInit2(&cp->zs, level, Z_DEFLATED, wbits, MAX_MEM_LEVEL - 1, Z_DEFAULT_STRATEGY) != Z_OK) {
+        return;
+    }
+    cp->initialized = 1;
+    cp->active = 1;
+    httpSetHeaderString(conn, "Content-Encoding", (cp->encoding == HTTP_COMPRESS_GZIP) ? "gzip" : "deflate");
+    httpRemoveHeader(conn, "Content-Length");
+    if (tx->etag) {
+        /* The encoded representation must have a distinct entity tag */
+        tx->etag = sfmt("%s-%s", tx->etag, (cp->encoding == HTTP_COMPRESS_GZIP) ? "gzip" : "deflate");
+    }
+    tx->length = -1;
+    httpTrace(conn, "request.compress", "context", "encoding:'%s',length:%lld",
+        (cp->encoding == HTTP_COMPRESS_GZIP) ? "gzip" : "deflate", length);
+
+    if (complete) {
+        /*
+            Compress the entire response now so the compressed length can be defined in the headers
+         */
+        out = mprCreateList(-1, 0);
+        length = 0;
+        for (packet = httpGetPacket(q); packet; packet = httpGetPacket(q)) {
+            if (packet->flags & HTTP_PACKET_DATA) {
+                if (compressData(q, mprGetBufStart(packet->content), httpGetPacketLength(packet), Z_NO_FLUSH, out) < 0) {
+                    return;
+                }
+            } else {
+                if ((packet->flags & HTTP_PACKET_END) && compressData(q, NULL, 0, Z_FINISH, out) < 0) {
+                    return;
+                }
+                mprAddItem(out, packet);
+            }
+        }
+        for (ITERATE_ITEMS(out, packet, next)) {
+            length += httpGetPacketLength(packet);
+            httpPutForService(q, packet, HTTP_DELAY_SERVICE);
+        }
+        tx->length = length;
+        cp->active = 0;
+    }
+}
+
+
+/*
+    Compress data and emit full output packets. If "out" is supplied, packets are added to the list. Otherwise they
+    are sent downstream.
+ */
+static int compressData(HttpQueue *q, cchar *data, ssize len, int flush, MprList *out)
+{
+    HttpCompress    *cp;
+    z_stream        *zs;
+    MprBuf          *buf;
+    ssize           space;
+    int             rc;
+
+    cp = q->queueData;
+    zs = &cp->zs;
+    zs->next_in = (uchar*) data;
+    zs->avail_in = (uInt) len;
+    do {
+        if (cp->out == 0 && (cp->out = httpCreateDataPacket(q->nextQ->packetSize)) == 0) {
+            return MPR_ERR_MEMORY;
+        }
+        buf = cp->out->content;
+        space = mprGetBufSpace(buf);
+        zs->next_out = (uchar*) mprGetBufEnd(buf);
+        zs->avail_out = (uInt) space;
+        rc = deflate(zs, flush);
+        mprAdjustBufEnd(buf, space - zs->avail_out);
+        if (rc == Z_STREAM_ERROR) {
+            httpError(q->conn, HTTP_ABORT | HTTP_CODE_INTERNAL_SERVER_ERROR, "Cannot compress response");
+            return MPR_ERR_BAD_STATE;
+        }
+        if (mprGetBufSpace(buf) == 0 || (flush != Z_NO_FLUSH && zs->avail_out > 0 && mprGetBufLength(buf) > 0)) {
+            if (out) {
+                mprAddItem(out, cp->out);
+            } else {
+                httpPutPacketToNext(q, cp->out);
+            }
+            cp->out = 0;
+        }
+    } while (zs->avail_in > 0 || zs->avail_out == 0);
+    zs->next_in = 0;
+    return 0;
+}
+
+
+static void outgoingCompressService(HttpQueue *q)
+{
+    HttpCompress    *cp;
+    HttpPacket      *packet;
+    ssize           pending;
+
+    cp = q->queueData;
+    if (!(q->flags & HTTP_QUEUE_SERVICED)) {
+        startCompress(q);
+    }
+    if (!cp->active) {
+        httpDefaultOutgoingServiceStage(q);
+        return;
+    }
+    pending = 0;
+    for (packet = httpGetPacket(q); packet; packet = httpGetPacket(q)) {
+        if (!httpWillNextQueueAcceptPacket(q, packet)) {
+            httpPutBackPacket(q, packet);
+            break;
+        }
+        if (packet->flags & HTTP_PACKET_DATA) {
+            if (packet->esize && packet->fill && (*packet->fill)(q, packet, -1, (ssize) packet->esize) < 0) {
+                return;
+            }
+            if (compressData(q, mprGetBufStart(packet->content), httpGetPacketLength(packet), Z_NO_FLUSH, 0) < 0) {
+                return;
+            }
+            pending++;
+        } else {
+            if (packet->flags & HTTP_PACKET_END) {
+                if (compressData(q, NULL, 0, Z_FINISH, 0) < 0) {
+                    return;
+                }
+                cp->active = 0;
+                pending = 0;
+            }
+            httpPutPacketToNext(q, packet);
+        }
+    }
+    if (pending) {
+        /*
+            Flush compressed output for data written so far so streamed responses are not delayed
+         */
+        compressData(q, NULL, 0, Z_SYNC_FLUSH, 0);
+    }
+}
+
+#endif /* ME_HTTP_COMPRESS */
+
 /*
     Copyright (c) Embedthis Software. All Rights Reserved.
     This software is distributed under commercial and open source licenses.
@@ -4176,12 +4594,40 @@ static void parseCgiPrefix(HttpRoute *route, cchar *key, MprJson *prop)
 }
 
 
+/*
+    compress: true | [extensions] | {
+        precompressed: true | [extensions],
+        dynamic: true,
+        level: 6,
+        minSize: 1024,
+        types: [ 'text/', 'application/json' ],
+    }
+ */
 static void parseCompress(HttpRoute *route, cchar *key, MprJson *prop)
 {
+    MprJson     *pre;
+    cchar       *level, *minSize;
+
     if (smatch(prop->value, "true")) {
         httpAddRouteMapping(route, "", "${1}.gz, min.${1}.gz, min.${1}");
     } else if (prop->type & MPR_JSON_ARRAY) {
         httpAddRouteMapping(route, mprJsonToString(prop, 0), "${1}.gz, min.${1}.gz, min.${1}");
+    } else if (prop->type & MPR_JSON_OBJ) {
+        if ((pre = mprReadJsonObj(prop, "precompressed")) != 0) {
+            if (smatch(pre->value, "true")) {
+                httpAddRouteMapping(route, "", "${1}.gz, min.${1}.gz, min.${1}");
+            } else if (pre->type & MPR_JSON_ARRAY) {
+                httpAddRouteMapping(route, mprJsonToString(pre, 0), "${1}.gz, min.${1}.gz, min.${1}");
+            }
+        }
+        if (smatch(mprReadJson(prop, "dynamic"), "true")) {
+            level = mprReadJson(prop, "level");
+            minSize = mprReadJson(prop, "minSize");
+            if (httpSetRouteCompression(route, level ? (int) stoi(level) : 0, minSize ? (ssize) httpGetNumber(minSize) : -1,
+                    getList(mprReadJsonObj(prop, "types"))) < 0) {
+                httpParseError(route, "Cannot configure response compression");
+            }
+        }
     }
 }
 
@@ -12455,6 +12901,8 @@ PUBLIC HttpRoute *httpCreateRoute(HttpHost *host)
     route->targetRule = sclone("run");
     route->autoDelete = 1;
     route->workers = -1;
+    route->compressLevel = ME_HTTP_COMPRESS_LEVEL;
+    route->compressMin = ME_HTTP_COMPRESS_MIN;
     route->prefix = MPR->emptyString;
     route->trace = http->trace;
 #if DEPRECATE
@@ -12510,6 +12958,9 @@ PUBLIC HttpRoute *httpCreateInheritedRoute(HttpRoute *parent)
     route->autoDelete = parent->autoDelete;
     route->caching = parent->caching;
     route->clientConfig = parent->clientConfig;
+    route->compressLevel = parent->compressLevel;
+    route->compressMin = parent->compressMin;
+    route->compressTypes = parent->compressTypes;
     route->conditions = parent->conditions;
     route->config = parent->config;
     route->connector = parent->connector;
@@ -12580,6 +13031,7 @@ static void manageRoute(HttpRoute *route, int flags)
         mprMark(route->auth);
         mprMark(route->caching);
         mprMark(route->clientConfig);
+        mprMark(route->compressTypes);
         mprMark(route->conditions);
         mprMark(route->config);
         mprMark(route->connector);
@@ -13164,7 +13616,7 @@ PUBLIC int httpAddRouteFilter(HttpRoute *route, cchar *name, cchar *extensions,
 
     assert(route);
 
-    for (ITERATE_ITEMS(route->outputStages, stage, next)) {
+    for (ITERATE_ITEMS((direction & HTTP_STAGE_TX) ? route->outputStages : route->inputStages, stage, next)) {
         if (smatch(stage->name, name)) {
             mprLog("warn http route", 0, "Stage \"%s\" is already configured for the route \"%s\". Ignoring.",
                 name, route->pattern);
@@ -13204,7 +13656,7 @@ PUBLIC int httpAddRouteFilter(HttpRoute *route, cchar *name, cchar *extensions,
     }
     if (direction & HTTP_STAGE_TX && filter->outgoing) {
         GRADUATE_LIST(route, outputStages);
-        if (smatch(name, "cacheFilter") &&
+        if ((smatch(name, "cacheFilter") || smatch(name, "compressFilter")) &&
                 (pos = mprGetListLength(route->outputStages) - 1) >= 0 &&
                 smatch(((HttpStage*) mprGetLastItem(route->outputStages))->name, "chunkFilter")) {
             mprInsertItemAtPos(route->outputStages, pos, filter);
@@ -13584,6 +14036,40 @@ PUBLIC void httpSetRouteRenameUploads(HttpRoute *route, bool enable)
 }
 
 
+PUBLIC int httpSetRouteCompression(HttpRoute *route, int level, ssize minSize, cchar *types)
+{
+    HttpStage   *stage;
+    char        *item, *tok;
+    int         next;
+
+    assert(route);
+
+    if (level < 0 || level > 9) {
+        mprLog("error http route", 0, "Bad compression level %d", level);
+        return MPR_ERR_BAD_ARGS;
+    }
+    route->compressLevel = level ? level : ME_HTTP_COMPRESS_LEVEL;
+    route->compressMin = (minSize >= 0) ? minSize : ME_HTTP_COMPRESS_MIN;
+    if (types && *types) {
+        route->compressTypes = mprCreateHash(0, MPR_HASH_CASELESS | MPR_HASH_STATIC_VALUES | MPR_HASH_STABLE);
+        for (item = stok(sclone(types), " \t,", &tok); item; item = stok(0, " \t,", &tok)) {
+            if (sends(item, "/*")) {
+                item[slen(item) - 1] = '\0';
+            }
+            mprAddKey(route->compressTypes, item, route);
+        }
+    } else {
+        route->compressTypes = 0;
+    }
+    for (ITERATE_ITEMS(route->outputStages, stage, next)) {
+        if (smatch(stage->name, "compressFilter")) {
+            return 0;
+        }
+    }
+    return httpAddRouteFilter(route, "compressFilter", NULL, HTTP_STAGE_TX);
+}
+
+
 PUBLIC int httpSetRouteConnector(HttpRoute *route, cchar *name)
 {
     HttpStage     *stage;
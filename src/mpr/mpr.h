@@ -787,6 +787,16 @@ PUBLIC void mprAtomicAdd64(volatile int64 *target, int64 value);
         #define ME_MPR_ALLOC_QUOTA  (512 * 1024)
     #endif
 #endif
+#ifndef ME_MPR_ALLOC_GROWTH
+    #if ME_TUNE_SIZE
+        #define ME_MPR_ALLOC_GROWTH 25                  /* Percent of live memory to allocate before a GC is worthwhile */
+    #else
+        #define ME_MPR_ALLOC_GROWTH 50
+    #endif
+#endif
+#ifndef ME_MPR_ALLOC_PARALLEL
+    #define ME_MPR_ALLOC_PARALLEL 1                     /* Maximum threads to mark memory in parallel. Experimental */
+#endif
 #ifndef ME_MPR_ALLOC_REGION_SIZE
     #define ME_MPR_ALLOC_REGION_SIZE (256 * 1024)       /* Memory region allocation chunk size */
 #endif
@@ -864,8 +874,9 @@ typedef struct MprMem {
     uchar       free: 1;                /**< Block not in use */
     uchar       first: 1;               /**< Block is first block in region */
     uchar       hasManager: 1;          /**< Has manager function. Set at block init. */
-    uchar       mark: 1;                /**< GC mark indicator. Toggled for each GC pass by mark() when thread yielded. */
     uchar       fullRegion: 1;          /**< Block is an entire region - never on free queues . */
+    uchar       mark;                   /**< GC mark indicator. Toggled for each GC pass by mark() when thread yielded.
+                                             Implemented as a byte so parallel markers can claim blocks atomically */
 
 #if ME_MPR_ALLOC_DEBUG
     /* This increases the size of MprMem from 8 bytes to 16 bytes on 32-bit systems and 24 bytes on 64 bit systems */
@@ -875,8 +886,6 @@ typedef struct MprMem {
 #if ME_64
     uchar       filler[4];
 #endif
-#else
-    uchar       filler[1];
 #endif
 } MprMem;
 
@@ -1039,6 +1048,8 @@ typedef void (*MprMemNotifier)(int cause, int policy, size_t size, size_t total)
  */
 typedef void (*MprManager)(void *ptr, int flags);
 
+#define MPR_GC_PAUSE_BUCKETS  16            /* Number of buckets in the GC pause time histogram */
+
 #if ME_MPR_ALLOC_DEBUG
 /*
     The location stats table tracks the source code location responsible for each allocation
@@ -1080,6 +1091,12 @@ typedef struct MprMemStats {
     uint64          warnHeap;               /**< Warn if heap size exceeds this level */
     uint64          swept;                  /**< Number of blocks swept */
     uint64          sweptBytes;             /**< Number of bytes swept */
+    uint            markers;                /**< Number of threads marking memory in parallel */
+    uint64          pauses;                 /**< Number of GC pauses where all threads were yielded */
+    uint64          pauseMax;               /**< Longest GC pause in microseconds */
+    uint64          pauseTotal;             /**< Total GC pause time in microseconds */
+    uint64          pauseHistogram[MPR_GC_PAUSE_BUCKETS]; /**< Count of GC pauses by duration. Bucket N counts pauses
+                                                 shorter than 2^(N+7) microseconds. The last bucket counts all longer pauses */
 #if ME_MPR_ALLOC_STATS
     /*
         Extended memory stats
@@ -1149,6 +1166,11 @@ typedef struct MprHeap {
     int              hasError;              /**< Memory allocation error */
     int              mark;                  /**< Mark version */
     int              marking;               /**< Actually marking objects now */
+    int              markers;               /**< Number of threads to mark in parallel including the sweeper */
+    volatile int     markActive;            /**< Number of helper markers yet to complete the current mark */
+    MprCond          *markConds[ME_MPR_ALLOC_PARALLEL]; /**< Helper marker wakeup cond vars */
+    MprCond          *markDone;             /**< Signalled as helper markers complete */
+    int              parallel;              /**< Blocks must be claimed atomically when marking */
     int              mustYield;             /**< Threads must yield for GC which is due */
     int              nextSeqno;             /**< Next sequence number */
     int              pageSize;              /**< System page size */
@@ -1159,7 +1181,9 @@ typedef struct MprHeap {
     int              sweeping;              /**< Actually sweeping objects now */
     int              track;                 /**< Track memory allocations (requires ME_MPR_ALLOC_DEBUG) */
     int              verify;                /**< Verify memory contents (very slow) */
+    uint64           workBase;              /**< Minimum work quota regardless of the heap size */
     uint64           workDone;              /**< Count of allocations weighted by block size */
+    int              workGrowth;            /**< Percent of live memory to allocate before GC is worthwhile */
     uint64           workQuota;             /**< Quota of work done before idle GC worthwhile */
 } MprHeap;
 
@@ -1701,13 +1725,17 @@ PUBLIC void mprRemoveRoot(cvoid *ptr);
     #define HINC(field) MPR->heap->stats.field++
 #else
     #define HINC(field)
+#endif
+#if ME_MPR_ALLOC_PARALLEL > 1
+    #define MPR_CLAIM_MARK(mp) (MPR->heap->parallel ? mprClaimMark(mp) : ((mp)->mark = MPR->heap->mark, 1))
+#else
+    #define MPR_CLAIM_MARK(mp) ((mp)->mark = MPR->heap->mark, 1)
 #endif
     #define mprMark(ptr) \
         if (ptr) { \
             MprMem *_mp = MPR_GET_MEM((ptr)); \
             HINC(markVisited); \
-            if (_mp->mark != MPR->heap->mark) { \
-                _mp->mark = MPR->heap->mark; \
+            if (_mp->mark != MPR->heap->mark && MPR_CLAIM_MARK(_mp)) { \
                 if (_mp->hasManager) { \
                     (GET_MANAGER(_mp))((void*) ptr, MPR_MANAGE_MARK); \
                 } \
@@ -1723,6 +1751,7 @@ PUBLIC int  mprCreateGCService(void);
 PUBLIC void mprWakeGCService(void);
 PUBLIC void mprResumeThreads(void);
 PUBLIC int  mprSyncThreads(MprTicks timeout);
+PUBLIC int  mprClaimMark(MprMem *mp);
 
 /********************************** Safe Strings ******************************/
 /**
@@ -131,6 +131,15 @@
 #define YIELDED_THREADS     0x1         /* Resume threads that are yielded (only) */
 #define WAITING_THREADS     0x2         /* Resume threads that are waiting for GC sweep to complete */
 
+/*
+    Parallel marking requires an atomic compare and swap on the MprMem.mark byte
+ */
+#if ME_MPR_ALLOC_PARALLEL > 1 && (ME_COMPILER_HAS_ATOMIC || ME_COMPILER_HAS_SYNC) && !ME_WIN_LIKE
+    #define PARALLEL_MARK   1
+#else
+    #define PARALLEL_MARK   0
+#endif
+
 /********************************** Data **************************************/
 
 #undef              MPR
@@ -160,6 +169,11 @@ static int initQueues(void);
 static void invokeDestructors(void);
 static void markAndSweep(void);
 static void markRoots(void);
+static void markRootList(void);
+#if PARALLEL_MARK
+static void markerThread(MprCond *cond, MprThread *tp);
+#endif
+static uint64 pauseClock(void);
 static int pauseThreads(void);
 static void printMemReport(void);
 static ME_INLINE void release(MprFreeQueue *freeq);
@@ -167,6 +181,8 @@ static void resumeThreads(int flags);
 static ME_INLINE void setbitmap(size_t *bitmap, int bindex);
 static ME_INLINE int sizetoq(size_t size);
 static void dontBusyWait(void);
+static void recordPause(uint64 elapsed);
+static void setWorkQuota(void);
 static void sweep(void);
 static void sweeperThread(void *unused, MprThread *tp);
 static ME_INLINE void triggerGC(int always);
@@ -239,7 +255,8 @@ PUBLIC Mpr *mprCreateMemService(MprManager manager, int flags)
     heap->stats.warnHeap = ((size_t) -1) / 100 * 95;
     heap->stats.cacheHeap = ME_MPR_ALLOC_CACHE;
     heap->stats.lowHeap = max(ME_MPR_ALLOC_CACHE / 8, ME_MPR_ALLOC_REGION_SIZE);
-    heap->workQuota = ME_MPR_ALLOC_QUOTA;
+    heap->workQuota = heap->workBase = ME_MPR_ALLOC_QUOTA;
+    heap->workGrowth = ME_MPR_ALLOC_GROWTH;
     heap->gcEnabled = !(heap->flags & MPR_DISABLE_GC);
 
     /* Internal testing use only */
@@ -271,6 +288,9 @@ PUBLIC Mpr *mprCreateMemService(MprManager manager, int flags)
         heap->regions = region;
     }
     heap->gcCond = mprCreateCond();
+    heap->markDone = mprCreateCond();
+    heap->markers = 1;
+    heap->stats.markers = 1;
 
     heap->roots = mprCreateList(-1, 0/* UNUSED MPR_LIST_STATIC_VALUES */);
     mprAddRoot(MPR);
@@ -926,6 +946,12 @@ static void vmfree(void *ptr, size_t size)
 
 PUBLIC void mprStartGCService()
 {
+#if PARALLEL_MARK
+    MprThread   *tp;
+    MprCond     *cond;
+    int         count;
+#endif
+
     if (heap->gcEnabled) {
         if ((heap->sweeper = mprCreateThread("sweeper", sweeperThread, NULL, 0)) == 0) {
             mprLog("critical mpr memory", 0, "Cannot create sweeper thread");
@@ -933,6 +959,21 @@ PUBLIC void mprStartGCService()
         } else {
             mprStartThread(heap->sweeper);
         }
+#if PARALLEL_MARK
+        /*
+            Helper threads assist the sweeper thread to mark memory. Without them, marking runs on the sweeper alone.
+            This is experimental and is only compiled if ME_MPR_ALLOC_PARALLEL is configured above one.
+         */
+        count = (int) min(heap->stats.cpuCores, ME_MPR_ALLOC_PARALLEL);
+        while (heap->markers < count) {
+            cond = mprCreateCond();
+            if ((tp = mprCreateThread("marker", markerThread, cond, 0)) == 0 || mprStartThread(tp) < 0) {
+                break;
+            }
+            heap->markConds[heap->markers++] = cond;
+        }
+        heap->stats.markers = heap->markers;
+#endif
     }
 }
 
@@ -942,6 +983,9 @@ PUBLIC void mprStopGCService()
     int     i;
 
     mprWakeGCService();
+    for (i = 1; i < heap->markers; i++) {
+        mprSignalCond(heap->markConds[i]);
+    }
     for (i = 0; heap->sweeper && i < MPR_TIMEOUT_STOP; i++) {
         mprNap(1);
     }
@@ -1215,12 +1259,39 @@ static void sweeperThread(void *unused, MprThread *tp)
 }
 
 
+#if PARALLEL_MARK
+/*
+    Helper marker thread. Woken by markRoots to mark a share of the roots while the sweeper marks the rest.
+ */
+static void markerThread(MprCond *cond, MprThread *tp)
+{
+    tp->stickyYield = 1;
+    tp->yielded = 1;
+
+    while (1) {
+        mprWaitForCond(cond, -1);
+        if (heap->parallel) {
+            markRootList();
+            mprAtomicAdd(&heap->markActive, -1);
+            mprSignalCond(heap->markDone);
+        }
+        if (mprIsDestroyed()) {
+            break;
+        }
+    }
+}
+#endif
+
+
 /*
     The mark phase will run with all user threads yielded. The sweep phase then runs in parallel.
     The mark phase is relatively quick.
  */
 static void markAndSweep()
 {
+    uint64      start;
+
+    start = pauseClock();
     if (!pauseThreads()) {
 #if ME_MPR_ALLOC_STATS && ME_MPR_ALLOC_DEBUG && MPR_ALLOC_TRACE
         static int warnOnce = 0;
@@ -1249,7 +1320,9 @@ static void markAndSweep()
      */
     heap->sweeping = 1;
     resumeThreads(YIELDED_THREADS);
+    recordPause(pauseClock() - start);
     sweep();
+    setWorkQuota();
     heap->sweeping = 0;
 
     /*
@@ -1259,26 +1332,139 @@ static void markAndSweep()
 }
 
 
+/*
+    Pace collections by the size of the live heap. Every collection marks the entire heap, so a fixed quota makes the
+    cost of collection grow with the square of the heap size and stalls all threads ever more often as the heap grows.
+    Allocating a proportion of the live heap between collections keeps the marking cost per allocated byte constant.
+    The quota is reduced as the heap approaches the warning or maximum heap limits.
+ */
+static void setWorkQuota()
+{
+    uint64      live, limit, quota;
+
+    live = heap->stats.bytesAllocated - min(heap->stats.bytesFree, heap->stats.bytesAllocated);
+    quota = live / 100 * heap->workGrowth;
+    limit = min(heap->stats.warnHeap, heap->stats.maxHeap);
+    if (live < limit) {
+        quota = min(quota, (limit - live) / 2);
+    } else {
+        quota = 0;
+    }
+    heap->workQuota = max(quota, heap->workBase);
+}
+
+
 static void markRoots()
 {
+    MprList     *roots;
+    int         i;
+
 #if ME_MPR_ALLOC_STATS
     heap->stats.markVisited = 0;
     heap->stats.marked = 0;
 #endif
-    mprMark(heap->roots);
     mprMark(heap->gcCond);
+    mprMark(heap->markDone);
+    for (i = 1; i < heap->markers; i++) {
+        mprMark(heap->markConds[i]);
+    }
+    roots = heap->roots;
+    if (heap->markers <= 1 || roots->length <= 1) {
+        mprMark(roots);
+        return;
+    }
+    /*
+        Mark the roots list itself, but not its items. The helper markers and this thread then mark the roots
+        concurrently. Blocks are claimed atomically so each block (and its manager) is marked by only one thread.
+     */
+    MPR_GET_MEM(roots)->mark = heap->mark;
+    mprMark(roots->mutex);
+    mprMark(roots->items);
 
-#if UNUSED
-    void    *root;
-    int     next;
+    heap->markActive = heap->markers - 1;
+    heap->parallel = 1;
+    for (i = 1; i < heap->markers; i++) {
+        mprSignalCond(heap->markConds[i]);
+    }
+    markRootList();
+    while (heap->markActive > 0) {
+        mprWaitForCond(heap->markDone, 10);
+    }
+    heap->parallel = 0;
+}
+
+
+/*
+    Mark the roots from the most recently added. Work is only shared at root granularity and the earliest root (the MPR)
+    reaches most of the heap, so one marker still does most of the work.
+ */
+static void markRootList()
+{
+    MprList     *roots;
+    int         i;
 
-    for (ITERATE_ITEMS(heap->roots, root, next)) {
-        mprMark(root);
+    roots = heap->roots;
+    for (i = roots->length - 1; i >= 0; i--) {
+        mprMark(roots->items[i]);
     }
+}
+
+
+/*
+    Atomically claim a block for marking by the current thread. Returns true if the block was claimed and must be
+    marked by the caller. Returns false if the block is already marked.
+ */
+PUBLIC int mprClaimMark(MprMem *mp)
+{
+    uchar   mark;
+
+    mark = (uchar) heap->mark;
+#if PARALLEL_MARK && ME_COMPILER_HAS_ATOMIC
+    uchar   expected = !mark;
+    return __atomic_compare_exchange_n(&mp->mark, &expected, mark, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+#elif PARALLEL_MARK
+    return __sync_bool_compare_and_swap(&mp->mark, !mark, mark);
+#else
+    if (mp->mark == mark) {
+        return 0;
+    }
+    mp->mark = mark;
+    return 1;
+#endif
+}
+
+
+/*
+    Return a microsecond clock to time GC pauses
+ */
+static uint64 pauseClock()
+{
+#if ME_UNIX_LIKE && defined(CLOCK_MONOTONIC)
+    struct timespec     tv;
+
+    clock_gettime(CLOCK_MONOTONIC, &tv);
+    return ((uint64) tv.tv_sec) * 1000000 + (tv.tv_nsec / 1000);
+#else
+    return ((uint64) mprGetTicks()) * 1000;
 #endif
 }
 
 
+/*
+    Record the duration of a GC pause in microseconds
+ */
+static void recordPause(uint64 elapsed)
+{
+    int     bucket;
+
+    for (bucket = 0; bucket < (MPR_GC_PAUSE_BUCKETS - 1) && elapsed >= ((uint64) 1 << (bucket + 7)); bucket++) { }
+    heap->stats.pauseHistogram[bucket]++;
+    heap->stats.pauses++;
+    heap->stats.pauseTotal += elapsed;
+    heap->stats.pauseMax = max(heap->stats.pauseMax, elapsed);
+}
+
+
 static void invokeDestructors()
 {
     MprRegion   *region;
@@ -1783,6 +1969,7 @@ static void printMemReport()
 {
     MprMemStats     *ap;
     double          mb;
+    int             i;
 
     ap = mprGetMemStats();
     mb = 1024.0 * 1024;
@@ -1806,6 +1993,24 @@ static void printMemReport()
     printf("  CPU cores       %12d\n", (int) ap->cpuCores);
     printf("\n");
 
+    printf("GC Pauses:\n");
+    printf("  Markers         %12d\n", (int) ap->markers);
+    printf("  Pauses          %12d\n", (int) ap->pauses);
+    if (ap->pauses) {
+        printf("  Pause average   %12.3f msec\n", ap->pauseTotal / 1000.0 / ap->pauses);
+        printf("  Pause max       %12.3f msec\n", ap->pauseMax / 1000.0);
+        for (i = 0; i < MPR_GC_PAUSE_BUCKETS; i++) {
+            if (ap->pauseHistogram[i]) {
+                if (i < (MPR_GC_PAUSE_BUCKETS - 1)) {
+                    printf("  < %8.3f msec %12d\n", (1 << (i + 7)) / 1000.0, (int) ap->pauseHistogram[i]);
+                } else {
+                    printf("  > %8.3f msec %12d\n", (1 << (i + 6)) / 1000.0, (int) ap->pauseHistogram[i]);
+                }
+            }
+        }
+    }
+    printf("\n");
+
 #if ME_MPR_ALLOC_STATS
     printf("Allocator Stats:\n");
     printf("  Memory requests %12d\n",                (int) ap->requests);
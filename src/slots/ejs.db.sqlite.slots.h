@@ -39,26 +39,41 @@
 #define ES_ejs_db_sqlite_Sqlite_connect                                5
 #define ES_ejs_db_sqlite_Sqlite_createDatabase                         6
 #define ES_ejs_db_sqlite_Sqlite_createTable                            7
-#define ES_ejs_db_sqlite_Sqlite_dataTypeToSqlType                      8
-#define ES_ejs_db_sqlite_Sqlite_destroyDatabase                        9
-#define ES_ejs_db_sqlite_Sqlite_destroyTable                           10
-#define ES_ejs_db_sqlite_Sqlite_endTransaction                         11
-#define ES_ejs_db_sqlite_Sqlite_getColumns                             12
-#define ES_ejs_db_sqlite_Sqlite_getNumRows                             13
-#define ES_ejs_db_sqlite_Sqlite_getTables                              14
-#define ES_ejs_db_sqlite_Sqlite_removeColumns                          15
-#define ES_ejs_db_sqlite_Sqlite_removeIndex                            16
-#define ES_ejs_db_sqlite_Sqlite_renameColumn                           17
-#define ES_ejs_db_sqlite_Sqlite_renameTable                            18
-#define ES_ejs_db_sqlite_Sqlite_rollback                               19
-#define ES_ejs_db_sqlite_Sqlite_query                                  20
-#define ES_ejs_db_sqlite_Sqlite_sql                                    21
-#define ES_ejs_db_sqlite_Sqlite_sqlTypeToDataType                      22
-#define ES_ejs_db_sqlite_Sqlite_sqlTypeToEjsType                       23
-#define ES_ejs_db_sqlite_Sqlite_startTransaction                       24
-#define ES_ejs_db_sqlite_Sqlite_NUM_INSTANCE_PROP                      25
+#define ES_ejs_db_sqlite_Sqlite_cursor                                 8
+#define ES_ejs_db_sqlite_Sqlite_dataTypeToSqlType                      9
+#define ES_ejs_db_sqlite_Sqlite_destroyDatabase                        10
+#define ES_ejs_db_sqlite_Sqlite_destroyTable                           11
+#define ES_ejs_db_sqlite_Sqlite_endTransaction                         12
+#define ES_ejs_db_sqlite_Sqlite_getColumns                             13
+#define ES_ejs_db_sqlite_Sqlite_getNumRows                             14
+#define ES_ejs_db_sqlite_Sqlite_getTables                              15
+#define ES_ejs_db_sqlite_Sqlite_removeColumns                          16
+#define ES_ejs_db_sqlite_Sqlite_removeIndex                            17
+#define ES_ejs_db_sqlite_Sqlite_renameColumn                           18
+#define ES_ejs_db_sqlite_Sqlite_renameTable                            19
+#define ES_ejs_db_sqlite_Sqlite_rollback                               20
+#define ES_ejs_db_sqlite_Sqlite_query                                  21
+#define ES_ejs_db_sqlite_Sqlite_sql                                    22
+#define ES_ejs_db_sqlite_Sqlite_sqlTypeToDataType                      23
+#define ES_ejs_db_sqlite_Sqlite_sqlTypeToEjsType                       24
+#define ES_ejs_db_sqlite_Sqlite_startTransaction                       25
+#define ES_ejs_db_sqlite_Sqlite_NUM_INSTANCE_PROP                      26
 #define ES_ejs_db_sqlite_Sqlite_NUM_INHERITED_PROP                     0
 
-#define _ES_CHECKSUM_ejs_db_sqlite   73576
+
+/*
+    Class property slots for the "SqliteCursor" type 
+ */
+#define ES_ejs_db_sqlite_SqliteCursor_NUM_CLASS_PROP                   0
+
+/*
+   Prototype (instance) slots for "SqliteCursor" type 
+ */
+#define ES_ejs_db_sqlite_SqliteCursor_close                            0
+#define ES_ejs_db_sqlite_SqliteCursor_iterator_getValues               1
+#define ES_ejs_db_sqlite_SqliteCursor_NUM_INSTANCE_PROP                2
+#define ES_ejs_db_sqlite_SqliteCursor_NUM_INHERITED_PROP               0
+
+#define _ES_CHECKSUM_ejs_db_sqlite   79235
 
 #endif
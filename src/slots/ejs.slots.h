@@ -235,7 +235,7 @@
 #define ES_encodeURIComponent_str                                      0
 #define ES_encodeObjects_items                                         0
 #define ES_ejs_worker_postMessage_data                                 0
-#define ES_ejs_worker_postMessage_ports                                1
+#define ES_ejs_worker_postMessage_transfer                             1
 
 
 /*
@@ -513,9 +513,10 @@
 #define ES_Cache_readObj                                               6
 #define ES_Cache_remove                                                7
 #define ES_Cache_setLimits                                             8
-#define ES_Cache_write                                                 9
-#define ES_Cache_writeObj                                              10
-#define ES_Cache_NUM_INSTANCE_PROP                                     11
+#define ES_Cache_stats                                                 9
+#define ES_Cache_write                                                 10
+#define ES_Cache_writeObj                                              11
+#define ES_Cache_NUM_INSTANCE_PROP                                     12
 #define ES_Cache_NUM_INHERITED_PROP                                    0
 
 
@@ -1458,8 +1459,9 @@
 #define ES_LocalCache_read                                             4
 #define ES_LocalCache_remove                                           5
 #define ES_LocalCache_setLimits                                        6
-#define ES_LocalCache_write                                            7
-#define ES_LocalCache_NUM_INSTANCE_PROP                                8
+#define ES_LocalCache_stats                                            7
+#define ES_LocalCache_write                                            8
+#define ES_LocalCache_NUM_INSTANCE_PROP                                9
 #define ES_LocalCache_NUM_INHERITED_PROP                               0
 
 
@@ -2427,6 +2429,6 @@
 #define ES_XMLList_NUM_INSTANCE_PROP                                   20
 #define ES_XMLList_NUM_INHERITED_PROP                                  0
 
-#define _ES_CHECKSUM_ejs   1547263
+#define _ES_CHECKSUM_ejs   1548985
 
 #endif
@@ -432,25 +432,30 @@
 #define ES_ejs_web_Router_defaultApp                                   0
 #define ES_ejs_web_Router_routerOptions                                1
 #define ES_ejs_web_Router_routes                                       2
-#define ES_ejs_web_Router_addCatchall                                  3
-#define ES_ejs_web_Router_addDefault                                   4
-#define ES_ejs_web_Router_addHandlers                                  5
-#define ES_ejs_web_Router_addHome                                      6
-#define ES_ejs_web_Router_addResource                                  7
-#define ES_ejs_web_Router_addResources                                 8
-#define ES_ejs_web_Router_addRestful                                   9
-#define ES_ejs_web_Router_insertRoute                                  10
-#define ES_ejs_web_Router_add                                          11
-#define ES_ejs_web_Router_lookup                                       12
-#define ES_ejs_web_Router_remove                                       13
-#define ES_ejs_web_Router_reset                                        14
-#define ES_ejs_web_Router_reroute                                      15
-#define ES_ejs_web_Router_secondStageRoute                             16
-#define ES_ejs_web_Router_route                                        17
-#define ES_ejs_web_Router_setDefaultApp                                18
-#define ES_ejs_web_Router_show                                         19
-#define ES_ejs_web_Router_showRoute                                    20
-#define ES_ejs_web_Router_NUM_INSTANCE_PROP                            21
+#define ES_ejs_web_Router_index                                        3
+#define ES_ejs_web_Router_indexed                                      4
+#define ES_ejs_web_Router_fallbacks                                    5
+#define ES_ejs_web_Router_addCatchall                                  6
+#define ES_ejs_web_Router_addDefault                                   7
+#define ES_ejs_web_Router_addHandlers                                  8
+#define ES_ejs_web_Router_addHome                                      9
+#define ES_ejs_web_Router_addResource                                  10
+#define ES_ejs_web_Router_addResources                                 11
+#define ES_ejs_web_Router_addRestful                                   12
+#define ES_ejs_web_Router_insertRoute                                  13
+#define ES_ejs_web_Router_add                                          14
+#define ES_ejs_web_Router_lookup                                       15
+#define ES_ejs_web_Router_remove                                       16
+#define ES_ejs_web_Router_reset                                        17
+#define ES_ejs_web_Router_buildIndex                                   18
+#define ES_ejs_web_Router_matchSet                                     19
+#define ES_ejs_web_Router_reroute                                      20
+#define ES_ejs_web_Router_secondStageRoute                             21
+#define ES_ejs_web_Router_route                                        22
+#define ES_ejs_web_Router_setDefaultApp                                23
+#define ES_ejs_web_Router_show                                         24
+#define ES_ejs_web_Router_showRoute                                    25
+#define ES_ejs_web_Router_NUM_INSTANCE_PROP                            26
 #define ES_ejs_web_Router_NUM_INHERITED_PROP                           0
 
 /*
@@ -488,23 +493,39 @@
 #define ES_ejs_web_Route_workers                                       16
 #define ES_ejs_web_Route_tokens                                        17
 #define ES_ejs_web_Route_trace                                         18
-#define ES_ejs_web_Route_match                                         19
-#define ES_ejs_web_Route_pattern                                       20
-#define ES_ejs_web_Route_splitter                                      21
-#define ES_ejs_web_Route_getTemplate                                   22
-#define ES_ejs_web_Route_inheritRoutes                                 23
-#define ES_ejs_web_Route_compileTemplate                               24
-#define ES_ejs_web_Route_matchAndSplit                                 25
-#define ES_ejs_web_Route_matchRegExp                                   26
-#define ES_ejs_web_Route_makeParams                                    27
-#define ES_ejs_web_Route_parseOptions                                  28
-#define ES_ejs_web_Route_setName                                       29
-#define ES_ejs_web_Route_setRouteSetName                               30
-#define ES_ejs_web_Route_setRouteProperties                            31
-#define ES_ejs_web_Route_NUM_INSTANCE_PROP                             32
+#define ES_ejs_web_Route_constraints                                   19
+#define ES_ejs_web_Route_match                                         20
+#define ES_ejs_web_Route_order                                         21
+#define ES_ejs_web_Route_pattern                                       22
+#define ES_ejs_web_Route_splitter                                      23
+#define ES_ejs_web_Route_getTemplate                                   24
+#define ES_ejs_web_Route_inheritRoutes                                 25
+#define ES_ejs_web_Route_compileTemplate                               26
+#define ES_ejs_web_Route_matchAndSplit                                 27
+#define ES_ejs_web_Route_matchRegExp                                   28
+#define ES_ejs_web_Route_makeParams                                    29
+#define ES_ejs_web_Route_parseOptions                                  30
+#define ES_ejs_web_Route_setName                                       31
+#define ES_ejs_web_Route_setRouteSetName                               32
+#define ES_ejs_web_Route_setRouteProperties                            33
+#define ES_ejs_web_Route_NUM_INSTANCE_PROP                             34
 #define ES_ejs_web_Route_NUM_INHERITED_PROP                            0
 
 
+/*
+    Class property slots for the "RouteIndex" type 
+ */
+#define ES_ejs_web_RouteIndex_NUM_CLASS_PROP                           0
+
+/*
+   Prototype (instance) slots for "RouteIndex" type 
+ */
+#define ES_ejs_web_RouteIndex_add                                      0
+#define ES_ejs_web_RouteIndex_lookup                                   1
+#define ES_ejs_web_RouteIndex_NUM_INSTANCE_PROP                        2
+#define ES_ejs_web_RouteIndex_NUM_INHERITED_PROP                       0
+
+
 /*
     Class property slots for the "Session" type 
  */
@@ -542,6 +563,22 @@
 #define ES_ejs_web_UploadFile_NUM_INHERITED_PROP                       0
 
 
+/*
+    Class property slots for the "VMPool" type 
+ */
+#define ES_ejs_web_VMPool_NUM_CLASS_PROP                               0
+
+/*
+   Prototype (instance) slots for "VMPool" type 
+ */
+#define ES_ejs_web_VMPool_alloc                                        0
+#define ES_ejs_web_VMPool_free                                         1
+#define ES_ejs_web_VMPool_setLimits                                    2
+#define ES_ejs_web_VMPool_stats                                        3
+#define ES_ejs_web_VMPool_NUM_INSTANCE_PROP                            4
+#define ES_ejs_web_VMPool_NUM_INHERITED_PROP                           0
+
+
 /*
     Class property slots for the "View" type 
  */
@@ -619,6 +656,6 @@
 #define ES_ejs_web_View_plainFormatter_value                           1
 #define ES_ejs_web_View_plainFormatter_options                         2
 
-#define _ES_CHECKSUM_ejs_web   834053
+#define _ES_CHECKSUM_ejs_web   860094
 
 #endif
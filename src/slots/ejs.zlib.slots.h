@@ -48,6 +48,53 @@
 #define ES_ejs_zlib_Zlib_compressString_data                           0
 #define ES_ejs_zlib_Zlib_uncompressString_data                         0
 
-#define _ES_CHECKSUM_ejs_zlib   14504
+
+/*
+    Class property slots for the "Deflate" type 
+ */
+#define ES_ejs_zlib_Deflate__initializer___Deflate_                    0
+#define ES_ejs_zlib_Deflate_NONE                                       1
+#define ES_ejs_zlib_Deflate_SYNC                                       2
+#define ES_ejs_zlib_Deflate_FULL                                       3
+#define ES_ejs_zlib_Deflate_FINISH                                     4
+#define ES_ejs_zlib_Deflate_NUM_CLASS_PROP                             5
+
+/*
+   Prototype (instance) slots for "Deflate" type 
+ */
+#define ES_ejs_zlib_Deflate_async                                      0
+#define ES_ejs_zlib_Deflate_available                                  1
+#define ES_ejs_zlib_Deflate_close                                      2
+#define ES_ejs_zlib_Deflate_finished                                   3
+#define ES_ejs_zlib_Deflate_flush                                      4
+#define ES_ejs_zlib_Deflate_off                                        5
+#define ES_ejs_zlib_Deflate_on                                         6
+#define ES_ejs_zlib_Deflate_read                                       7
+#define ES_ejs_zlib_Deflate_write                                      8
+#define ES_ejs_zlib_Deflate_NUM_INSTANCE_PROP                          9
+#define ES_ejs_zlib_Deflate_NUM_INHERITED_PROP                         0
+
+
+/*
+    Class property slots for the "Inflate" type 
+ */
+#define ES_ejs_zlib_Inflate_NUM_CLASS_PROP                             0
+
+/*
+   Prototype (instance) slots for "Inflate" type 
+ */
+#define ES_ejs_zlib_Inflate_async                                      0
+#define ES_ejs_zlib_Inflate_available                                  1
+#define ES_ejs_zlib_Inflate_close                                      2
+#define ES_ejs_zlib_Inflate_finished                                   3
+#define ES_ejs_zlib_Inflate_flush                                      4
+#define ES_ejs_zlib_Inflate_off                                        5
+#define ES_ejs_zlib_Inflate_on                                         6
+#define ES_ejs_zlib_Inflate_read                                       7
+#define ES_ejs_zlib_Inflate_write                                      8
+#define ES_ejs_zlib_Inflate_NUM_INSTANCE_PROP                          9
+#define ES_ejs_zlib_Inflate_NUM_INHERITED_PROP                         0
+
+#define _ES_CHECKSUM_ejs_zlib   43881
 
 #endif
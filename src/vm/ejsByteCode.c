@@ -18,6 +18,130 @@ PUBLIC EjsOptable *ejsGetOptable()
 }
 
 
+#if ME_EJS_OP_TRACE
+/*
+    Opcode sequence tracing. Counts the opcode pairs and triples executed by the VM so that superinstructions can be
+    chosen from real workloads. Enable by building with ME_EJS_OP_TRACE. The report is emitted when the VM is destroyed.
+    Counts are global and not locked. Only use for profiling.
+ */
+#define EJS_TRACE_HASH      (256 * 256)         /* Triple hash table size. Must be at least the pair table size */
+#define EJS_TRACE_TOP       24                  /* Number of sequences to report */
+
+typedef struct EjsTraceEntry {
+    int         key;
+    uint64      count;
+} EjsTraceEntry;
+
+static uint64 opSingles[256];
+static uint64 opPairs[256 * 256];
+static EjsTraceEntry opTriples[EJS_TRACE_HASH];
+static int opHistory = -1;
+static int opTripleCount = 0;
+
+PUBLIC int ejsTraceOpcode(Ejs *ejs, int opcode)
+{
+    EjsTraceEntry   *ep;
+    int             key, index;
+
+    opSingles[opcode]++;
+    if (opHistory >= 0) {
+        opPairs[((opHistory & 0xFF) << 8) | opcode]++;
+        if (opHistory > 0xFF) {
+            key = ((opHistory & 0xFFFF) << 8) | opcode;
+            for (index = (key * 2654435761U) & (EJS_TRACE_HASH - 1); ; index = (index + 1) & (EJS_TRACE_HASH - 1)) {
+                ep = &opTriples[index];
+                if (ep->key == key && ep->count) {
+                    ep->count++;
+                    break;
+                } else if (ep->count == 0) {
+                    if (opTripleCount < EJS_TRACE_HASH / 2) {
+                        ep->key = key;
+                        ep->count = 1;
+                        opTripleCount++;
+                    }
+                    break;
+                }
+            }
+        }
+    }
+    opHistory = (opHistory < 0) ? opcode : (((opHistory & 0xFF) << 8) | opcode);
+    return opcode;
+}
+
+
+static void showTop(cchar *title, uint64 *counts, int *keys, int size, int width)
+{
+    EjsOptable  *optable;
+    MprBuf      *buf;
+    uint64      total, best;
+    int         i, j, n, found;
+
+    optable = ejsGetOptable();
+    for (total = 0, i = 0; i < size; i++) {
+        total += counts[i];
+    }
+    if (total == 0) {
+        return;
+    }
+    mprEprintf("\n%s (%Ld total)\n", title, total);
+    for (n = 0; n < EJS_TRACE_TOP; n++) {
+        found = -1;
+        best = 0;
+        for (i = 0; i < size; i++) {
+            if (counts[i] > best) {
+                best = counts[i];
+                found = i;
+            }
+        }
+        if (found < 0) {
+            break;
+        }
+        buf = mprCreateBuf(0, 0);
+        for (j = width - 1; j >= 0; j--) {
+            mprPutToBuf(buf, "%s%s", optable[(keys[found] >> (j * 8)) & 0xFF].name, j ? " " : "");
+        }
+        mprAddNullToBuf(buf);
+        mprEprintf("%12Ld %5.2f%%  %s\n", best, best * 100.0 / total, mprGetBufStart(buf));
+        counts[found] = 0;
+    }
+}
+
+
+PUBLIC void ejsShowOpSequences(Ejs *ejs)
+{
+    uint64  *counts;
+    int     *keys, i;
+
+    counts = mprAlloc(sizeof(uint64) * EJS_TRACE_HASH);
+    keys = mprAlloc(sizeof(int) * EJS_TRACE_HASH);
+
+    for (i = 0; i < 256; i++) {
+        counts[i] = opSingles[i];
+        keys[i] = i;
+    }
+    showTop("Opcodes", counts, keys, 256, 1);
+
+    for (i = 0; i < 256 * 256; i++) {
+        counts[i] = opPairs[i];
+        keys[i] = i;
+    }
+    showTop("Opcode pairs", counts, keys, 256 * 256, 2);
+
+    for (i = 0; i < EJS_TRACE_HASH; i++) {
+        counts[i] = opTriples[i].count;
+        keys[i] = opTriples[i].key;
+    }
+    showTop("Opcode triples", counts, keys, EJS_TRACE_HASH, 3);
+
+    memset(opSingles, 0, sizeof(opSingles));
+    memset(opPairs, 0, sizeof(opPairs));
+    memset(opTriples, 0, sizeof(opTriples));
+    opTripleCount = 0;
+    opHistory = -1;
+}
+#endif /* ME_EJS_OP_TRACE */
+
+
 /*
     @copy   default
 
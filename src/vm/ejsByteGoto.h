@@ -207,4 +207,8 @@ static void *opcodeJump[] = {
     &&EJS_OP_XOR,
     &&EJS_OP_CALL_FINALLY,
     &&EJS_OP_GOTO_FINALLY,
+    &&EJS_OP_SWITCH_TABLE,
+    &&EJS_OP_SWITCH_LOOKUP,
+    &&EJS_OP_INC_LOCAL_SLOT,
+    &&EJS_OP_ADD_LOCAL_SLOTS,
 };
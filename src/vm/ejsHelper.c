@@ -115,6 +115,7 @@ int ejsDefineProperty(Ejs *ejs, EjsAny *vp, int slotNum, EjsName name, EjsType *
     assert(name.name);
     assert(name.space);
 
+    ejsInternName(name);
     return (TYPE(vp)->helpers.defineProperty)(ejs, vp, slotNum, name, propType, attributes, value);
 }
 
@@ -147,6 +148,7 @@ int ejsDeletePropertyByName(Ejs *ejs, EjsAny *vp, EjsName qname)
     assert(qname.name);
     assert(qname.space);
     
+    ejsInternName(qname);
     if (TYPE(vp)->helpers.deletePropertyByName) {
         return (TYPE(vp)->helpers.deletePropertyByName)(ejs, vp, qname);
     } else {
@@ -186,6 +188,7 @@ void *ejsGetPropertyByName(Ejs *ejs, EjsAny *vp, EjsName name)
     assert(vp);
 
     type = TYPE(vp);
+    ejsInternName(name);
 
     /*
         WARNING: this is not implemented by most types
@@ -261,6 +264,7 @@ int ejsLookupProperty(Ejs *ejs, EjsAny *vp, EjsName name)
     assert(vp);
     assert(name.name);
 
+    ejsInternName(name);
     assert(TYPE(vp)->helpers.lookupProperty);
     return (TYPE(vp)->helpers.lookupProperty)(ejs, vp, name);
 }
@@ -302,6 +306,8 @@ int ejsSetPropertyByName(Ejs *ejs, EjsAny *vp, EjsName qname, EjsAny *value)
     assert(ejs);
     assert(vp);
 
+    ejsInternName(qname);
+
     /*
         WARNING: Not all types implement this
      */
@@ -339,6 +345,7 @@ int ejsSetPropertyByName(Ejs *ejs, EjsAny *vp, EjsName qname, EjsAny *value)
 int ejsSetPropertyName(Ejs *ejs, EjsAny *vp, int slot, EjsName qname)
 {
     assert(TYPE(vp)->helpers.setPropertyName);
+    ejsInternName(qname);
     return (TYPE(vp)->helpers.setPropertyName)(ejs, vp, slot, qname);
 }
 
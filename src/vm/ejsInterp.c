@@ -132,12 +132,13 @@ static ME_INLINE void checkGetter(Ejs *ejs, EjsAny *value, EjsAny *thisObj, EjsA
 #define GET_WORD()      ejsDecodeInt32(ejs, &(FRAME)->pc)
 #undef THIS
 #define THIS            FRAME->function.boundThis
-#define FILL(mark)      while (mark < FRAME->pc) { *mark++ = EJS_OP_NOP; }
 
 // #define DEBUG_IDE 1
 #if DEBUG_IDE
     static EjsOpCode traceCode(Ejs *ejs, EjsOpCode opcode);
     static int opcount[256];
+#elif ME_EJS_OP_TRACE
+    #define traceCode(ejs, opcode) ejsTraceOpcode(ejs, opcode)
 #else
     #define traceCode(ejs, opcode) opcode
 #endif
@@ -155,12 +156,14 @@ static ME_INLINE void checkGetter(Ejs *ejs, EjsAny *value, EjsAny *thisObj, EjsA
 
 /******************************** Forward Declarations ************************/
 
+static void cacheProperty(Ejs *ejs, EjsCode *code, int site, EjsAny *obj, EjsAny *holder, int slotNum, int byName);
 static void callInterfaceInitializers(Ejs *ejs, EjsType *type);
 static void callProperty(Ejs *ejs, EjsAny *obj, int slotNum, EjsAny *thisObj, int argc, int stackAdjust);
 static void checkExceptionHandlers(Ejs *ejs);
 static void createExceptionBlock(Ejs *ejs, EjsEx *ex, int flags);
 static EjsAny *evalBinaryExpr(Ejs *ejs, EjsAny *lhs, EjsOpCode opcode, EjsAny *rhs);
 static uint findEndException(Ejs *ejs);
+static EjsInlineEntry *findInlineEntry(Ejs *ejs, EjsCode *code, int site, EjsAny *obj);
 static EjsEx *findExceptionHandler(Ejs *ejs, int kind);
 static EjsName getNameArg(Ejs *ejs, EjsFrame *fp);
 static EjsAny *getNthBase(Ejs *ejs, EjsAny *obj, int nthBase);
@@ -169,9 +172,12 @@ static EjsAny *getNthBlock(Ejs *ejs, int nth);
 static EjsString *getString(Ejs *ejs, EjsFrame *fp, int num);
 static EjsString *getStringArg(Ejs *ejs, EjsFrame *fp);
 static EjsObj *getGlobalArg(Ejs *ejs, EjsFrame *fp);
+static EjsSwitch *getSwitch(Ejs *ejs, EjsFrame *fp, int site);
+static EjsXML *loadXmlLiteral(Ejs *ejs, EjsFrame *fp, int site);
+static int lookupSwitch(EjsSwitch *sw, EjsString *value);
 static EjsBlock *popExceptionBlock(Ejs *ejs);
 static bool processException(Ejs *ejs);
-static void storeProperty(Ejs *ejs, EjsObj *thisObj, EjsAny *obj, EjsName name, EjsObj *value);
+static int storeProperty(Ejs *ejs, EjsObj *thisObj, EjsAny *obj, EjsName name, EjsObj *value);
 static void storePropertyToSlot(Ejs *ejs, EjsObj *thisObj, EjsAny *obj, int slotNum, EjsObj *value);
 static void storePropertyToScope(Ejs *ejs, EjsName qname, EjsObj *value);
 static void throwNull(Ejs *ejs);
@@ -198,7 +204,10 @@ static void VM(Ejs *ejs, EjsFunction *fun, EjsAny *otherThis, int argc, int stac
     EjsFunction *f1, *f2;
     EjsNamespace *nsp;
     EjsString   *str;
-    int         i, offset, count, opcode, attributes, paused;
+    EjsCode     *code;
+    EjsInlineEntry *entry;
+    EjsTrait    *trait;
+    int         i, offset, count, opcode, attributes, paused, site;
 
 #if ME_UNIX_LIKE || (VXWORKS && !ME_DIAB)
     /*
@@ -424,14 +433,13 @@ static void VM(Ejs *ejs, EjsFunction *fun, EjsAny *otherThis, int argc, int stac
 
         /*
             Load an XML constant
-                LoadXML             <xmlString>
+                LoadXML             <site.32> <xmlString>
                 Stack before (top)  []
                 Stack after         [XML]
          */
         CASE (EJS_OP_LOAD_XML):
-            v1 = ejsCreateObj(ejs, EST(XML), 0);
-            str = GET_STRING();
-            ejsLoadXMLString(ejs, (EjsXML*) v1, str);
+            site = GET_WORD();
+            v1 = (EjsObj*) loadXmlLiteral(ejs, FRAME, site);
             push(v1);
             BREAK;
 
@@ -691,6 +699,7 @@ static void VM(Ejs *ejs, EjsFunction *fun, EjsAny *otherThis, int argc, int stac
          */
         CASE (EJS_OP_GET_SCOPED_NAME_EXPR):
             qname.name = ejsToString(ejs, pop(ejs));
+            ejsInternName(qname);
             v1 = pop(ejs);
             if (ejsIs(ejs, v1, Namespace)) {
                 qname.space = ((EjsNamespace*) v1)->value;
@@ -703,126 +712,34 @@ static void VM(Ejs *ejs, EjsFunction *fun, EjsAny *otherThis, int argc, int stac
             } else {
                 CHECK_VALUE(vp, NULL, lookup.obj, lookup.slotNum);
             }
-#if DYNAMIC_BINDING
-            if (ejs->flags & EJS_FLAG_COMPILER || TYPE(lookup.obj) == EST(Object) || lookup.slotNum >= 4096) {
-                BREAK;
-            }
-            if (lookup.obj == ejs->global) {
-                *mark++ = EJS_OP_GET_GLOBAL_SLOT;
-                mark += ejsEncodeUint(mark, lookup.slotNum);
-
-            } else if (lookup->obj == state->fp) {
-                *mark++ = EJS_OP_GET_LOCAL_SLOT;
-                mark += ejsEncodeUint(mark, lookup.slotNum);
-
-            } else if (lookup->obj == state->fp->thisObj) {
-                *mark++ = EJS_OP_GET_THIS_SLOT;
-                mark += ejsEncodeUint(mark, lookup.slotNum);
-
-            } else if (ejsIsA(ejs, THIS, (EjsType*) lookup.obj)) {
-                *mark++ = EJS_OP_GET_BLOCK_SLOT;
-                mark += ejsEncodeUint(mark, lookup.slotNum);
-                mark += ejsEncodeUint(mark, lookup.nthBlock);
-
-            } else {
-                BREAK;
-            }
-            FILL(mark);
-#endif
             BREAK;
 
         /*
             Load a property by property name
-                GetObjName          <qname>
+                GetObjName          <site.32> <qname>
                 Stack before (top)  [obj]
                 Stack after         [result]
          */
         CASE (EJS_OP_GET_OBJ_NAME):
-#if DYNAMIC_BINDING
-            mark = FRAME->pc - 1;
-#endif
+            site = GET_WORD();
+            code = FRAME->function.body.code;
             qname = GET_NAME();
             vp = pop(ejs);
             if (vp == ESV(null) || vp == ESV(undefined)) {
                 ejsThrowReferenceError(ejs, "Object reference is null");
                 BREAK;
             }
-            v1 = ejsGetVarByName(ejs, vp, qname, &lookup);
-            CHECK_VALUE(v1, vp, lookup.obj, lookup.slotNum);
-#if DYNAMIC_BINDING
-            if (lookup.slotNum < 0 || lookup.slotNum > 4096 || ejs->flags & EJS_FLAG_COMPILER) {
-                BREAK;
-            }
-            if (lookup.obj == ejs->global) {
-                *mark++ = EJS_OP_GET_GLOBAL_SLOT;
-                mark += ejsEncodeUint(mark, lookup.slotNum);
-
-            } else if (lookup.obj == (EjsObj*) state.fp) {
-                *mark++ = EJS_OP_GET_LOCAL_SLOT;
-                mark += ejsEncodeUint(mark, lookup.slotNum);
-
-            } else if (lookup.obj == state.fp->thisObj) {
-                *mark++ = EJS_OP_GET_THIS_SLOT;
-                mark += ejsEncodeUint(mark, lookup.slotNum);
-
-            } else if (ejsIsType(ejs, lookup.obj) && ejsIsA(ejs, THIS, (EjsType*) lookup.obj)) {
-                *mark++ = EJS_OP_GET_TYPE_SLOT;
-                mark += ejsEncodeUint(mark, lookup.slotNum);
-                mark += ejsEncodeUint(mark, lookup.nthBlock + 1);
-
-            } else if ((EjsObj*) TYPE(vp) == lookup.obj) {
-                *mark++  = EJS_OP_GET_TYPE_SLOT;
-                mark += ejsEncodeUint(mark, lookup.slotNum);
-                mark += ejsEncodeUint(mark, lookup.nthBase);
-
-            } else {
-                *mark++  = EJS_OP_GET_OBJ_SLOT;
-                mark += ejsEncodeUint(mark, lookup.slotNum);
-            }
-            FILL(mark);
-#endif
-            BREAK;
-
-#if XXXX
-        CASE (EJS_OP_GET_POLY_SLOT):
-            vp = pop(ejs);
-            slotNum = GET_UINT32();
-            type = GET_PTR();
-            if (TYPE(vp) != type) {
-                GET_SLOT(thisObj, vp, slotNum);
-            } else {
-                v1 = ejsGetVarByName(ejs, vp, qname, &lookup);
-                CHECK_VALUE(v1, vp, lookup.obj, lookup.slotNum);
-            }
-
-        /*
-            Load a property by property name
-                GetObjName          <qname>
-                Stack before (top)  [obj]
-                Stack after         [result]
-         */
-        CASE (EJS_OP_GET_OBJ_NAME):
-            mark = FRAME->pc - 1;
-            qname = GET_NAME();
-            vp = pop(ejs);
-            if (vp == ESV(null) || vp == ESV(undefined)) {
-                ejsThrowReferenceError(ejs, "Object reference is null");
+            if ((entry = findInlineEntry(ejs, code, site, vp)) != 0) {
+                obj = entry->holder ? entry->holder : vp;
+                CHECK_VALUE(ejsGetProperty(ejs, obj, entry->slotNum), vp, obj, entry->slotNum);
                 BREAK;
             }
             v1 = ejsGetVarByName(ejs, vp, qname, &lookup);
             CHECK_VALUE(v1, vp, lookup.obj, lookup.slotNum);
-
-            if (v1 && lookup.obj == vp) {
-                *mark++ = EJS_OP_GET_POLY_SLOT;
-                *mark++ = lookup.slotNum;
-                uint *ui = (uint*) mark;
-                *ui++ = lookup.
-                uint *ui = (uint*) FRAME->pc;
-                *ui = ejsEncodeUint(mark, lookup.slotNum);
+            if (v1) {
+                cacheProperty(ejs, code, site, vp, lookup.obj, lookup.slotNum, 1);
             }
-            FILL(mark);
             BREAK;
-#endif
 
         /*
             Load a property by property a qualified name expression
@@ -846,6 +763,7 @@ static void VM(Ejs *ejs, EjsFunction *fun, EjsAny *otherThis, int argc, int stac
                 BREAK;
             } else {
                 qname.name = ejsToString(ejs, v1);
+                ejsInternName(qname);
                 if (ejsIs(ejs, v2, Namespace)) {
                     qname.space = ((EjsNamespace*) v2)->value;
                 } else {
@@ -1018,6 +936,7 @@ static void VM(Ejs *ejs, EjsFunction *fun, EjsAny *otherThis, int argc, int stac
          */
         CASE (EJS_OP_PUT_SCOPED_NAME_EXPR):
             qname.name = ejsToString(ejs, pop(ejs));
+            ejsInternName(qname);
             v1 = pop(ejs);
             if (ejsIs(ejs, v1, Namespace)) {
                 qname.space = ((EjsNamespace*) v1)->value;
@@ -1030,16 +949,22 @@ static void VM(Ejs *ejs, EjsFunction *fun, EjsAny *otherThis, int argc, int stac
 
         /*
             Store a property by property name to an object
-                PutObjName
+                PutObjName          <site.32> <qname>
                 Stack before (top)  [objRef]
                                     [value]
                 Stack after         []
          */
         CASE (EJS_OP_PUT_OBJ_NAME):
+            site = GET_WORD();
+            code = FRAME->function.body.code;
             qname = GET_NAME();
             obj = pop(ejs);
             value = pop(ejs);
-            storeProperty(ejs, obj, obj, qname, value);
+            if ((entry = findInlineEntry(ejs, code, site, obj)) != 0 && entry->holder == 0) {
+                SET_SLOT(obj, obj, entry->slotNum, value);
+            } else if ((slotNum = storeProperty(ejs, obj, obj, qname, value)) >= 0) {
+                cacheProperty(ejs, code, site, obj, obj, slotNum, 1);
+            }
             BREAK;
 
         /*
@@ -1061,6 +986,7 @@ static void VM(Ejs *ejs, EjsFunction *fun, EjsAny *otherThis, int argc, int stac
                 ejsSetProperty(ejs, obj, ejsGetInt(ejs, v1), value);
             } else {
                 qname.name = ejsToString(ejs, v1);
+                ejsInternName(qname);
                 if (ejsIs(ejs, v2, Namespace)) {
                     qname.space = ((EjsNamespace*) v2)->value;
                 } else {
@@ -1254,12 +1180,14 @@ static void VM(Ejs *ejs, EjsFunction *fun, EjsAny *otherThis, int argc, int stac
 
         /*
             Call a function by name on the pushed object
-                CallObjName         <qname> <argc>
+                CallObjName         <site.32> <qname> <argc>
                 Stack before (top)  [args]
                                     [obj]
                 Stack after         []
          */
         CASE (EJS_OP_CALL_OBJ_NAME):
+            site = GET_WORD();
+            code = FRAME->function.body.code;
             qname = GET_NAME();
             argc = GET_INT();
             argc += ejs->spreadArgs;
@@ -1270,16 +1198,21 @@ static void VM(Ejs *ejs, EjsFunction *fun, EjsAny *otherThis, int argc, int stac
                 throwNull(ejs);
                 BREAK;
             }
-            slotNum = ejsLookupVar(ejs, vp, qname, &lookup);
-            if (slotNum < 0) {
+            if ((entry = findInlineEntry(ejs, code, site, vp)) != 0) {
+                obj = entry->holder ? entry->holder : vp;
+                slotNum = entry->slotNum;
+            } else if ((slotNum = ejsLookupVar(ejs, vp, qname, &lookup)) < 0) {
                 ejsThrowReferenceError(ejs, "Cannot find function \"%@\"", qname.name);
+                BREAK;
             } else {
-                EjsTrait *trait = ejsGetPropertyTraits(ejs, lookup.obj, slotNum);
-                if (trait && trait->attributes & EJS_PROP_STATIC) {
-                    vp = lookup.obj;
-                }
-                callProperty(ejs, lookup.obj, slotNum, vp, argc, 1);
+                obj = lookup.obj;
+                cacheProperty(ejs, code, site, vp, obj, slotNum, 0);
+            }
+            trait = ejsGetPropertyTraits(ejs, obj, slotNum);
+            if (trait && trait->attributes & EJS_PROP_STATIC) {
+                vp = obj;
             }
+            callProperty(ejs, obj, slotNum, vp, argc, 1);
             BREAK;
 
         /*
@@ -1703,6 +1636,57 @@ static void VM(Ejs *ejs, EjsFunction *fun, EjsAny *otherThis, int argc, int stac
             BREAK;
         }
 
+        /*
+            Computed goto for a switch over dense integer case values. Offsets are relative to the end of the table
+            and the last entry is the default. The switch value is left on the stack.
+                SwitchTable         <min> <count> <offset.32> ... <default.32>
+                Stack before (top)  [value]
+                Stack after         [value]
+         */
+        CASE (EJS_OP_SWITCH_TABLE): {
+            uchar   *table;
+            double  d;
+            int64   min;
+            int     count, index;
+
+            min = GET_NUM();
+            count = GET_INT();
+            table = FRAME->pc;
+            index = count;
+            vp = *state->stack;
+            if (ejsIs(ejs, vp, Number)) {
+                d = ((EjsNumber*) vp)->value - min;
+                if (0 <= d && d < count && d == (int) d) {
+                    index = (int) d;
+                }
+            }
+            FRAME->pc = &table[index * 4];
+            offset = GET_WORD();
+            SET_PC(FRAME, &table[(count + 1) * 4 + offset]);
+            BREAK;
+        }
+
+        /*
+            Hashed goto for a switch over string case values. Offsets are relative to the end of the instruction.
+            The switch value is left on the stack.
+                SwitchLookup        <site.32> <count> (<string> <offset.32>) ... <default.32>
+                Stack before (top)  [value]
+                Stack after         [value]
+         */
+        CASE (EJS_OP_SWITCH_LOOKUP): {
+            EjsSwitch   *sw;
+
+            site = GET_WORD();
+            if ((sw = getSwitch(ejs, FRAME, site)) == 0) {
+                ejsThrowMemoryError(ejs);
+                BREAK;
+            }
+            vp = *state->stack;
+            offset = ejsIs(ejs, vp, String) ? lookupSwitch(sw, (EjsString*) vp) : sw->defaultOffset;
+            SET_PC(FRAME, &FRAME->function.body.code->byteCode[sw->end + offset]);
+            BREAK;
+        }
+
         /*
             Spread array/object as individual args
                 Pop
@@ -2152,6 +2136,35 @@ static void VM(Ejs *ejs, EjsFunction *fun, EjsAny *otherThis, int argc, int stac
             push(result);
             BREAK;
 
+        /*
+            Increment a local variable in place. Superinstruction for GetLocalSlot, Dup, Inc, PutLocalSlot, Pop.
+                IncLocalSlot        <slot> <increment>
+                Stack before (top)  []
+                Stack after         []
+         */
+        CASE (EJS_OP_INC_LOCAL_SLOT):
+            slotNum = GET_INT();
+            count = (schar) GET_BYTE();
+            result = evalBinaryExpr(ejs, ejsGetProperty(ejs, FRAME, slotNum), EJS_OP_ADD, ejsCreateNumber(ejs, count));
+            if (result) {
+                SET_SLOT(NULL, FRAME, slotNum, result);
+            }
+            BREAK;
+
+        /*
+            Add two local variables. Superinstruction for GetLocalSlot, GetLocalSlot, Add.
+                AddLocalSlots       <slot1> <slot2>
+                Stack before (top)  []
+                Stack after         [result]
+         */
+        CASE (EJS_OP_ADD_LOCAL_SLOTS):
+            slotNum = GET_INT();
+            v1 = ejsGetProperty(ejs, FRAME, slotNum);
+            v2 = ejsGetProperty(ejs, FRAME, GET_INT());
+            ejs->result = evalBinaryExpr(ejs, v1, EJS_OP_ADD, v2);
+            push(ejs->result);
+            BREAK;
+
 
         /* Object creation */
 
@@ -2264,6 +2277,7 @@ static void VM(Ejs *ejs, EjsFunction *fun, EjsAny *otherThis, int argc, int stac
          */
         CASE (EJS_OP_DELETE_NAME_EXPR):
             qname.name = ejsToString(ejs, pop(ejs));
+            ejsInternName(qname);
             v1 = pop(ejs);
             if (ejsIs(ejs, v1, Namespace)) {
                 qname.space = ((EjsNamespace*) v1)->value;
@@ -2293,6 +2307,7 @@ static void VM(Ejs *ejs, EjsFunction *fun, EjsAny *otherThis, int argc, int stac
          */
         CASE (EJS_OP_DELETE_SCOPED_NAME_EXPR):
             qname.name = ejsToString(ejs, pop(ejs));
+            ejsInternName(qname);
             v1 = pop(ejs);
             if (ejsIs(ejs, v1, Namespace)) {
                 qname.space = ((EjsNamespace*) v1)->value;
@@ -2491,11 +2506,12 @@ static void storePropertyToSlot(Ejs *ejs, EjsObj *thisObj, EjsAny *obj, int slot
 /*
     Store a property by name in the given object. Will create if the property does not already exist.
  */
-static void storeProperty(Ejs *ejs, EjsObj *thisObj, EjsAny *vp, EjsName qname, EjsObj *value)
+static int storeProperty(Ejs *ejs, EjsObj *thisObj, EjsAny *vp, EjsName qname, EjsObj *value)
 {
     EjsLookup       lookup;
     EjsTrait        *trait;
     EjsPot          *pot;
+    EjsAny          *obj;
     int             slotNum;
 
     assert(qname.name);
@@ -2507,9 +2523,10 @@ static void storeProperty(Ejs *ejs, EjsObj *thisObj, EjsAny *vp, EjsName qname,
     if (TYPE(vp)->helpers.setPropertyByName) {
         slotNum = (*TYPE(vp)->helpers.setPropertyByName)(ejs, vp, qname, value);
         if (slotNum >= 0) {
-            return;
+            return -1;
         }
     }
+    obj = vp;
     if ((slotNum = ejsLookupVar(ejs, vp, qname, &lookup)) >= 0) {
         if (lookup.obj != vp) {
             trait = ejsGetPropertyTraits(ejs, lookup.obj, slotNum);
@@ -2544,6 +2561,8 @@ static void storeProperty(Ejs *ejs, EjsObj *thisObj, EjsAny *vp, EjsName qname,
     if (!ejs->exception) {
         storePropertyToSlot(ejs, thisObj, vp, slotNum, value);
     }
+    /* Return the slot only if the property was stored in the original object */
+    return (vp == obj && !ejs->exception) ? slotNum : -1;
 }
 
 
@@ -2592,6 +2611,269 @@ static void storePropertyToScope(Ejs *ejs, EjsName qname, EjsObj *value)
 }
 
 
+/*
+    Find a valid inline cache entry for the by-name instruction "site" and the receiver "obj". Own property entries
+    are validated by checking the property name at the cached slot. Entries for properties found on a prototype or
+    type are valid while no prototype or type property has been added or removed and the receiver does not define
+    a property of the same name.
+ */
+static EjsInlineEntry *findInlineEntry(Ejs *ejs, EjsCode *code, int site, EjsAny *obj)
+{
+    EjsInlineCache  *cache;
+    EjsInlineEntry  *ep;
+    EjsSlot         *sp;
+    EjsPot          *pot;
+    EjsName         qname;
+    EjsType         *type;
+    int             i;
+
+    if (code->sites == 0 || site >= code->numSites || (cache = code->sites[site]) == 0) {
+        return 0;
+    }
+    type = TYPE(obj);
+    for (i = 0; i < cache->count; i++) {
+        ep = &cache->entries[i];
+        if (ep->type != type) {
+            continue;
+        }
+        if (ep->holder == 0) {
+            pot = obj;
+            if (ep->slotNum < pot->numProp) {
+                sp = &pot->properties->slots[ep->slotNum];
+                if (sp->qname.name == ep->qname.name && sp->qname.space == ep->qname.space &&
+                        !(sp->trait.attributes & EJS_TRAIT_DELETED)) {
+                    return ep;
+                }
+            }
+        } else if (ep->version == ejs->service->prototypeVersion) {
+            if (DYNAMIC(obj)) {
+                qname.name = ep->qname.name;
+                qname.space = NULL;
+                if (ejsLookupProperty(ejs, obj, qname) >= 0 || ejsLookupProperty(ejs, obj, ep->qname) >= 0) {
+                    continue;
+                }
+            }
+            return ep;
+        }
+    }
+    return 0;
+}
+
+
+/*
+    Get the site table for a function. The table has one entry per instruction site numbered by the compiler and is
+    allocated on first use. Returns null if the code has no sites or memory is exhausted.
+ */
+static void * volatile *getSites(EjsCode *code)
+{
+    void    **sites;
+
+    if (code->sites == 0 && code->numSites > 0) {
+        if ((sites = mprAllocZeroed(code->numSites * sizeof(void*))) != 0) {
+            /* If another interpreter published a table first, use that one */
+            mprAtomicCas((void* volatile*) &code->sites, 0, sites);
+        }
+    }
+    return code->sites;
+}
+
+
+static void manageInlineCache(EjsInlineCache *cache, int flags)
+{
+    EjsInlineEntry  *ep;
+    int             i;
+
+    if (flags & MPR_MANAGE_MARK) {
+        for (i = 0; i < cache->count; i++) {
+            ep = &cache->entries[i];
+            mprMark(ep->type);
+            mprMark(ep->holder);
+            ejsMarkName(&ep->qname);
+        }
+    }
+}
+
+
+/*
+    Record where a by-name instruction found its property. The holder is the object containing the property.
+    Set byName for loads and stores which must honor the getPropertyByName and setPropertyByName helpers.
+    Caches are copied on write and published with a compare and swap so no lock is taken. If another interpreter
+    updates the site first, this entry is dropped and will be recorded on a later miss.
+ */
+static void cacheProperty(Ejs *ejs, EjsCode *code, int site, EjsAny *obj, EjsAny *holder, int slotNum, int byName)
+{
+    EjsInlineCache  *cache, *prior;
+    EjsInlineEntry  *ep;
+    EjsType         *type;
+    EjsName         qname;
+    void * volatile *sites;
+    int             count, version, i;
+
+    if (site < 0 || site >= code->numSites) {
+        return;
+    }
+    /*
+        Stale prototype entries are dropped. Megamorphic sites with a full set of valid entries are left as-is.
+     */
+    version = ejs->service->prototypeVersion;
+    prior = code->sites ? code->sites[site] : 0;
+    if (prior) {
+        for (count = i = 0; i < prior->count; i++) {
+            ep = &prior->entries[i];
+            if (ep->holder == 0 || ep->version == version) {
+                count++;
+            }
+        }
+        if (count >= EJS_INLINE_CACHE_SIZE) {
+            return;
+        }
+    }
+    type = TYPE(obj);
+    if (slotNum < 0 || type->virtualSlots || type->constructor.block.nobind) {
+        return;
+    }
+    if (byName && (type->helpers.getPropertyByName || type->helpers.setPropertyByName)) {
+        return;
+    }
+    if (holder == obj) {
+        if (!type->isPot) {
+            return;
+        }
+        holder = 0;
+    } else if (ejsIsType(ejs, obj) || !ejsIsPot(ejs, holder) ||
+            !(((EjsPot*) holder)->isPrototype || ((EjsPot*) holder)->isType)) {
+        return;
+    }
+    qname = ejsGetPropertyName(ejs, holder ? holder : obj, slotNum);
+    if (qname.name == 0 || isdigit((uchar) qname.name->value[0])) {
+        return;
+    }
+    if ((sites = getSites(code)) == 0 || (cache = mprAllocObj(EjsInlineCache, manageInlineCache)) == 0) {
+        return;
+    }
+    for (i = 0; prior && i < prior->count; i++) {
+        ep = &prior->entries[i];
+        if (ep->holder == 0 || ep->version == version) {
+            cache->entries[cache->count++] = *ep;
+        }
+    }
+    ep = &cache->entries[cache->count++];
+    ep->type = type;
+    ep->holder = holder;
+    ep->qname = qname;
+    ep->slotNum = slotNum;
+    ep->version = version;
+    mprAtomicCas(&sites[site], prior, cache);
+}
+
+
+static void manageSwitch(EjsSwitch *sw, int flags)
+{
+    int     i;
+
+    if (flags & MPR_MANAGE_MARK) {
+        for (i = 0; i <= sw->mask; i++) {
+            mprMark(sw->entries[i].value);
+        }
+    }
+}
+
+
+/*
+    Get the lookup table for a SWITCH_LOOKUP instruction. The table is built from the instruction operands on first
+    execution and cached in the instruction site. Tables are published with a compare and swap like inline caches.
+ */
+static EjsSwitch *getSwitch(Ejs *ejs, EjsFrame *fp, int site)
+{
+    EjsCode         *code;
+    EjsSwitch       *sw;
+    EjsSwitchEntry  *ep;
+    EjsString       *value;
+    void * volatile *sites;
+    uint            index;
+    int             count, size, i;
+
+    code = fp->function.body.code;
+    if (code->sites && site < code->numSites && (sw = code->sites[site]) != 0) {
+        return sw;
+    }
+    count = (int) ejsDecodeNum(ejs, &fp->pc);
+    for (size = 2; size < count * 2; size <<= 1) ;
+    if ((sw = mprAllocBlock(sizeof(EjsSwitch) + size * sizeof(EjsSwitchEntry), 
+            MPR_ALLOC_MANAGER | MPR_ALLOC_ZERO)) == 0) {
+        return 0;
+    }
+    mprSetManager(sw, (MprManager) manageSwitch);
+    sw->mask = size - 1;
+    for (i = 0; i < count; i++) {
+        value = getStringArg(ejs, fp);
+        index = whash(value->value, value->length) & sw->mask;
+        while (sw->entries[index].value) {
+            index = (index + 1) & sw->mask;
+        }
+        ep = &sw->entries[index];
+        ep->value = value;
+        ep->offset = ejsDecodeInt32(ejs, &fp->pc);
+    }
+    sw->defaultOffset = ejsDecodeInt32(ejs, &fp->pc);
+    sw->end = (int) (fp->pc - code->byteCode);
+
+    if (site < code->numSites && (sites = getSites(code)) != 0) {
+        if (!mprAtomicCas(&sites[site], 0, sw)) {
+            sw = sites[site];
+        }
+    }
+    return sw;
+}
+
+
+static int lookupSwitch(EjsSwitch *sw, EjsString *value)
+{
+    EjsSwitchEntry  *ep;
+    uint            index;
+
+    index = whash(value->value, value->length) & sw->mask;
+    for (ep = &sw->entries[index]; ep->value; ep = &sw->entries[index]) {
+        if (ep->value == value || (ep->value->length == value->length &&
+                memcmp(ep->value->value, value->value, value->length * sizeof(wchar)) == 0)) {
+            return ep->offset;
+        }
+        index = (index + 1) & sw->mask;
+    }
+    return sw->defaultOffset;
+}
+
+
+/*
+    Create the XML object for an XML literal. The literal is parsed once into a template cached in the instruction
+    site. Each evaluation returns a deep copy of the template so the parser does not run again.
+ */
+static EjsXML *loadXmlLiteral(Ejs *ejs, EjsFrame *fp, int site)
+{
+    EjsCode         *code;
+    EjsXML          *template;
+    EjsString       *str;
+    void * volatile *sites;
+
+    code = fp->function.body.code;
+    str = getStringArg(ejs, fp);
+    if (code->sites && site < code->numSites && (template = code->sites[site]) != 0) {
+        return ejsCloneXML(ejs, template);
+    }
+    template = ejsCreateObj(ejs, EST(XML), 0);
+    ejsLoadXMLString(ejs, template, str);
+    if (ejs->exception) {
+        return template;
+    }
+    if (site < code->numSites && (sites = getSites(code)) != 0) {
+        if (!mprAtomicCas(&sites[site], 0, template)) {
+            template = sites[site];
+        }
+    }
+    return ejsCloneXML(ejs, template);
+}
+
+
 /*
     Run the module initializer
  */
@@ -3814,7 +4096,6 @@ void ejsShowOpFrequency(Ejs *ejs)
 #undef GET_TYPE
 #undef GET_WORD
 #undef THIS
-#undef FILL
 #undef CASE
 #undef BREAK
 
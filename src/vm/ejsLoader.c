@@ -29,14 +29,16 @@ static int  loadEndModuleSection(Ejs *ejs, EjsModule *mp);
 static int  loadDebugSection(Ejs *ejs, EjsModule *mp);
 static int  loadExceptionSection(Ejs *ejs, EjsModule *mp);
 static int  loadFunctionSection(Ejs *ejs, EjsModule *mp);
-static EjsModule *loadModuleSection(Ejs *ejs, MprFile *file, EjsModuleHdr *hdr, int *created, int flags);
+static EjsModule *loadModuleSection(Ejs *ejs, MprFile *file, EjsModuleMap *map, EjsModuleHdr *hdr, int *created, 
+    int flags);
 static int  loadNativeLibrary(Ejs *ejs, EjsModule *mp, cchar *path);
-static int  loadSections(Ejs *ejs, MprFile *file, cchar *path, EjsModuleHdr *hdr, int flags);
+static int  loadSections(Ejs *ejs, MprFile *file, EjsModuleMap *map, cchar *path, EjsModuleHdr *hdr, int flags);
 static int  loadPropertySection(Ejs *ejs, EjsModule *mp, int sectionType);
 static int  loadScriptModule(Ejs *ejs, cchar *filename, int minVersion, int maxVersion, int flags);
 static char *makeModuleName(cchar *name);
 static void popScope(EjsModule *mp, int keepScope);
 static void pushScope(EjsModule *mp, EjsAny *block, EjsAny *obj);
+static cchar *readMapped(EjsModuleMap *map, MprFile *file, ssize len);
 static cchar *search(Ejs *ejs, cchar *filename, int minVersion, int maxVersion);
 static int  trimModule(Ejs *ejs, char *name);
 static void setDoc(Ejs *ejs, EjsModule *mp, cchar *tag, void *vp, int slotNum);
@@ -158,7 +160,7 @@ static cchar *search(Ejs *ejs, cchar *filename, int minVersion, int maxVersion)
 /*
     Load the sections: modules, classes, properties and functions from a module file. May load muliple logical modules.
  */
-static int loadSections(Ejs *ejs, MprFile *file, cchar *path, EjsModuleHdr *hdr, int flags)
+static int loadSections(Ejs *ejs, MprFile *file, EjsModuleMap *map, cchar *path, EjsModuleHdr *hdr, int flags)
 {
     EjsModule   *mp;
     int         next, rc, sectionType, created, firstModule, status;
@@ -215,7 +217,7 @@ static int loadSections(Ejs *ejs, MprFile *file, cchar *path, EjsModuleHdr *hdr,
             break;
 
         case EJS_SECT_MODULE:
-            if ((mp = loadModuleSection(ejs, file, hdr, &created, flags)) == 0) {
+            if ((mp = loadModuleSection(ejs, file, map, hdr, &created, flags)) == 0) {
                 return MPR_ERR_CANT_LOAD;
             }
             mp->mutex = mprCreateLock();
@@ -277,7 +279,8 @@ static int loadSections(Ejs *ejs, MprFile *file, cchar *path, EjsModuleHdr *hdr,
 /*
     Load a module section and constant pool.
  */
-static EjsModule *loadModuleSection(Ejs *ejs, MprFile *file, EjsModuleHdr *hdr, int *created, int flags)
+static EjsModule *loadModuleSection(Ejs *ejs, MprFile *file, EjsModuleMap *map, EjsModuleHdr *hdr, int *created, 
+    int flags)
 {
     EjsModule       *mp, tmod;
     EjsString       *name;
@@ -308,15 +311,19 @@ static EjsModule *loadModuleSection(Ejs *ejs, MprFile *file, EjsModuleHdr *hdr,
         assert(0);
         return 0;
     }
-    if ((pool = mprAlloc(poolSize)) == 0) {
-        return 0;
-    }
-    if (mprReadFile(file, pool, poolSize) != poolSize) {
-        return 0;
+    if ((pool = (char*) readMapped(map, file, poolSize)) == 0) {
+        if ((pool = mprAlloc(poolSize)) == 0) {
+            return 0;
+        }
+        if (mprReadFile(file, pool, poolSize) != poolSize) {
+            return 0;
+        }
+        map = 0;
     }
     if (ejsCreateConstants(ejs, mp, poolCount, poolSize, pool) < 0) {
         return 0;
     }
+    mp->constants->map = map;
     name = ejsCreateStringFromConst(ejs, mp, nameToken);
 
     if ((mp = ejsCreateModule(ejs, name, version, mp->constants)) == NULL) {
@@ -326,6 +333,7 @@ static EjsModule *loadModuleSection(Ejs *ejs, MprFile *file, EjsModuleHdr *hdr,
     mp->current = mprCreateList(-1, 0);
     pushScope(mp, 0, ejs->global);
     mp->checksum = checksum;
+    mp->map = map;
     *created = 1;
 
     mp->file = file;
@@ -593,7 +601,7 @@ static int loadFunctionSection(Ejs *ejs, EjsModule *mp)
     EjsName         qname, returnTypeName;
     EjsPot          *block;
     uchar           *code;
-    int             slotNum, numProp, numArgs, numDefault, codeLen, numExceptions, attributes, strict, sn;
+    int             slotNum, numProp, numArgs, numDefault, codeLen, numSites, numExceptions, attributes, strict, sn;
 
     strict = 0;
     code = 0;
@@ -608,6 +616,7 @@ static int loadFunctionSection(Ejs *ejs, EjsModule *mp)
     numDefault = ejsModuleReadInt(ejs, mp);
     numExceptions = ejsModuleReadInt(ejs, mp);
     codeLen = ejsModuleReadInt(ejs, mp);
+    numSites = (codeLen > 0) ? ejsModuleReadInt(ejs, mp) : 0;
 
     if (mp->hasError) {
         return MPR_ERR_CANT_READ;
@@ -639,11 +648,13 @@ static int loadFunctionSection(Ejs *ejs, EjsModule *mp)
             Read the code
          */
         if (codeLen > 0) {
-            if ((code = mprAlloc(codeLen)) == 0) {
-                return MPR_ERR_MEMORY;
-            }
-            if (mprReadFile(mp->file, code, codeLen) != codeLen) {
-                return MPR_ERR_CANT_READ;
+            if ((code = (uchar*) readMapped(mp->map, mp->file, codeLen)) == 0) {
+                if ((code = mprAlloc(codeLen)) == 0) {
+                    return MPR_ERR_MEMORY;
+                }
+                if (mprReadFile(mp->file, code, codeLen) != codeLen) {
+                    return MPR_ERR_CANT_READ;
+                }
             }
             if (currentType) {
                 currentType->hasScriptFunctions = 1;
@@ -661,6 +672,9 @@ static int loadFunctionSection(Ejs *ejs, EjsModule *mp)
         if (fun == 0) {
             return MPR_ERR_MEMORY;
         }
+        if (fun->body.code) {
+            fun->body.code->numSites = numSites;
+        }
         assert(fun->block.pot.isBlock);
         assert(fun->block.pot.isFunction);
         if (numProp > 0) {
@@ -934,10 +948,32 @@ static int loadNativeLibrary(Ejs *ejs, EjsModule *mp, cchar *modPath)
 }
 
 
+/*
+    Return a reference to the next len bytes of the module file if it is mapped and advance the file position. 
+    Returns null if the file is not mapped so the caller reads a private copy.
+ */
+static cchar *readMapped(EjsModuleMap *map, MprFile *file, ssize len)
+{
+    MprOff      pos;
+
+    if (map == 0 || (pos = mprGetFilePosition(file)) < 0 || pos > map->size) {
+        return 0;
+    }
+    if (!ejsIsMapped(map, &map->data[pos], len)) {
+        return 0;
+    }
+    if (mprSeekFile(file, SEEK_CUR, len) != (pos + len)) {
+        return 0;
+    }
+    return &map->data[pos];
+}
+
+
 static int loadScriptModule(Ejs *ejs, cchar *filename, int minVersion, int maxVersion, int flags)
 {
     EjsModuleHdr    hdr;
     EjsModule       *mp;
+    EjsModuleMap    *map;
     MprFile         *file;
     cchar           *path;
     int             next, status, firstModule;
@@ -954,6 +990,7 @@ static int loadScriptModule(Ejs *ejs, cchar *filename, int minVersion, int maxVe
     }
     mprHold(file);
     mprEnableFileBuffering(file, 0, 0);
+    map = ejsMapModule(ejs, path);
     firstModule = mprGetListLength(ejs->modules);
 
     /*
@@ -979,7 +1016,7 @@ static int loadScriptModule(Ejs *ejs, cchar *filename, int minVersion, int maxVe
         /*
             WARNING: this may block and GC may run
          */
-        if ((status = loadSections(ejs, file, path, &hdr, flags)) < 0) {
+        if ((status = loadSections(ejs, file, map, path, &hdr, flags)) < 0) {
             if (ejs->exception == 0) {
                 ejsThrowReferenceError(ejs, "Cannot load module file %s", path);
                 status = MPR_ERR_CANT_LOAD;
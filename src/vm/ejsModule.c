@@ -47,6 +47,7 @@ static void manageModule(EjsModule *mp, int flags)
         mprMark(mp->mutex);
         mprMark(mp->constants);
         mprMark(mp->initializer);
+        mprMark(mp->map);
         mprMark(mp->loadState);
         mprMark(mp->dependencies);
         mprMark(mp->file);
@@ -174,7 +175,11 @@ static void manageConstants(EjsConstants *cp, int flags)
     int     i;
 
     if (flags & MPR_MANAGE_MARK) {
-        mprMark(cp->pool);
+        if (cp->map) {
+            mprMark(cp->map);
+        } else {
+            mprMark(cp->pool);
+        }
         mprMark(cp->table);
         mprMark(cp->index);
         /*
@@ -242,10 +247,23 @@ int ejsCreateConstants(Ejs *ejs, EjsModule *mp, int count, ssize size, char *poo
 int ejsGrowConstants(Ejs *ejs, EjsModule *mp, ssize len)
 {
     EjsConstants    *cp;
+    char            *pool;
     int             indexSize;
 
     lock(mp);
     cp = mp->constants;
+    if (cp->map) {
+        /*
+            The pool is in a read-only module mapping. Take a private copy before modifying.
+         */
+        if ((pool = mprAlloc(cp->poolSize)) == 0) {
+            unlock(mp);
+            return MPR_ERR_MEMORY;
+        }
+        memcpy(pool, cp->pool, cp->poolLength);
+        cp->pool = pool;
+        cp->map = 0;
+    }
     if ((cp->poolLength + len) >= cp->poolSize) {
         cp->poolSize = ((cp->poolSize + len) + EC_BUFSIZE - 1) / EC_BUFSIZE * EC_BUFSIZE;
         if ((cp->pool = mprRealloc(cp->pool, cp->poolSize)) == 0) {
@@ -320,6 +338,93 @@ EjsString *ejsCreateStringFromConst(Ejs *ejs, EjsModule *mp, int index)
 }
 
 
+/************************************************** Mapping ****************************************************/
+
+#if ME_EJS_MAP_MODULES
+static void manageModuleMap(EjsModuleMap *map, int flags)
+{
+    if (flags & MPR_MANAGE_MARK) {
+        mprMark(map->path);
+
+    } else if (flags & MPR_MANAGE_FREE) {
+        if (map->data) {
+            munmap(map->data, (size_t) map->size);
+            map->data = 0;
+        }
+    }
+}
+#endif
+
+
+/*
+    Map a module file read-only. Mappings are cached in the service by path so all interpreters share one copy of the
+    byte code and constant pools. A modified file gets a fresh mapping. Modules loaded from the prior mapping hold a 
+    reference to it, so it is only unmapped once they have all been collected.
+ */
+PUBLIC EjsModuleMap *ejsMapModule(Ejs *ejs, cchar *path)
+{
+#if ME_EJS_MAP_MODULES
+    EjsService      *sp;
+    EjsModuleMap    *map;
+    struct stat     info;
+    void            *data;
+    int             fd;
+
+    if ((sp = MPR->ejsService) == 0 || sp->moduleMaps == 0) {
+        return 0;
+    }
+    if ((fd = open(path, O_RDONLY | O_BINARY)) < 0) {
+        return 0;
+    }
+    if (fstat(fd, &info) < 0 || !S_ISREG(info.st_mode) || info.st_size <= 0) {
+        close(fd);
+        return 0;
+    }
+    lock(sp);
+    if ((map = mprLookupKey(sp->moduleMaps, path)) != 0) {
+        if (map->size == (ssize) info.st_size && map->modified == (MprTime) info.st_mtime) {
+            unlock(sp);
+            close(fd);
+            return map;
+        }
+    }
+    map = 0;
+    data = mmap(0, (size_t) info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data != MAP_FAILED) {
+        if ((map = mprAllocObj(EjsModuleMap, manageModuleMap)) == 0) {
+            munmap(data, (size_t) info.st_size);
+        } else {
+            map->path = sclone(path);
+            map->data = data;
+            map->size = (ssize) info.st_size;
+            map->modified = (MprTime) info.st_mtime;
+            mprAddKey(sp->moduleMaps, path, map);
+        }
+    }
+    unlock(sp);
+    return map;
+#else
+    return 0;
+#endif
+}
+
+
+/*
+    Test if a block of memory lies within a module mapping
+ */
+PUBLIC bool ejsIsMapped(EjsModuleMap *map, cvoid *ptr, ssize len)
+{
+    cchar   *cp;
+
+    if (map == 0 || map->data == 0) {
+        return 0;
+    }
+    cp = (cchar*) ptr;
+    return cp >= map->data && len >= 0 && len <= (map->size - (cp - map->data));
+}
+
+
 /************************************************** Debug ******************************************************/
 
 EjsDebug *ejsCreateDebug(Ejs *ejs, int length)
@@ -30,6 +30,7 @@ int ejsLookupScope(Ejs *ejs, EjsName name, EjsLookup *lookup)
     assert(name.space);
     assert(lookup);
 
+    ejsInternName(name);
     memset(lookup, 0, sizeof(*lookup));
 
     //  OPT -- remove nthBlock. Not needed if not binding
@@ -136,6 +137,7 @@ int ejsLookupVar(Ejs *ejs, EjsAny *obj, EjsName name, EjsLookup *lookup)
     assert(obj);
     assert(lookup);
 
+    ejsInternName(name);
     memset(lookup, 0, sizeof(*lookup));
 
     /* Lookup simple object */
@@ -183,6 +185,8 @@ int ejsLookupVarWithNamespaces(Ejs *ejs, EjsAny *obj, EjsName name, EjsLookup *l
     assert(obj);
     assert(name.name);
     assert(name.space);
+
+    ejsInternName(name);
     assert(lookup);
 
     b = (EjsBlock*) ejs->global;
@@ -278,6 +282,7 @@ EjsAny *ejsGetVarByName(Ejs *ejs, EjsAny *obj, EjsName name, EjsLookup *lookup)
 
     assert(ejs);
 
+    ejsInternName(name);
     //  OPT - really nice to remove this
     //  OPT -- perhaps delegate the logic below down into a getPropertyByName?
     if (obj && TYPE(obj)->helpers.getPropertyByName) {
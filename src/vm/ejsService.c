@@ -12,15 +12,15 @@
 
 static void cloneProperties(Ejs *ejs, Ejs *master);
 static int  configureEjs(Ejs *ejs);
+static void configurePool(EjsPool *pool);
+static Ejs  *createPoolVM(EjsPool *pool, int flags);
 static void defineSharedTypes(Ejs *ejs);
 static void initSearchPath(Ejs *ejs, cchar *search);
 static void initStack(Ejs *ejs);
 static int  loadRequiredModules(Ejs *ejs, MprList *require);
 static void manageEjs(Ejs *ejs, int flags);
 static void manageEjsService(EjsService *service, int flags);
-#if UNUSED && OPT
 static void poolTimer(EjsPool *pool, MprEvent *event);
-#endif
 static int  runSpecificMethod(Ejs *ejs, cchar *className, cchar *methodName);
 static int  searchForMethod(Ejs *ejs, cchar *methodName, EjsType **typeReturn);
 
@@ -42,6 +42,8 @@ static EjsService *createService()
     mprSetMemNotifier((MprMemNotifier) allocNotifier);
 #endif
     sp->nativeModules = mprCreateHash(-1, MPR_HASH_STATIC_KEYS);
+    sp->moduleMaps = mprCreateHash(-1, 0);
+    sp->regexps = mprCreateHash(ME_EJS_REGEXP_CACHE, 0);
     sp->mutex = mprCreateLock();
     sp->vmlist = mprCreateList(-1, MPR_LIST_STATIC_VALUES);
     sp->intern = ejsCreateIntern(sp);
@@ -55,13 +57,23 @@ static EjsService *createService()
 
 static void manageEjsService(EjsService *sp, int flags)
 {
+    int     i;
+
     if (flags & MPR_MANAGE_MARK) {
         mprMark(sp->http);
         mprMark(sp->mutex);
         mprMark(sp->vmlist);
         mprMark(sp->nativeModules);
+        mprMark(sp->moduleMaps);
+        mprMark(sp->regexps);
         mprMark(sp->intern);
         mprMark(sp->immutable);
+        if (sp->numbers) {
+            mprMark(sp->numbers);
+            for (i = 0; i <= ME_EJS_NUMBER_CACHE_MAX - ME_EJS_NUMBER_CACHE_MIN; i++) {
+                mprMark(sp->numbers[i]);
+            }
+        }
         mprMark(sp->dtoaSpin[0]);
         mprMark(sp->dtoaSpin[1]);
 
@@ -136,18 +148,30 @@ Ejs *ejsCreateVM(int argc, cchar **argv, int flags)
 }
 
 
+/*
+    Clone a VM from a master. If the master is frozen (a pool template), mutable global objects are not copied here.
+    They remain shared with the master and are cloned on first access via ejsCloneLazyGlobal.
+ */
 Ejs *ejsCloneVM(Ejs *master)
 {
     EjsModule   *mp;
     Ejs         *ejs;
+    MprMemStats *stats;
+    MprTicks    mark;
+    ssize       used;
     int         next;
 
     if (master) {
         assert(!master->empty);
+        mark = mprGetTicks();
+        stats = &MPR->heap->stats;
+        used = stats->bytesAllocated - stats->bytesFree;
         if ((ejs = ejsCreateVM(master->argc, master->argv, master ? master->flags : 0)) == 0) {
             return 0;
         }
+        lock(master);
         cloneProperties(ejs, master);
+        unlock(master);
         ejsFixTraits(ejs, ejs->global);
         ejs->sqlite = master->sqlite;
         ejs->http = master->http;
@@ -156,12 +180,56 @@ Ejs *ejsCloneVM(Ejs *master)
         for (next = 0; (mp = mprGetNextItem(master->modules, &next)) != 0;) {
             ejsAddModule(ejs, mp);
         }
+        ejs->cloneTime = mprGetElapsedTicks(mark);
+        ejs->cloneMemory = (stats->bytesAllocated - stats->bytesFree) - used;
+        mprDebug("ejs vm", 5, "clone VM in %lld msec, %zd bytes, %d lazy globals", 
+            ejs->cloneTime, ejs->cloneMemory, ejs->lazyCount);
         return ejs;
     }
     return ejsCreateVM(0, 0, 0);
 }
 
 
+/*
+    Clone a global that is still shared with the master VM. Called on first access to the global slot.
+    The master is locked as deep cloning temporarily marks the source objects.
+ */
+PUBLIC EjsAny *ejsCloneLazyGlobal(Ejs *ejs, int slotNum)
+{
+    Ejs         *master;
+    EjsAny      *vp;
+
+    assert(ejsIsLazyGlobal(ejs, slotNum));
+
+    master = ejs->master;
+    ejsClearLazyGlobal(ejs, slotNum);
+    lock(master);
+    vp = ejsClone(ejs, ((EjsPot*) master->global)->properties->slots[slotNum].value.ref, 1);
+    unlock(master);
+    if (ejsIsPot(ejs, vp)) {
+        ejsFixTraits(ejs, vp);
+    }
+    ejsSetProperty(ejs, ejs->global, slotNum, vp);
+    return vp;
+}
+
+
+/*
+    Mark a global slot as no longer shared with the master. The master reference is released after the last one.
+ */
+PUBLIC void ejsClearLazyGlobal(Ejs *ejs, int slotNum)
+{
+    assert(ejsIsLazyGlobal(ejs, slotNum));
+
+    ejs->lazyGlobals[slotNum >> 3] &= ~(1 << (slotNum & 7));
+    if (--ejs->lazyCount <= 0) {
+        ejs->lazyGlobals = 0;
+        ejs->lazyLimit = 0;
+        ejs->master = 0;
+    }
+}
+
+
 /*
     Load the standard ejs modules with an optional override search path and list of required modules.
     If the require list is empty, then ejs->empty will be true. This routine should only be called once for an interpreter.
@@ -206,6 +274,9 @@ void ejsDestroyVM(Ejs *ejs)
     int         next;
 
     ejs->destroying = 1;
+#if ME_EJS_OP_TRACE
+    ejsShowOpSequences(ejs);
+#endif
     sp = ejs->service;
     if (sp) {
         modules = ejs->modules;
@@ -289,6 +360,8 @@ static void manageEjs(Ejs *ejs, int flags)
         mprMark(ejs->doc);
         mprMark(ejs->http);
         mprMark(ejs->mutex);
+        mprMark(ejs->master);
+        mprMark(ejs->lazyGlobals);
 
     } else if (flags & MPR_MANAGE_FREE) {
         ejsDestroyVM(ejs);
@@ -302,6 +375,7 @@ static void managePool(EjsPool *pool, int flags)
         mprMark(pool->list);
         mprMark(pool->timer);
         mprMark(pool->mutex);
+        mprMark(pool->cond);
         mprMark(pool->template);
         mprMark(pool->templateScript);
         mprMark(pool->startScript);
@@ -327,7 +401,10 @@ EjsPool *ejsCreatePool(int poolMax, cchar *templateScript, cchar *startScript, c
         return 0;
     }
     pool->mutex = mprCreateLock();
+    pool->cond = mprCreateCond();
     pool->max = poolMax <= 0 ? MAXINT : poolMax;
+    pool->idleTimeout = EJS_POOL_INACTIVITY_TIMEOUT;
+    pool->waitTimeout = EJS_POOL_WAIT_TIMEOUT;
     if (templateScript) {
         pool->templateScript = sclone(templateScript);
     }
@@ -347,87 +424,246 @@ EjsPool *ejsCreatePool(int poolMax, cchar *templateScript, cchar *startScript, c
 }
 
 
-Ejs *ejsAllocPoolVM(EjsPool *pool, int flags)
+int ejsSetPoolLimits(EjsPool *pool, int minVMs, int maxVMs, MprTicks idleTimeout, MprTicks waitTimeout)
+{
+    Ejs     *ejs;
+
+    assert(pool);
+
+    lock(pool);
+    pool->configured = 1;
+    pool->max = maxVMs <= 0 ? MAXINT : maxVMs;
+    pool->min = min(max(minVMs, 0), pool->max);
+    if (idleTimeout >= 0) {
+        pool->idleTimeout = idleTimeout;
+    }
+    if (waitTimeout >= 0) {
+        pool->waitTimeout = waitTimeout;
+    }
+    while (pool->count < pool->min) {
+        pool->count++;
+        unlock(pool);
+        if ((ejs = createPoolVM(pool, pool->flags)) == 0) {
+            lock(pool);
+            pool->count--;
+            unlock(pool);
+            return MPR_ERR_CANT_CREATE;
+        }
+        lock(pool);
+        pool->stats.prewarmed++;
+        ejs->idleTime = mprGetTicks();
+        mprPushItem(pool->list, ejs);
+    }
+    unlock(pool);
+    return 0;
+}
+
+
+static int getPoolLimit(Ejs *ejs, EjsAny *limits, cchar *name, int defaultValue)
+{
+    EjsAny  *value;
+
+    if ((value = ejsGetPropertyByName(ejs, limits, EN(name))) == 0 || !ejsIs(ejs, value, Number)) {
+        return defaultValue;
+    }
+    return ejsGetInt(ejs, value);
+}
+
+
+/*
+    Apply the limits defined by the "pool" section of the template VM's App.config (ejsrc). Limits set via 
+    ejsSetPoolLimits take precedence. Timeouts are in seconds. Must be called with the pool locked.
+ */
+static void configurePool(EjsPool *pool)
+{
+    Ejs         *ejs;
+    EjsType     *app;
+    EjsAny      *config, *limits;
+    int         value;
+
+    ejs = pool->template;
+    if (pool->configured || (app = ejsGetTypeByName(ejs, N("ejs", "App"))) == 0) {
+        return;
+    }
+    if ((config = ejsGetProperty(ejs, app, ES_App_config)) == 0 || !ejsIsPot(ejs, config)) {
+        return;
+    }
+    if ((limits = ejsGetPropertyByName(ejs, config, EN("pool"))) == 0 || !ejsIsPot(ejs, limits)) {
+        return;
+    }
+    if ((value = getPoolLimit(ejs, limits, "max", -1)) >= 0) {
+        pool->max = value == 0 ? MAXINT : value;
+    }
+    pool->min = min(max(getPoolLimit(ejs, limits, "min", pool->min), 0), pool->max);
+    if ((value = getPoolLimit(ejs, limits, "idle", -1)) >= 0) {
+        pool->idleTimeout = value * 1000;
+    }
+    if ((value = getPoolLimit(ejs, limits, "wait", -1)) >= 0) {
+        pool->waitTimeout = value * 1000;
+    }
+}
+
+
+/*
+    Create a new pool VM by cloning the pool template. The template is created on first use.
+    The caller must have reserved the VM by incrementing pool->count.
+ */
+static Ejs *createPoolVM(EjsPool *pool, int flags)
 {
     Ejs         *ejs;
     EjsString   *script;
     int         paused;
 
-    assert(pool);
-
-    if ((ejs = mprPopItem(pool->list)) == 0) {
-        if (pool->count >= pool->max) {
-            mprLog("ejs vm", 0, "Too many ejs VMS: %d max %d", pool->count, pool->max);
+    lock(pool);
+    if (pool->template == 0) {
+        /*
+            Create the pool template VM
+         */
+        if ((pool->template = ejsCreateVM(0, 0, flags)) == 0) {
+            unlock(pool);
             return 0;
         }
-        lock(pool);
-        if (pool->template == 0) {
-            /*
-                Create the pool template VM
-             */
-            if ((pool->template = ejsCreateVM(0, 0, flags)) == 0) {
-                unlock(pool);
-                return 0;
-            }
-            if (ejsLoadModules(pool->template, 0, 0) < 0) {
+        if (ejsLoadModules(pool->template, 0, 0) < 0) {
+            pool->template = 0;
+            unlock(pool);
+            return 0;
+        }
+        if (pool->templateScript) {
+            script = ejsCreateStringFromAsc(pool->template, pool->templateScript);
+            paused = ejsBlockGC(pool->template);
+            if (ejsLoadScriptLiteral(pool->template, script, NULL, EC_FLAGS_NO_OUT | EC_FLAGS_BIND) < 0) {
+                mprLog("ejs vm", 0, "Cannot execute \"%@\"\n%s", script, ejsGetErrorMsg(pool->template, 1));
+                ejsUnblockGC(pool->template, paused);
+                pool->template = 0;
                 unlock(pool);
                 return 0;
             }
-            if (pool->templateScript) {
-                script = ejsCreateStringFromAsc(pool->template, pool->templateScript);
-                paused = ejsBlockGC(pool->template);
-                if (ejsLoadScriptLiteral(pool->template, script, NULL, EC_FLAGS_NO_OUT | EC_FLAGS_BIND) < 0) {
-                    mprLog("ejs vm", 0, "Cannot execute \"%@\"\n%s", script, ejsGetErrorMsg(pool->template, 1));
-                    unlock(pool);
-                    ejsUnblockGC(pool->template, paused);
-                    return 0;
-                }
-                ejsUnblockGC(pool->template, paused);
-            }
+            ejsUnblockGC(pool->template, paused);
         }
-        unlock(pool);
+        configurePool(pool);
+        /*
+            The template is never run again so clones can share its mutable globals until first access
+         */
+        pool->template->frozen = 1;
+    }
+    unlock(pool);
 
-        if ((ejs = ejsCloneVM(pool->template)) == 0) {
-            mprLog("ejs vm", 0, "Cannot alloc ejs VM");
+    if ((ejs = ejsCloneVM(pool->template)) == 0) {
+        mprLog("ejs vm", 0, "Cannot alloc ejs VM");
+        return 0;
+    }
+    if (pool->hostedDocuments) {
+        ejs->hostedDocuments = pool->hostedDocuments;
+    }
+    if (pool->hostedHome) {
+        ejs->hostedHome = pool->hostedHome;
+    }
+    mprAddRoot(ejs);
+    if (pool->startScriptPath) {
+        if (ejsLoadScriptFile(ejs, pool->startScriptPath, NULL, EC_FLAGS_NO_OUT | EC_FLAGS_BIND) < 0) {
+            mprLog("ejs vm", 0, "Cannot load \"%s\"\n%s", pool->startScriptPath, ejsGetErrorMsg(ejs, 1));
+            mprRemoveRoot(ejs);
             return 0;
         }
-        if (pool->hostedDocuments) {
-            ejs->hostedDocuments = pool->hostedDocuments;
-        }
-        if (pool->hostedHome) {
-            ejs->hostedHome = pool->hostedHome;
+    } else if (pool->startScript) {
+        script = ejsCreateStringFromAsc(ejs, pool->startScript);
+        if (ejsLoadScriptLiteral(ejs, script, NULL, EC_FLAGS_NO_OUT | EC_FLAGS_BIND) < 0) {
+            mprLog("ejs vm", 0, "Cannot load \"%@\"\n%s", script, ejsGetErrorMsg(ejs, 1));
+            mprRemoveRoot(ejs);
+            return 0;
         }
-        mprAddRoot(ejs);
-        if (pool->startScriptPath) {
-            if (ejsLoadScriptFile(ejs, pool->startScriptPath, NULL, EC_FLAGS_NO_OUT | EC_FLAGS_BIND) < 0) {
-                mprLog("ejs vm", 0, "Cannot load \"%s\"\n%s", pool->startScriptPath, ejsGetErrorMsg(ejs, 1));
-                mprRemoveRoot(ejs);
+    }
+    mprRemoveRoot(ejs);
+    lock(pool);
+    pool->stats.created++;
+    unlock(pool);
+    return ejs;
+}
+
+
+/*
+    Start the pool timer if there is work to do. Must be called with the pool locked.
+ */
+static void startPoolTimer(EjsPool *pool)
+{
+    if (!pool->timer && (pool->count != pool->min || pool->demand > 0)) {
+        pool->timer = mprCreateTimerEvent(NULL, "ejsPoolTimer", EJS_POOL_TIMER_PERIOD, poolTimer, pool,
+            MPR_EVENT_CONTINUOUS);
+    }
+}
+
+
+/*
+    Allocate a VM from the pool. If the pool is full, wait up to pool->waitTimeout for a VM to be freed.
+ */
+Ejs *ejsAllocPoolVM(EjsPool *pool, int flags)
+{
+    Ejs         *ejs;
+    MprTicks    start, remaining, waited;
+
+    assert(pool);
+
+    start = 0;
+    lock(pool);
+    pool->flags = flags;
+    while ((ejs = mprPopItem(pool->list)) == 0) {
+        if (pool->count < pool->max) {
+            pool->count++;
+            pool->demand++;
+            unlock(pool);
+            if ((ejs = createPoolVM(pool, flags)) == 0) {
+                lock(pool);
+                pool->count--;
+                unlock(pool);
                 return 0;
             }
-        } else if (pool->startScript) {
-            script = ejsCreateStringFromAsc(ejs, pool->startScript);
-            if (ejsLoadScriptLiteral(ejs, script, NULL, EC_FLAGS_NO_OUT | EC_FLAGS_BIND) < 0) {
-                mprLog("ejs vm", 0, "Cannot load \"%@\"\n%s", script, ejsGetErrorMsg(ejs, 1));
-                mprRemoveRoot(ejs);
-                return 0;
+            lock(pool);
+            break;
+        }
+        remaining = start ? pool->waitTimeout - mprGetElapsedTicks(start) : pool->waitTimeout;
+        if (remaining <= 0) {
+            mprLog("ejs vm", 0, "Too many ejs VMS: %d max %d", pool->count, pool->max);
+            pool->stats.timeouts++;
+            if (start) {
+                waited = mprGetElapsedTicks(start);
+                pool->stats.totalWait += waited;
+                pool->stats.maxWait = max(pool->stats.maxWait, waited);
             }
+            unlock(pool);
+            return 0;
         }
-        mprRemoveRoot(ejs);
-        pool->count++;
+        if (start == 0) {
+            start = mprGetTicks();
+            pool->stats.waits++;
+            pool->demand++;
+        }
+        pool->waiting++;
+        unlock(pool);
+
+        /* Yield so the GC can proceed while this thread is blocked */
+        mprYield(MPR_YIELD_STICKY);
+        mprWaitForCond(pool->cond, remaining);
+        mprResetYield();
+
+        lock(pool);
+        pool->waiting--;
+    }
+    if (pool->waiting > 0 && mprGetListLength(pool->list) > 0) {
+        /* Pass on the wakeup. The condition only holds one signal */
+        mprSignalCond(pool->cond);
     }
+    if (start) {
+        waited = mprGetElapsedTicks(start);
+        pool->stats.totalWait += waited;
+        pool->stats.maxWait = max(pool->stats.maxWait, waited);
+    }
+    pool->stats.allocs++;
+    pool->stats.peakActive = max(pool->stats.peakActive, pool->count - mprGetListLength(pool->list));
     pool->lastActivity = mprGetTime();
+    startPoolTimer(pool);
     mprDebug("ejs", 5, "Alloc VM active %d, allocated %d, max %d", pool->count - mprGetListLength(pool->list),
         pool->count, pool->max);
-
-#if UNUSED && OPT
-    /*
-        Disabled because it most of the interp is not being freed due to references from the EjsService
-     */
-    if (!pool->timer && !mprGetDebugMode()) {
-        pool->timer = mprCreateTimerEvent(NULL, "ejsPoolTimer", EJS_POOL_INACTIVITY_TIMEOUT, poolTimer, pool,
-            MPR_EVENT_CONTINUOUS | MPR_EVENT_QUICK);
-    }
-#endif
+    unlock(pool);
     return ejs;
 }
 
@@ -439,33 +675,90 @@ void ejsFreePoolVM(EjsPool *pool, Ejs *ejs)
     assert(!ejs->exception);
 
     ejs->exception = 0;
+    ejs->idleTime = mprGetTicks();
+    lock(pool);
     pool->lastActivity = mprGetTime();
     mprPushItem(pool->list, ejs);
+    if (pool->waiting > 0) {
+        mprSignalCond(pool->cond);
+    }
     mprDebug("ejs", 5, "Free VM, active %d, allocated %d, max %d", pool->count - mprGetListLength(pool->list), pool->count,
         pool->max);
+    unlock(pool);
 }
 
 
-#if UNUSED && OPT
+void ejsGetPoolStats(EjsPool *pool, EjsPoolStats *stats)
+{
+    assert(pool);
+    assert(stats);
+
+    lock(pool);
+    *stats = pool->stats;
+    stats->count = pool->count;
+    stats->idle = mprGetListLength(pool->list);
+    stats->active = pool->count - stats->idle;
+    stats->waiting = pool->waiting;
+    stats->min = pool->min;
+    stats->max = pool->max;
+    unlock(pool);
+}
+
+
+/*
+    Pool maintenance. Prune VMs that have been idle longer than the idle timeout, but keep at least pool->min VMs.
+    Pre-warm VMs up to the minimum and to meet the demand seen since the last tick (VMs created on demand and callers
+    that waited). VMs that are idle or were just pruned count toward the demand so a burst that has completed does not
+    create more VMs.
+ */
 static void poolTimer(EjsPool *pool, MprEvent *event)
 {
     Ejs     *vm;
-    int     next;
+    int     prune, pruned, warm;
+
+    lock(pool);
+    pruned = 0;
+    prune = !mprGetDebugMode();
+    while (prune && pool->count > pool->min && (vm = mprGetFirstItem(pool->list)) != 0) {
+        if (mprGetElapsedTicks(vm->idleTime) < pool->idleTimeout) {
+            break;
+        }
+        mprRemoveItemAtPos(pool->list, 0);
+        vm->abandoned = 1;
+        pool->count--;
+        pruned++;
+    }
+    pool->stats.reaped += pruned;
+    warm = max(pool->min - pool->count, pool->demand - mprGetListLength(pool->list) - pruned);
+    warm = min(warm, pool->max - pool->count);
+    pool->demand = 0;
 
-    if (mprGetElapsedTime(pool->lastActivity) > EJS_POOL_INACTIVITY_TIMEOUT && !mprGetDebugMode()) {
-        for (ITERATE_ITEMS(pool->list, vm, next)) {
-            vm->abandoned = 1;
+    while (warm-- > 0) {
+        pool->count++;
+        unlock(pool);
+        if ((vm = createPoolVM(pool, pool->flags)) == 0) {
+            lock(pool);
+            pool->count--;
+            break;
         }
-        mprClearList(pool->list);
-        pool->count = 0;
-        pool->template = 0;
-        mprDebug("ejs", 5, "Release %d VMs in inactive pool. Invoking GC.", pool->count);
-        mprRequestGC(MPR_GC_FORCE);
+        lock(pool);
+        pool->stats.prewarmed++;
+        vm->idleTime = mprGetTicks();
+        mprPushItem(pool->list, vm);
+        if (pool->waiting > 0) {
+            mprSignalCond(pool->cond);
+        }
+    }
+    if (pool->count <= pool->min && pool->waiting == 0) {
         mprRemoveEvent(event);
         pool->timer = 0;
     }
+    unlock(pool);
+    if (pruned) {
+        /* Pruned VMs are no longer referenced and are freed by the next garbage collection */
+        mprDebug("ejs", 5, "Pruned %d idle VMs, allocated %d", pruned, pool->count);
+    }
 }
-#endif
 
 
 void ejsSetDispatcher(Ejs *ejs, MprDispatcher *dispatcher)
@@ -547,9 +840,16 @@ static void cloneProperties(Ejs *ejs, Ejs *master)
     assert(master);
 
     /*
-        For subsequent VMs, copy global references to immutable types and functions.
+        For subsequent VMs, copy global references to immutable types and functions. If the master is frozen, 
+        defer cloning mutable instances until first access. Mutable types are always cloned so ejsFixTraits can
+        update trait references.
      */
     numProp = ((EjsPot*) master->global)->numProp;
+    if (master->frozen && numProp > 0) {
+        ejs->lazyGlobals = mprAllocZeroed((numProp + 7) / 8);
+        ejs->lazyLimit = numProp;
+        ejs->master = master;
+    }
     for (i = 0; i < numProp; i++) {
         vp = ejsGetProperty(master, master->global, i);
         qname = ejsGetPropertyName(master, master->global, i);
@@ -568,11 +868,22 @@ static void cloneProperties(Ejs *ejs, Ejs *master)
             immutable = 1;
         }
         if (!immutable) {
+            if (ejs->lazyGlobals && !ejsIsType(ejs, vp)) {
+                ejsSetProperty(ejs, ejs->global, i, vp);
+                ejs->lazyGlobals[i >> 3] |= (1 << (i & 7));
+                ejs->lazyCount++;
+                continue;
+            }
             mvp = vp;
             vp = ejsClone(ejs, mvp, 1);
         }
         ejsSetProperty(ejs, ejs->global, i, vp);
     }
+    if (ejs->lazyGlobals && ejs->lazyCount <= 0) {
+        ejs->lazyGlobals = 0;
+        ejs->lazyLimit = 0;
+        ejs->master = 0;
+    }
 }
 
 